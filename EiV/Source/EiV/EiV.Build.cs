@@ -3,7 +3,7 @@
 /* Licensed under MIT license. See LICENSE for full license text.
 *
 *        Created: 20th March 2025
-*  Last Modified: 8th April 2025
+*  Last Modified: 19th October 2026
 */
 
 using UnrealBuildTool;
@@ -16,7 +16,10 @@ public class EiV : ModuleRules
 			
 		PublicDependencyModuleNames.AddRange(new string[] { "Core", "Eigen" });
 			
-		PrivateDependencyModuleNames.AddRange(new string[] { "CoreUObject", "Engine", "Eigen" });
+		PrivateDependencyModuleNames.AddRange(new string[] { "CoreUObject", "Engine", "Eigen", "EiVDeterministic" });
+
+		// EiVLibrary.h enables every Eigen module inside this module, see the extern templates of FEiVHelper
+		PrivateDefinitions.Add("EIV_MODULE_BUILD=1");
 
 		AddEngineThirdPartyPrivateStaticDependencies(Target, "Eigen");
 		PublicDefinitions.Add("EIGEN_IGNORE_UNREACHABLE_CODE_WARNING=1");
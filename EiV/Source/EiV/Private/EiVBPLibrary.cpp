@@ -3,11 +3,24 @@
 /* Licensed under MIT license. See LICENSE for full license text.
 *
 *        Created: 20th March 2025
-*  Last Modified: 17th June 2025
+*  Last Modified: 19th October 2026
 */
 
 #include "EiVBPLibrary.h"
 #include "EiV.h"
+#include "EiVSparseKernels.h"
+#include "EiVIterativeSolvers.h"
+#include "EiVSparseDirectSolvers.h"
+#include "EiVMatrixIO.h"
+#include "EiVFFT.h"
+#include "EiVSVD.h"
+#include "EiVLieGroups.h"
+#include "EiVSkinning.h"
+#include "EiVProcrustes.h"
+#include "EiVMeshOperators.h"
+#include "EiVBandedSolvers.h"
+#include "EiVDeterministic.h"
+#include "EiVResultCache.h"
 
 UEiVBPLibrary::UEiVBPLibrary(const FObjectInitializer& ObjectInitializer)
 : Super(ObjectInitializer)
@@ -67,7 +80,12 @@ void UEiVBPLibrary::EiVAdjointMatrix(FEiVDynamicMatrix A, FEiVDynamicMatrix& Mat
 void UEiVBPLibrary::EiVMatrixMultiplication(FEiVDynamicMatrix A, FEiVDynamicMatrix B, FEiVDynamicMatrix& Matrix)
 {
 	if (A.Matrix.cols() == B.Matrix.rows()) {
-		Matrix = FEiVDynamicMatrix(A.Matrix * B.Matrix);
+		if (FEiVDeterministic::IsGlobalEnabled()) {
+			EiVDeterministicMatrixMultiplication(A, B, Matrix);
+		}
+		else {
+			Matrix = FEiVDynamicMatrix(A.Matrix * B.Matrix);
+		}
 	}
 	else {
 		Matrix = FEiVDynamicMatrix();
@@ -76,7 +94,10 @@ void UEiVBPLibrary::EiVMatrixMultiplication(FEiVDynamicMatrix A, FEiVDynamicMatr
 
 void UEiVBPLibrary::EiVDotProduct(FEiVDynamicMatrix A, FEiVDynamicMatrix B, double& DotProduct)
 {
-	if (A.Matrix.cols() == B.Matrix.cols()) {
+	if (FEiVDeterministic::IsGlobalEnabled()) {
+		EiVDeterministicDotProduct(A, B, DotProduct);
+	}
+	else if (A.Matrix.cols() == B.Matrix.cols()) {
 		EiVVectorXd ASpecific = A.Matrix.col(0);
 		EiVVectorXd BSpecific = B.Matrix.col(0);
 		DotProduct = ASpecific.dot(BSpecific);
@@ -115,7 +136,12 @@ void UEiVBPLibrary::EiVMatrixSize(FEiVDynamicMatrix A, int& Size)
 
 void UEiVBPLibrary::EiVMatrixSum(FEiVDynamicMatrix A, double& Sum)
 {
-	Sum = A.Matrix.sum();
+	if (FEiVDeterministic::IsGlobalEnabled()) {
+		EiVDeterministicMatrixSum(A, Sum);
+	}
+	else {
+		Sum = A.Matrix.sum();
+	}
 }
 
 void UEiVBPLibrary::EiVMatrixProduct(FEiVDynamicMatrix A, double& Product)
@@ -125,7 +151,12 @@ void UEiVBPLibrary::EiVMatrixProduct(FEiVDynamicMatrix A, double& Product)
 
 void UEiVBPLibrary::EiVMatrixMean(FEiVDynamicMatrix A, double& Mean)
 {
-	Mean = A.Matrix.mean();
+	if (FEiVDeterministic::IsGlobalEnabled()) {
+		EiVDeterministicMatrixMean(A, Mean);
+	}
+	else {
+		Mean = A.Matrix.mean();
+	}
 }
 
 void UEiVBPLibrary::EiVMatrixTrace(FEiVDynamicMatrix A, double& Trace)
@@ -209,64 +240,114 @@ void UEiVBPLibrary::EiVMatrixReshape(FEiVDynamicMatrix A, int32 RowSize, int32 C
 void UEiVBPLibrary::EiVColPivHHQR(FEiVDynamicMatrix A, FEiVDynamicMatrix B, FEiVDynamicMatrix& Solution)
 {
 	if (B.Matrix.rows() == A.Matrix.cols()) {
-		Solution = FEiVDynamicMatrix(A.Matrix.colPivHouseholderQr().solve(B.Matrix.col(0)));
+		static const FName Operation(TEXT("EiVColPivHHQRSolve"));
+		FEiVCachedResult Result;
+		FEiVResultCache::FindOrCompute(Operation, { &A.Matrix, &B.Matrix }, {}, Result, [&A, &B](FEiVCachedResult& OutResult)
+		{
+			OutResult.Matrices.Add(A.Matrix.colPivHouseholderQr().solve(B.Matrix.col(0)));
+		});
+		Solution = FEiVDynamicMatrix(Result.Matrices[0]);
 	}
 	else {
 		Solution = FEiVDynamicMatrix();
 	}
 }
 
+// the eigenvalue and eigenvector nodes share one decomposition, so with the result cache enabled reading both of
+// them only computes it once
+static void EiVCachedEigenDecomposition(const EiVMatrixXd& A, FEiVCachedResult& Result)
+{
+	static const FName Operation(TEXT("EiVEigenDecomposition"));
+	FEiVResultCache::FindOrCompute(Operation, { &A }, {}, Result, [&A](FEiVCachedResult& OutResult)
+	{
+		EiVEigenSolver<EiVMatrixXd> Solver(A);
+		OutResult.bSuccess = Solver.info() == EiVComputationInfo::Success;
+		if (OutResult.bSuccess) {
+			OutResult.ComplexMatrices.Add(Solver.eigenvalues());
+			OutResult.ComplexMatrices.Add(Solver.eigenvectors());
+		}
+	});
+}
+
 void UEiVBPLibrary::EiVMatrixEigenvalues(FEiVDynamicMatrix A, EEiVBPFuncSuccess& Success, FEiVDynamicComplexMatrix& Solution)
 {
-	EiVEigenSolver<EiVMatrixXd> Solver(A.Matrix);
-	if (Solver.info() != EiVComputationInfo::Success) {
+	FEiVCachedResult Result;
+	EiVCachedEigenDecomposition(A.Matrix, Result);
+	if (!Result.bSuccess) {
 		Success = EEiVBPFuncSuccess::FAILURE;
 		Solution = FEiVDynamicComplexMatrix();
 	}
 	else {
 		Success = EEiVBPFuncSuccess::SUCCESS;
-		Solution = FEiVDynamicComplexMatrix(Solver.eigenvalues());
+		Solution = FEiVDynamicComplexMatrix(Result.ComplexMatrices[0]);
 	}
 }
 
 void UEiVBPLibrary::EiVMatrixEigenvectors(FEiVDynamicMatrix A, EEiVBPFuncSuccess& Success, FEiVDynamicComplexMatrix& Solution)
 {
-	EiVEigenSolver<EiVMatrixXd> Solver(A.Matrix);
-	if (Solver.info() != EiVComputationInfo::Success) {
+	FEiVCachedResult Result;
+	EiVCachedEigenDecomposition(A.Matrix, Result);
+	if (!Result.bSuccess) {
 		Success = EEiVBPFuncSuccess::FAILURE;
 		Solution = FEiVDynamicComplexMatrix();
 	}
 	else {
 		Success = EEiVBPFuncSuccess::SUCCESS;
-		Solution = FEiVDynamicComplexMatrix(Solver.eigenvectors());
+		Solution = FEiVDynamicComplexMatrix(Result.ComplexMatrices[1]);
 	}
 }
 
 void UEiVBPLibrary::EiVMatrixDeterminant(FEiVDynamicMatrix A, double& Determinant)
 {
-	Determinant = A.Matrix.determinant();
+	static const FName Operation(TEXT("EiVDeterminant"));
+	FEiVCachedResult Result;
+	FEiVResultCache::FindOrCompute(Operation, { &A.Matrix }, {}, Result, [&A](FEiVCachedResult& OutResult)
+	{
+		OutResult.Scalars.Add(A.Matrix.determinant());
+	});
+	Determinant = Result.Scalars[0];
 }
 
 void UEiVBPLibrary::EiVMatrixInverse(FEiVDynamicMatrix A, FEiVDynamicMatrix& Inverse)
 {
-	if (A.Matrix.determinant() != 0) {
-		Inverse = FEiVDynamicMatrix(A.Matrix.inverse());
+	static const FName Operation(TEXT("EiVInverse"));
+	FEiVCachedResult Result;
+	FEiVResultCache::FindOrCompute(Operation, { &A.Matrix }, {}, Result, [&A](FEiVCachedResult& OutResult)
+	{
+		OutResult.bSuccess = A.Matrix.determinant() != 0;
+		if (OutResult.bSuccess) {
+			OutResult.Matrices.Add(A.Matrix.inverse());
+		}
+	});
+	if (Result.bSuccess) {
+		Inverse = FEiVDynamicMatrix(Result.Matrices[0]);
 	}
 }
 
 void UEiVBPLibrary::EiVMatrixRank(FEiVDynamicMatrix A, int& Rank)
 {
-	EiVFullPivLU<EiVMatrixXd> Lu(A.Matrix);
-	Rank = Lu.rank();
+	static const FName Operation(TEXT("EiVRank"));
+	FEiVCachedResult Result;
+	FEiVResultCache::FindOrCompute(Operation, { &A.Matrix }, {}, Result, [&A](FEiVCachedResult& OutResult)
+	{
+		EiVFullPivLU<EiVMatrixXd> Lu(A.Matrix);
+		OutResult.Scalars.Add(Lu.rank());
+	});
+	Rank = (int)Result.Scalars[0];
 }
 
 void UEiVBPLibrary::EiVMatrixToString(FEiVDynamicMatrix A, FString& String)
 {
+	//reserve up front and append in place, so large matrices do not reallocate the string over and over
+	String.Reserve(String.Len() + A.Matrix.size() * 12 + A.Matrix.rows() * 4 + 4);
 	String += "{";
 	for (int i = 0; i < A.Matrix.rows(); i++) {
 		String += "\n [";
 		for (int j = 0; j < A.Matrix.cols(); j++) {
-			String += FString::SanitizeFloat(A.Matrix.coeff(i, j)) + (j != A.Matrix.cols() - 1 ? ", " : "");
+			String += FString::SanitizeFloat(A.Matrix.coeff(i, j));
+			if (j != A.Matrix.cols() - 1) {
+				String += ", ";
+			}
 		}
 		String += "]";
 	}
@@ -343,9 +424,13 @@ void UEiVBPLibrary::EiVArrayAbs(FEiVArray A, FEiVArray& Array)
 
 void UEiVBPLibrary::EiVArrayToString(FEiVArray A, FString& String)
 {
+	String.Reserve(String.Len() + A.Array.size() * 12 + 2);
 	String += "[";
 	for (int i = 0; i < A.Array.rows(); i++) {
-		String += FString::SanitizeFloat(A.Array.coeff(i)) + (i != A.Array.rows() - 1 ? ", " : "");
+		String += FString::SanitizeFloat(A.Array.coeff(i));
+		if (i != A.Array.rows() - 1) {
+			String += ", ";
+		}
 	}
 	String += "]";
 }
@@ -355,12 +440,22 @@ void UEiVBPLibrary::EiVMatrixAllFinite(FEiVDynamicMatrix A, bool& Out) {
 }
 
 void UEiVBPLibrary::EiVMatrixCompleteOrthogonalDecomposition(FEiVDynamicMatrix A, FEiVDynamicMatrix& P, FEiVDynamicMatrix& QTZ, FEiVDynamicMatrix& Q, FEiVDynamicMatrix& T, FEiVDynamicMatrix& Z) {
-	EiVCompleteOrthhogonalDecomposition<EiVMatrixXd> O = A.Matrix.completeOrthogonalDecomposition();
-	P = FEiVDynamicMatrix(O.colsPermutation());
-	QTZ = FEiVDynamicMatrix(O.matrixQTZ());
-	Q = FEiVDynamicMatrix(O.matrixQ());
-	T = FEiVDynamicMatrix(O.matrixT());
-	Z = FEiVDynamicMatrix(O.matrixZ());
+	static const FName Operation(TEXT("EiVCompleteOrthogonalDecomposition"));
+	FEiVCachedResult Result;
+	FEiVResultCache::FindOrCompute(Operation, { &A.Matrix }, {}, Result, [&A](FEiVCachedResult& OutResult)
+	{
+		EiVCompleteOrthhogonalDecomposition<EiVMatrixXd> O = A.Matrix.completeOrthogonalDecomposition();
+		OutResult.Matrices.Add(EiVMatrixXd(O.colsPermutation()));
+		OutResult.Matrices.Add(O.matrixQTZ());
+		OutResult.Matrices.Add(EiVMatrixXd(O.matrixQ()));
+		OutResult.Matrices.Add(O.matrixT());
+		OutResult.Matrices.Add(O.matrixZ());
+	});
+	P = FEiVDynamicMatrix(Result.Matrices[0]);
+	QTZ = FEiVDynamicMatrix(Result.Matrices[1]);
+	Q = FEiVDynamicMatrix(Result.Matrices[2]);
+	T = FEiVDynamicMatrix(Result.Matrices[3]);
+	Z = FEiVDynamicMatrix(Result.Matrices[4]);
 }
 
 void UEiVBPLibrary::EiVMatrixIsDiagonal(FEiVDynamicMatrix A, bool& Out) {
@@ -416,15 +511,24 @@ void UEiVBPLibrary::EiVMatrixEulerAngles(FEiVDynamicMatrix A, int a0, int a1, in
 
 void UEiVBPLibrary::EiVMatrixFullPivLU(FEiVDynamicMatrix A, FEiVDynamicMatrix& LU, FEiVDynamicMatrix& P, FEiVDynamicMatrix& L, FEiVDynamicMatrix& U, FEiVDynamicMatrix& Q)
 {
-	EiVFullPivLU<EiVMatrixXd> LUD = A.Matrix.fullPivLu();
-	LU = FEiVDynamicMatrix(LUD.matrixLU());
-	P = FEiVDynamicMatrix(LUD.permutationP());
-	int Rows = A.Matrix.rows();
-	EiVMatrixXd LP = EiVMatrixXd::Identity(A.Matrix.rows(), A.Matrix.rows());
-	LP.block(0, 0, A.Matrix.rows(), A.Matrix.cols()).triangularView<EiVUpLoType::StrictlyLower>() = LUD.matrixLU();
-	L = FEiVDynamicMatrix(LP);
-	U = FEiVDynamicMatrix(LUD.matrixLU().triangularView<EiVUpLoType::Upper>());
-	Q = FEiVDynamicMatrix(LUD.permutationQ());
+	static const FName Operation(TEXT("EiVFullPivLU"));
+	FEiVCachedResult Result;
+	FEiVResultCache::FindOrCompute(Operation, { &A.Matrix }, {}, Result, [&A](FEiVCachedResult& OutResult)
+	{
+		EiVFullPivLU<EiVMatrixXd> LUD = A.Matrix.fullPivLu();
+		OutResult.Matrices.Add(LUD.matrixLU());
+		OutResult.Matrices.Add(EiVMatrixXd(LUD.permutationP()));
+		EiVMatrixXd LP = EiVMatrixXd::Identity(A.Matrix.rows(), A.Matrix.rows());
+		LP.block(0, 0, A.Matrix.rows(), A.Matrix.cols()).triangularView<EiVUpLoType::StrictlyLower>() = LUD.matrixLU();
+		OutResult.Matrices.Add(LP);
+		OutResult.Matrices.Add(EiVMatrixXd(LUD.matrixLU().triangularView<EiVUpLoType::Upper>()));
+		OutResult.Matrices.Add(EiVMatrixXd(LUD.permutationQ()));
+	});
+	LU = FEiVDynamicMatrix(Result.Matrices[0]);
+	P = FEiVDynamicMatrix(Result.Matrices[1]);
+	L = FEiVDynamicMatrix(Result.Matrices[2]);
+	U = FEiVDynamicMatrix(Result.Matrices[3]);
+	Q = FEiVDynamicMatrix(Result.Matrices[4]);
 }
 
 
@@ -444,7 +548,12 @@ void UEiVBPLibrary::EiVMatrixNonzeros(FEiVDynamicMatrix A, int& Nonzeros)
 
 void UEiVBPLibrary::EiVMatrixNorm(FEiVDynamicMatrix A, double& Norm)
 {
-	Norm = A.Matrix.norm();
+	if (FEiVDeterministic::IsGlobalEnabled()) {
+		EiVDeterministicMatrixNorm(A, Norm);
+	}
+	else {
+		Norm = A.Matrix.norm();
+	}
 }
 
 void UEiVBPLibrary::EiVMatrixNormalize(UPARAM(ref)FEiVDynamicMatrix& A)
@@ -453,6 +562,706 @@ void UEiVBPLibrary::EiVMatrixNormalize(UPARAM(ref)FEiVDynamicMatrix& A)
 	A.Matrix = A.Matrix / Len;
 }
 
+void UEiVBPLibrary::EiVSparseDenseProduct(FEiVRowMajorSparseMatrix A, FEiVDynamicMatrix B, FEiVDynamicMatrix& Matrix)
+{
+	EiVMatrixXd Product;
+	if (FEiVSparseKernels::ParallelSparseDenseProduct(A.Matrix, B.Matrix, Product)) {
+		Matrix = FEiVDynamicMatrix(Product);
+	}
+	else {
+		Matrix = FEiVDynamicMatrix();
+	}
+}
+
+void UEiVBPLibrary::EiVSparseSparseProduct(FEiVRowMajorSparseMatrix A, FEiVRowMajorSparseMatrix B, FEiVRowMajorSparseMatrix& Matrix)
+{
+	EiVRowMajorSparseMatrix<double> Product;
+	if (FEiVSparseKernels::ParallelSparseSparseProduct(A.Matrix, B.Matrix, Product)) {
+		Matrix = FEiVRowMajorSparseMatrix(Product);
+	}
+	else {
+		Matrix = FEiVRowMajorSparseMatrix();
+	}
+}
+
+void UEiVBPLibrary::EiVSparseNonzeros(FEiVRowMajorSparseMatrix A, int& Nonzeros)
+{
+	Nonzeros = A.Matrix.nonZeros();
+}
+
+//maps the Blueprint solver and preconditioner choice onto a concrete persistent solver type
+static TSharedPtr<IEiVIterativeSolver<double>> EiVCreateIterativeSolver(EEiVIterativeSolverType SolverType, EEiVIterativePreconditioner Preconditioner, int32 RefreshInterval)
+{
+	if (Preconditioner == EEiVIterativePreconditioner::IDENTITY) {
+		switch (SolverType) {
+		case EEiVIterativeSolverType::CONJUGATE_GRADIENT:
+			return MakeShared<TEiVPersistentConjugateGradient<double, EiVIdentityPreconditioner>>();
+		case EEiVIterativeSolverType::BICGSTAB:
+			return MakeShared<TEiVPersistentBiCGSTAB<double, EiVIdentityPreconditioner>>();
+		default:
+			return MakeShared<TEiVPersistentLeastSquaresConjugateGradient<double, EiVIdentityPreconditioner>>();
+		}
+	}
+	if (Preconditioner == EEiVIterativePreconditioner::INCOMPLETE_FACTORIZATION) {
+		switch (SolverType) {
+		case EEiVIterativeSolverType::CONJUGATE_GRADIENT:
+			return MakeShared<TEiVPersistentConjugateGradient<double, EiVIncompleteCholesky<double>>>(RefreshInterval);
+		case EEiVIterativeSolverType::BICGSTAB:
+			return MakeShared<TEiVPersistentBiCGSTAB<double, EiVIncompleteLUT<double>>>(RefreshInterval);
+		default:
+			break; //Eigen has no incomplete factorization of the normal equations, fall back to the diagonal preconditioner
+		}
+	}
+	//the diagonal preconditioner is cheap, so it is rebuilt on every matrix change
+	switch (SolverType) {
+	case EEiVIterativeSolverType::CONJUGATE_GRADIENT:
+		return MakeShared<TEiVPersistentConjugateGradient<double>>(1);
+	case EEiVIterativeSolverType::BICGSTAB:
+		return MakeShared<TEiVPersistentBiCGSTAB<double>>(1);
+	default:
+		return MakeShared<TEiVPersistentLeastSquaresConjugateGradient<double>>(1);
+	}
+}
+
+void UEiVBPLibrary::EiVMakeIterativeSolver(EEiVIterativeSolverType SolverType, EEiVIterativePreconditioner Preconditioner, int32 PreconditionerRefreshInterval, FEiVIterativeSolver& Solver)
+{
+	Solver = FEiVIterativeSolver(EiVCreateIterativeSolver(SolverType, Preconditioner, PreconditionerRefreshInterval));
+}
+
+void UEiVBPLibrary::EiVIterativeSolverSetMatrix(UPARAM(ref) FEiVIterativeSolver& Solver, FEiVSparseMatrix A, bool bRefreshPreconditioner, EEiVBPFuncSuccess& Success)
+{
+	if (Solver.Solver.IsValid() && Solver.Solver->SetMatrix(A.Matrix, bRefreshPreconditioner)) {
+		Success = EEiVBPFuncSuccess::SUCCESS;
+	}
+	else {
+		Success = EEiVBPFuncSuccess::FAILURE;
+	}
+}
+
+void UEiVBPLibrary::EiVIterativeSolverSolve(UPARAM(ref) FEiVIterativeSolver& Solver, FEiVDynamicMatrix B, int32 MaxIterations, double Tolerance, bool bWarmStart, EEiVBPFuncSuccess& Success, FEiVDynamicMatrix& Solution, int32& Iterations, double& Error)
+{
+	FEiVIterativeSolveSettings Settings;
+	Settings.MaxIterations = MaxIterations;
+	Settings.Tolerance = Tolerance;
+	Settings.bWarmStart = bWarmStart;
+	FEiVIterativeSolveStats Stats;
+	EiVMatrixXd X;
+	if (Solver.Solver.IsValid() && Solver.Solver->Solve(B.Matrix, X, Settings, Stats)) {
+		Success = Stats.bConverged ? EEiVBPFuncSuccess::SUCCESS : EEiVBPFuncSuccess::FAILURE;
+		Solution = FEiVDynamicMatrix(X);
+	}
+	else {
+		Success = EEiVBPFuncSuccess::FAILURE;
+		Solution = FEiVDynamicMatrix();
+	}
+	Iterations = Stats.Iterations;
+	Error = Stats.Error;
+}
+
+void UEiVBPLibrary::EiVIterativeSolverReset(UPARAM(ref) FEiVIterativeSolver& Solver, bool bKeepMatrix)
+{
+	if (Solver.Solver.IsValid()) {
+		if (bKeepMatrix) {
+			Solver.Solver->ResetGuess();
+		}
+		else {
+			Solver.Solver->Reset();
+		}
+	}
+}
+
+//maps the Blueprint solver and ordering choice onto a concrete cached direct solver type
+template<typename Ordering>
+static TSharedPtr<IEiVSparseDirectSolver<double>> EiVCreateSparseDirectSolver(EEiVSparseDirectSolverType SolverType)
+{
+	switch (SolverType) {
+	case EEiVSparseDirectSolverType::SIMPLICIAL_LLT:
+		return MakeShared<TEiVCachedSimplicialLLT<double, Ordering>>();
+	case EEiVSparseDirectSolverType::SPARSE_LU:
+		return MakeShared<TEiVCachedSparseLU<double, Ordering>>();
+	default:
+		return MakeShared<TEiVCachedSimplicialLDLT<double, Ordering>>();
+	}
+}
+
+void UEiVBPLibrary::EiVMakeSparseDirectSolver(EEiVSparseDirectSolverType SolverType, EEiVSparseOrdering Ordering, FEiVSparseDirectSolver& Solver)
+{
+	switch (Ordering) {
+	case EEiVSparseOrdering::COLAMD:
+		Solver = FEiVSparseDirectSolver(EiVCreateSparseDirectSolver<EiVCOLAMDOrdering<int>>(SolverType));
+		break;
+	case EEiVSparseOrdering::NATURAL:
+		Solver = FEiVSparseDirectSolver(EiVCreateSparseDirectSolver<EiVNatrualOrdering<int>>(SolverType));
+		break;
+	default:
+		Solver = FEiVSparseDirectSolver(EiVCreateSparseDirectSolver<EiVAMDOrdering<int>>(SolverType));
+		break;
+	}
+}
+
+void UEiVBPLibrary::EiVSparseDirectSolverSetMatrix(UPARAM(ref) FEiVSparseDirectSolver& Solver, FEiVSparseMatrix A, bool bForceAnalyze, EEiVBPFuncSuccess& Success, bool& Analyzed)
+{
+	if (Solver.Solver.IsValid() && Solver.Solver->SetMatrix(A.Matrix, bForceAnalyze)) {
+		Success = EEiVBPFuncSuccess::SUCCESS;
+	}
+	else {
+		Success = EEiVBPFuncSuccess::FAILURE;
+	}
+	Analyzed = Solver.Solver.IsValid() && Solver.Solver->GetStats().bLastMatrixAnalyzed;
+}
+
+void UEiVBPLibrary::EiVSparseDirectSolverSolve(FEiVSparseDirectSolver Solver, FEiVDynamicMatrix B, EEiVBPFuncSuccess& Success, FEiVDynamicMatrix& Solution)
+{
+	EiVMatrixXd X;
+	if (Solver.Solver.IsValid() && Solver.Solver->Solve(B.Matrix, X)) {
+		Success = EEiVBPFuncSuccess::SUCCESS;
+		Solution = FEiVDynamicMatrix(X);
+	}
+	else {
+		Success = EEiVBPFuncSuccess::FAILURE;
+		Solution = FEiVDynamicMatrix();
+	}
+}
+
+void UEiVBPLibrary::EiVSparseDirectSolverStats(FEiVSparseDirectSolver Solver, int64& MatrixNonzeros, int64& FactorNonzeros, double& FillRatio, int32& AnalyzeCount, int32& FactorizeCount)
+{
+	const FEiVSparseDirectSolverStats Stats = Solver.Solver.IsValid() ? Solver.Solver->GetStats() : FEiVSparseDirectSolverStats();
+	MatrixNonzeros = Stats.MatrixNonZeros;
+	FactorNonzeros = Stats.FactorNonZeros;
+	FillRatio = Stats.FillRatio;
+	AnalyzeCount = Stats.AnalyzeCount;
+	FactorizeCount = Stats.FactorizeCount;
+}
+
+void UEiVBPLibrary::EiVLoadMatrixFromFile(FString Path, EEiVTextMatrixFormat Format, bool bSkipHeader, EEiVBPFuncSuccess& Success, FEiVDynamicMatrix& Matrix)
+{
+	EiVMatrixXd Loaded;
+	bool bLoaded = false;
+	if (Format == EEiVTextMatrixFormat::MATRIX_MARKET) {
+		bLoaded = FEiVMatrixIO::ReadMatrixMarket(Path, Loaded);
+	}
+	else {
+		bLoaded = FEiVMatrixIO::ReadDelimited(Path, Loaded, Format == EEiVTextMatrixFormat::TSV ? '\t' : ',', bSkipHeader);
+	}
+	if (bLoaded) {
+		Success = EEiVBPFuncSuccess::SUCCESS;
+		Matrix = FEiVDynamicMatrix(Loaded);
+	}
+	else {
+		Success = EEiVBPFuncSuccess::FAILURE;
+		Matrix = FEiVDynamicMatrix();
+	}
+}
+
+void UEiVBPLibrary::EiVSaveMatrixToFile(FEiVDynamicMatrix Matrix, FString Path, EEiVTextMatrixFormat Format, EEiVBPFuncSuccess& Success)
+{
+	bool bSaved = false;
+	if (Format == EEiVTextMatrixFormat::MATRIX_MARKET) {
+		bSaved = FEiVMatrixIO::WriteMatrixMarket(Path, Matrix.Matrix);
+	}
+	else {
+		bSaved = FEiVMatrixIO::WriteDelimited(Path, Matrix.Matrix, Format == EEiVTextMatrixFormat::TSV ? '\t' : ',');
+	}
+	Success = bSaved ? EEiVBPFuncSuccess::SUCCESS : EEiVBPFuncSuccess::FAILURE;
+}
+
+void UEiVBPLibrary::EiVLoadSparseMatrixFromFile(FString Path, EEiVBPFuncSuccess& Success, FEiVSparseMatrix& Matrix)
+{
+	EiVSparseMatrix<double> Loaded;
+	if (FEiVMatrixIO::ReadMatrixMarket(Path, Loaded)) {
+		Success = EEiVBPFuncSuccess::SUCCESS;
+		Matrix = FEiVSparseMatrix(Loaded);
+	}
+	else {
+		Success = EEiVBPFuncSuccess::FAILURE;
+		Matrix = FEiVSparseMatrix();
+	}
+}
+
+void UEiVBPLibrary::EiVSaveSparseMatrixToFile(FEiVSparseMatrix Matrix, FString Path, EEiVBPFuncSuccess& Success)
+{
+	Success = FEiVMatrixIO::WriteMatrixMarket(Path, Matrix.Matrix) ? EEiVBPFuncSuccess::SUCCESS : EEiVBPFuncSuccess::FAILURE;
+}
+
+void UEiVBPLibrary::EiVParseMatrixFromString(FString String, EEiVTextMatrixFormat Format, bool bSkipHeader, EEiVBPFuncSuccess& Success, FEiVDynamicMatrix& Matrix)
+{
+	FTCHARToUTF8 Text(*String);
+	FEiVTextLineReader Reader((const ANSICHAR*)Text.Get(), Text.Length());
+	EiVMatrixXd Parsed;
+	bool bParsed = false;
+	if (Format == EEiVTextMatrixFormat::MATRIX_MARKET) {
+		bParsed = FEiVMatrixIO::ReadMatrixMarket(Reader, Parsed);
+	}
+	else {
+		bParsed = FEiVMatrixIO::ReadDelimited(Reader, Parsed, Format == EEiVTextMatrixFormat::TSV ? '\t' : ',', bSkipHeader);
+	}
+	if (bParsed) {
+		Success = EEiVBPFuncSuccess::SUCCESS;
+		Matrix = FEiVDynamicMatrix(Parsed);
+	}
+	else {
+		Success = EEiVBPFuncSuccess::FAILURE;
+		Matrix = FEiVDynamicMatrix();
+	}
+}
+
+void UEiVBPLibrary::EiVAddComplexMatrix(FEiVDynamicComplexMatrix A, FEiVDynamicComplexMatrix B, FEiVDynamicComplexMatrix& Matrix)
+{
+	if (A.Matrix.rows() == B.Matrix.rows() && A.Matrix.cols() == B.Matrix.cols()) {
+		Matrix = FEiVDynamicComplexMatrix(A.Matrix + B.Matrix);
+	}
+	else {
+		Matrix = FEiVDynamicComplexMatrix();
+	}
+}
+
+void UEiVBPLibrary::EiVSubtractComplexMatrix(FEiVDynamicComplexMatrix A, FEiVDynamicComplexMatrix B, FEiVDynamicComplexMatrix& Matrix)
+{
+	if (A.Matrix.rows() == B.Matrix.rows() && A.Matrix.cols() == B.Matrix.cols()) {
+		Matrix = FEiVDynamicComplexMatrix(A.Matrix - B.Matrix);
+	}
+	else {
+		Matrix = FEiVDynamicComplexMatrix();
+	}
+}
+
+void UEiVBPLibrary::EiVComplexMatrixMultiplication(FEiVDynamicComplexMatrix A, FEiVDynamicComplexMatrix B, FEiVDynamicComplexMatrix& Matrix)
+{
+	if (A.Matrix.cols() == B.Matrix.rows()) {
+		Matrix = FEiVDynamicComplexMatrix(A.Matrix * B.Matrix);
+	}
+	else {
+		Matrix = FEiVDynamicComplexMatrix();
+	}
+}
+
+void UEiVBPLibrary::EiVComplexColPivHHQR(FEiVDynamicComplexMatrix A, FEiVDynamicComplexMatrix B, FEiVDynamicComplexMatrix& Solution)
+{
+	if (A.Matrix.rows() > 0 && B.Matrix.rows() == A.Matrix.rows()) {
+		Solution = FEiVDynamicComplexMatrix(EiVMatrixXcd(A.Matrix.colPivHouseholderQr().solve(B.Matrix)));
+	}
+	else {
+		Solution = FEiVDynamicComplexMatrix();
+	}
+}
+
+void UEiVBPLibrary::EiVFFT(FEiVDynamicComplexMatrix Matrix, bool bInverse, bool bTwoDimensional, FEiVDynamicComplexMatrix& Spectrum)
+{
+	if (bTwoDimensional) {
+		FEiVFFT::Transform2D(Matrix.Matrix, bInverse);
+	}
+	else if (Matrix.Matrix.rows() == 1) {
+		EiVMatrixXcd Column = Matrix.Matrix.transpose();
+		FEiVFFT::TransformColumns(Column, bInverse);
+		Matrix.Matrix = Column.transpose();
+	}
+	else {
+		FEiVFFT::TransformColumns(Matrix.Matrix, bInverse);
+	}
+	Spectrum = Matrix;
+}
+
+void UEiVBPLibrary::EiVRealFFT(FEiVDynamicMatrix Matrix, FEiVDynamicComplexMatrix& Spectrum)
+{
+	EiVMatrixXcd Bins;
+	if (Matrix.Matrix.rows() == 1) {
+		FEiVFFT::RealForward<double>(Matrix.Matrix.transpose(), Bins);
+		Spectrum = FEiVDynamicComplexMatrix(EiVMatrixXcd(Bins.transpose()));
+	}
+	else {
+		FEiVFFT::RealForward(Matrix.Matrix, Bins);
+		Spectrum = FEiVDynamicComplexMatrix(Bins);
+	}
+}
+
+void UEiVBPLibrary::EiVInverseRealFFT(FEiVDynamicComplexMatrix Spectrum, int32 Length, EEiVBPFuncSuccess& Success, FEiVDynamicMatrix& Matrix)
+{
+	EiVMatrixXd Signal;
+	const bool bRowVector = Spectrum.Matrix.rows() == 1 && Spectrum.Matrix.cols() > 1;
+	if (FEiVFFT::RealInverse<double>(bRowVector ? EiVMatrixXcd(Spectrum.Matrix.transpose()) : Spectrum.Matrix, Length, Signal)) {
+		Success = EEiVBPFuncSuccess::SUCCESS;
+		Matrix = bRowVector ? FEiVDynamicMatrix(EiVMatrixXd(Signal.transpose())) : FEiVDynamicMatrix(Signal);
+	}
+	else {
+		Success = EEiVBPFuncSuccess::FAILURE;
+		Matrix = FEiVDynamicMatrix();
+	}
+}
+
+//the part of a full convolution (SignalLength + KernelLength - 1 values) that a convolution mode keeps
+static void EiVConvolutionWindow(int64 SignalLength, int64 KernelLength, EEiVConvolutionMode Mode, int64& Start, int64& Length)
+{
+	switch (Mode) {
+	case EEiVConvolutionMode::SAME:
+		Start = (KernelLength - 1) / 2;
+		Length = SignalLength;
+		break;
+	case EEiVConvolutionMode::VALID:
+		Start = FMath::Min(SignalLength, KernelLength) - 1;
+		Length = FMath::Abs(SignalLength - KernelLength) + 1;
+		break;
+	default:
+		Start = 0;
+		Length = SignalLength + KernelLength - 1;
+		break;
+	}
+}
+
+void UEiVBPLibrary::EiVConvolve1D(FEiVDynamicMatrix Signal, FEiVDynamicMatrix Kernel, EEiVConvolutionMode Mode, FEiVDynamicMatrix& Matrix)
+{
+	const bool bSignalVector = Signal.Matrix.rows() == 1 || Signal.Matrix.cols() == 1;
+	const bool bKernelVector = Kernel.Matrix.rows() == 1 || Kernel.Matrix.cols() == 1;
+	if (!bSignalVector || !bKernelVector || Signal.Matrix.size() == 0 || Kernel.Matrix.size() == 0) {
+		Matrix = FEiVDynamicMatrix();
+		return;
+	}
+	EiVVectorXd Full;
+	FEiVFFT::Convolve<double>(Signal.Matrix.reshaped(), Kernel.Matrix.reshaped(), Full);
+	int64 Start, Length;
+	EiVConvolutionWindow(Signal.Matrix.size(), Kernel.Matrix.size(), Mode, Start, Length);
+	if (Signal.Matrix.rows() == 1 && Signal.Matrix.cols() > 1) {
+		Matrix = FEiVDynamicMatrix(EiVMatrixXd(Full.segment(Start, Length).transpose()));
+	}
+	else {
+		Matrix = FEiVDynamicMatrix(EiVMatrixXd(Full.segment(Start, Length)));
+	}
+}
+
+void UEiVBPLibrary::EiVConvolve2D(FEiVDynamicMatrix Signal, FEiVDynamicMatrix Kernel, EEiVConvolutionMode Mode, FEiVDynamicMatrix& Matrix)
+{
+	if (Signal.Matrix.size() == 0 || Kernel.Matrix.size() == 0) {
+		Matrix = FEiVDynamicMatrix();
+		return;
+	}
+	EiVMatrixXd Full;
+	FEiVFFT::Convolve2D(Signal.Matrix, Kernel.Matrix, Full);
+	int64 StartRow, Rows, StartCol, Cols;
+	EiVConvolutionWindow(Signal.Matrix.rows(), Kernel.Matrix.rows(), Mode, StartRow, Rows);
+	EiVConvolutionWindow(Signal.Matrix.cols(), Kernel.Matrix.cols(), Mode, StartCol, Cols);
+	Matrix = FEiVDynamicMatrix(EiVMatrixXd(Full.block(StartRow, StartCol, Rows, Cols)));
+}
+
+void UEiVBPLibrary::EiVMatrixSVD(FEiVDynamicMatrix A, bool bThin, bool bComputeUV, EEiVBPFuncSuccess& Success, FEiVDynamicMatrix& U, FEiVDynamicMatrix& SingularValues, FEiVDynamicMatrix& V)
+{
+	static const FName Operation(TEXT("EiVSVD"));
+	FEiVCachedResult Result;
+	FEiVResultCache::FindOrCompute(Operation, { &A.Matrix }, { (double)bThin, (double)bComputeUV }, Result, [&](FEiVCachedResult& OutResult)
+	{
+		EiVMatrixXd OutU, OutV;
+		EiVVectorXd OutS;
+		OutResult.bSuccess = FEiVSVD::Compute(A.Matrix, bThin, bComputeUV, OutU, OutS, OutV);
+		OutResult.Matrices = { OutU, OutS, OutV };
+	});
+	if (Result.bSuccess) {
+		Success = EEiVBPFuncSuccess::SUCCESS;
+		U = FEiVDynamicMatrix(Result.Matrices[0]);
+		SingularValues = FEiVDynamicMatrix(Result.Matrices[1]);
+		V = FEiVDynamicMatrix(Result.Matrices[2]);
+	}
+	else {
+		Success = EEiVBPFuncSuccess::FAILURE;
+		U = FEiVDynamicMatrix();
+		SingularValues = FEiVDynamicMatrix();
+		V = FEiVDynamicMatrix();
+	}
+}
+
+void UEiVBPLibrary::EiVRandomizedSVD(FEiVDynamicMatrix A, int32 Rank, int32 Oversampling, int32 PowerIterations, int32 Seed, EEiVBPFuncSuccess& Success, FEiVDynamicMatrix& U, FEiVDynamicMatrix& SingularValues, FEiVDynamicMatrix& V)
+{
+	static const FName Operation(TEXT("EiVRandomizedSVD"));
+	FEiVCachedResult Result;
+	FEiVResultCache::FindOrCompute(Operation, { &A.Matrix }, { (double)Rank, (double)Oversampling, (double)PowerIterations, (double)Seed }, Result, [&](FEiVCachedResult& OutResult)
+	{
+		EiVMatrixXd OutU, OutV;
+		EiVVectorXd OutS;
+		OutResult.bSuccess = FEiVSVD::ComputeRandomized(A.Matrix, Rank, Oversampling, PowerIterations, Seed, OutU, OutS, OutV);
+		OutResult.Matrices = { OutU, OutS, OutV };
+	});
+	if (Result.bSuccess) {
+		Success = EEiVBPFuncSuccess::SUCCESS;
+		U = FEiVDynamicMatrix(Result.Matrices[0]);
+		SingularValues = FEiVDynamicMatrix(Result.Matrices[1]);
+		V = FEiVDynamicMatrix(Result.Matrices[2]);
+	}
+	else {
+		Success = EEiVBPFuncSuccess::FAILURE;
+		U = FEiVDynamicMatrix();
+		SingularValues = FEiVDynamicMatrix();
+		V = FEiVDynamicMatrix();
+	}
+}
+
+// FVector and FQuat are packed doubles (x y z and x y z w), which is the layout FEiVLieGroups works on
+static_assert(sizeof(FVector) == 3 * sizeof(double) && sizeof(FQuat) == 4 * sizeof(double), "FVector and FQuat must be packed doubles");
+
+void UEiVBPLibrary::EiVSO3Exp(TArray<FVector> RotationVectors, TArray<FQuat>& Rotations)
+{
+	Rotations.SetNumUninitialized(RotationVectors.Num());
+	FEiVLieGroups::SO3ExpBatch((const double*)RotationVectors.GetData(), (double*)Rotations.GetData(), RotationVectors.Num());
+}
+
+void UEiVBPLibrary::EiVSO3Log(TArray<FQuat> Rotations, TArray<FVector>& RotationVectors)
+{
+	RotationVectors.SetNumUninitialized(Rotations.Num());
+	FEiVLieGroups::SO3LogBatch((const double*)Rotations.GetData(), (double*)RotationVectors.GetData(), Rotations.Num());
+}
+
+void UEiVBPLibrary::EiVSE3Exp(TArray<FVector> Linear, TArray<FVector> Angular, TArray<FQuat>& Rotations, TArray<FVector>& Translations)
+{
+	if (Linear.Num() != Angular.Num()) {
+		Rotations.Empty();
+		Translations.Empty();
+		return;
+	}
+	Rotations.SetNumUninitialized(Linear.Num());
+	Translations.SetNumUninitialized(Linear.Num());
+	FEiVLieGroups::SE3ExpBatch((const double*)Linear.GetData(), (const double*)Angular.GetData(), (double*)Rotations.GetData(), (double*)Translations.GetData(), Linear.Num());
+}
+
+void UEiVBPLibrary::EiVSE3Log(TArray<FQuat> Rotations, TArray<FVector> Translations, TArray<FVector>& Linear, TArray<FVector>& Angular)
+{
+	if (Rotations.Num() != Translations.Num()) {
+		Linear.Empty();
+		Angular.Empty();
+		return;
+	}
+	Linear.SetNumUninitialized(Rotations.Num());
+	Angular.SetNumUninitialized(Rotations.Num());
+	FEiVLieGroups::SE3LogBatch((const double*)Rotations.GetData(), (const double*)Translations.GetData(), (double*)Linear.GetData(), (double*)Angular.GetData(), Rotations.Num());
+}
+
+void UEiVBPLibrary::EiVSE3Interpolate(TArray<FQuat> RotationsA, TArray<FVector> TranslationsA, TArray<FQuat> RotationsB, TArray<FVector> TranslationsB, double Alpha, TArray<FQuat>& Rotations, TArray<FVector>& Translations)
+{
+	const int32 Num = RotationsA.Num();
+	if (TranslationsA.Num() != Num || RotationsB.Num() != Num || TranslationsB.Num() != Num) {
+		Rotations.Empty();
+		Translations.Empty();
+		return;
+	}
+	Rotations.SetNumUninitialized(Num);
+	Translations.SetNumUninitialized(Num);
+	FEiVLieGroups::SE3InterpolateBatch((const double*)RotationsA.GetData(), (const double*)TranslationsA.GetData(), (const double*)RotationsB.GetData(), (const double*)TranslationsB.GetData(),
+		Alpha, (double*)Rotations.GetData(), (double*)Translations.GetData(), Num);
+}
+
+void UEiVBPLibrary::EiVSkinVertices(TArray<FTransform> Bones, TArray<FVector> Positions, TArray<FVector> Normals, TArray<int32> BoneIndices, TArray<double> Weights, int32 InfluencesPerVertex, bool bDualQuaternion, EEiVBPFuncSuccess& Success, TArray<FVector>& SkinnedPositions, TArray<FVector>& SkinnedNormals)
+{
+	const int32 NumVertices = Positions.Num();
+	const bool bNormals = Normals.Num() > 0;
+	Success = EEiVBPFuncSuccess::FAILURE;
+	SkinnedPositions.Empty();
+	SkinnedNormals.Empty();
+	if (InfluencesPerVertex <= 0 || (bNormals && Normals.Num() != NumVertices) || BoneIndices.Num() != (int64)NumVertices * InfluencesPerVertex || Weights.Num() != BoneIndices.Num()) {
+		return;
+	}
+	SkinnedPositions.SetNumUninitialized(NumVertices);
+	SkinnedNormals.SetNumUninitialized(bNormals ? NumVertices : 0);
+	TEiVSkinningStreams<double> Streams;
+	Streams.NumVertices = NumVertices;
+	Streams.InfluencesPerVertex = InfluencesPerVertex;
+	Streams.BoneIndices = BoneIndices.GetData();
+	Streams.Weights = Weights.GetData();
+	Streams.VertexInfluenceStride = InfluencesPerVertex;
+	Streams.InfluenceStride = 1;
+	for (int32 Axis = 0; Axis < 3; Axis++) {
+		Streams.Positions[Axis] = (const double*)Positions.GetData() + Axis;
+		Streams.OutPositions[Axis] = (double*)SkinnedPositions.GetData() + Axis;
+		if (bNormals) {
+			Streams.Normals[Axis] = (const double*)Normals.GetData() + Axis;
+			Streams.OutNormals[Axis] = (double*)SkinnedNormals.GetData() + Axis;
+		}
+	}
+	Streams.PositionStride = Streams.OutPositionStride = Streams.NormalStride = Streams.OutNormalStride = 3;
+	TArray<double> BoneData;
+	bool bSkinned;
+	if (bDualQuaternion) {
+		BoneData.SetNumUninitialized(8 * Bones.Num());
+		FEiVSkinning::BonesToDualQuaternions(Bones.GetData(), Bones.Num(), BoneData.GetData());
+		bSkinned = FEiVSkinning::SkinDualQuaternion(BoneData.GetData(), Bones.Num(), Streams);
+	}
+	else {
+		BoneData.SetNumUninitialized(12 * Bones.Num());
+		FEiVSkinning::BonesToMatrices(Bones.GetData(), Bones.Num(), BoneData.GetData());
+		bSkinned = FEiVSkinning::SkinLinearBlend(BoneData.GetData(), Bones.Num(), Streams);
+	}
+	if (!bSkinned) {
+		SkinnedPositions.Empty();
+		SkinnedNormals.Empty();
+		return;
+	}
+	Success = EEiVBPFuncSuccess::SUCCESS;
+}
+
+void UEiVBPLibrary::EiVKabsch(TArray<FVector> Source, TArray<FVector> Target, TArray<double> Weights, bool bScale, EEiVBPFuncSuccess& Success, FQuat& Rotation, FVector& Translation, double& Scale)
+{
+	Rotation = FQuat::Identity;
+	Translation = FVector::ZeroVector;
+	Scale = 1.0;
+	if (Source.Num() != Target.Num() || (Weights.Num() != 0 && Weights.Num() != Source.Num())) {
+		Success = EEiVBPFuncSuccess::FAILURE;
+		return;
+	}
+	const EiVMatrix3Xd SourcePoints = EiVMap<const EiVMatrix3Xd>((const double*)Source.GetData(), 3, Source.Num());
+	const EiVMatrix3Xd TargetPoints = EiVMap<const EiVMatrix3Xd>((const double*)Target.GetData(), 3, Target.Num());
+	const int32 Offsets[2] = { 0, Source.Num() };
+	EiVVector4d OutRotation;
+	EiVVector3d OutTranslation;
+	FEiVProcrustes::KabschBatch(SourcePoints, TargetPoints, Offsets, 1, Weights.Num() != 0 ? Weights.GetData() : nullptr, bScale, OutRotation.data(), OutTranslation.data(), &Scale);
+	Rotation = FQuat(OutRotation.x(), OutRotation.y(), OutRotation.z(), OutRotation.w());
+	Translation = FVector(OutTranslation.x(), OutTranslation.y(), OutTranslation.z());
+	Success = EEiVBPFuncSuccess::SUCCESS;
+}
+
+void UEiVBPLibrary::EiVPolarDecomposition(FEiVDynamicMatrix A, EEiVBPFuncSuccess& Success, FEiVDynamicMatrix& Rotation, FEiVDynamicMatrix& Stretch)
+{
+	if (A.Matrix.rows() != 3 || A.Matrix.cols() != 3) {
+		Success = EEiVBPFuncSuccess::FAILURE;
+		Rotation = FEiVDynamicMatrix();
+		Stretch = FEiVDynamicMatrix();
+		return;
+	}
+	EiVMatrix3d OutRotation, OutStretch;
+	FEiVProcrustes::PolarDecomposition<double>(A.Matrix, OutRotation, OutStretch);
+	Success = EEiVBPFuncSuccess::SUCCESS;
+	Rotation = FEiVDynamicMatrix(EiVMatrixXd(OutRotation));
+	Stretch = FEiVDynamicMatrix(EiVMatrixXd(OutStretch));
+}
+
+void UEiVBPLibrary::EiVMeshLaplacian(TArray<FVector> Vertices, TArray<int32> Indices, bool bCotangent, EEiVBPFuncSuccess& Success, FEiVSparseMatrix& Laplacian, FEiVDynamicMatrix& Mass)
+{
+	const EiVMatrix3Xd Positions = EiVMap<const EiVMatrix3Xd>((const double*)Vertices.GetData(), 3, Vertices.Num());
+	EiVSparseMatrix<double> OutLaplacian;
+	EiVVectorXd OutMass;
+	if (Indices.Num() % 3 != 0 || !FEiVMeshOperators::Laplacian(Positions, Indices.GetData(), Indices.Num() / 3, bCotangent, OutLaplacian)
+		|| !FEiVMeshOperators::MassMatrix(Positions, Indices.GetData(), Indices.Num() / 3, OutMass)) {
+		Success = EEiVBPFuncSuccess::FAILURE;
+		Laplacian = FEiVSparseMatrix();
+		Mass = FEiVDynamicMatrix();
+		return;
+	}
+	Success = EEiVBPFuncSuccess::SUCCESS;
+	Laplacian = FEiVSparseMatrix(OutLaplacian);
+	Mass = FEiVDynamicMatrix(OutMass, true);
+}
+
+void UEiVBPLibrary::EiVSmoothMeshVertices(TArray<FVector> Vertices, TArray<int32> Indices, bool bCotangent, double TimeStep, int32 Iterations, EEiVBPFuncSuccess& Success, TArray<FVector>& SmoothedVertices)
+{
+	const EiVMatrix3Xd Positions = EiVMap<const EiVMatrix3Xd>((const double*)Vertices.GetData(), 3, Vertices.Num());
+	TEiVMeshSmoother<double> Smoother;
+	EiVMatrix3Xd Smoothed;
+	if (Indices.Num() % 3 != 0 || !Smoother.Init(Positions, Indices.GetData(), Indices.Num() / 3, bCotangent, TimeStep) || !Smoother.Smooth(Positions, Smoothed, FMath::Max(Iterations, 1))) {
+		Success = EEiVBPFuncSuccess::FAILURE;
+		SmoothedVertices = Vertices;
+		return;
+	}
+	Success = EEiVBPFuncSuccess::SUCCESS;
+	SmoothedVertices.SetNumUninitialized(Vertices.Num());
+	EiVMap<EiVMatrix3Xd> Output((double*)SmoothedVertices.GetData(), 3, Vertices.Num());
+	Output = Smoothed;
+}
+
+// the spline nodes map FVector arrays as 3 x N matrices of doubles
+static_assert(sizeof(FVector) == 3 * sizeof(double), "FVector must be packed doubles");
+
+void UEiVBPLibrary::EiVCubicSplineTangents(TArray<FVector> Points, bool bClosed, TArray<FVector>& Tangents)
+{
+	EiVMatrix3Xd OutTangents;
+	FEiVSplineFitting::CubicTangents<double>(EiVMap<const EiVMatrix3Xd>((const double*)Points.GetData(), 3, Points.Num()), bClosed, OutTangents);
+	Tangents.SetNumUninitialized(Points.Num());
+	EiVMap<EiVMatrix3Xd>((double*)Tangents.GetData(), 3, Points.Num()) = OutTangents;
+}
+
+void UEiVBPLibrary::EiVFitBSpline(TArray<FVector> Points, int32 NumControlPoints, int32 Degree, double Smoothing, EEiVBPFuncSuccess& Success, TArray<FVector>& ControlPoints)
+{
+	EiVMatrix3Xd OutControlPoints;
+	if (!FEiVSplineFitting::FitBSpline<double>(EiVMap<const EiVMatrix3Xd>((const double*)Points.GetData(), 3, Points.Num()), NumControlPoints, Degree, Smoothing, OutControlPoints)) {
+		Success = EEiVBPFuncSuccess::FAILURE;
+		ControlPoints.Empty();
+		return;
+	}
+	Success = EEiVBPFuncSuccess::SUCCESS;
+	ControlPoints.SetNumUninitialized(NumControlPoints);
+	EiVMap<EiVMatrix3Xd>((double*)ControlPoints.GetData(), 3, NumControlPoints) = OutControlPoints;
+}
+
+void UEiVBPLibrary::EiVEvaluateBSpline(TArray<FVector> ControlPoints, int32 Degree, int32 NumPoints, EEiVBPFuncSuccess& Success, TArray<FVector>& Points)
+{
+	const int32 Count = FMath::Max(NumPoints, 0);
+	EiVMatrix3Xd OutPoints;
+	if (!FEiVSplineFitting::EvaluateBSpline<double>(EiVMap<const EiVMatrix3Xd>((const double*)ControlPoints.GetData(), 3, ControlPoints.Num()), Degree, EiVVectorXd::LinSpaced(Count, 0.0, 1.0), OutPoints)) {
+		Success = EEiVBPFuncSuccess::FAILURE;
+		Points.Empty();
+		return;
+	}
+	Success = EEiVBPFuncSuccess::SUCCESS;
+	Points.SetNumUninitialized(Count);
+	EiVMap<EiVMatrix3Xd>((double*)Points.GetData(), 3, Count) = OutPoints;
+}
+
+void UEiVBPLibrary::EiVSetDeterministicMath(bool bEnabled)
+{
+	FEiVDeterministic::SetGlobalEnabled(bEnabled);
+}
+
+void UEiVBPLibrary::EiVIsDeterministicMath(bool& bEnabled)
+{
+	bEnabled = FEiVDeterministic::IsGlobalEnabled();
+}
+
+void UEiVBPLibrary::EiVDeterministicMatrixMultiplication(FEiVDynamicMatrix A, FEiVDynamicMatrix B, FEiVDynamicMatrix& Matrix)
+{
+	EiVMatrixXd Product;
+	if (FEiVDeterministic::Multiply(A.Matrix, B.Matrix, Product)) {
+		Matrix = FEiVDynamicMatrix(Product);
+	}
+	else {
+		Matrix = FEiVDynamicMatrix();
+	}
+}
+
+void UEiVBPLibrary::EiVDeterministicDotProduct(FEiVDynamicMatrix A, FEiVDynamicMatrix B, double& DotProduct)
+{
+	double Dot = 0;
+	DotProduct = A.Matrix.cols() == B.Matrix.cols() && FEiVDeterministic::VectorDot(EiVVectorXd(A.Matrix.col(0)), EiVVectorXd(B.Matrix.col(0)), Dot) ? Dot : 0;
+}
+
+void UEiVBPLibrary::EiVDeterministicMatrixSum(FEiVDynamicMatrix A, double& Sum)
+{
+	Sum = FEiVDeterministic::MatrixSum(A.Matrix);
+}
+
+void UEiVBPLibrary::EiVDeterministicMatrixMean(FEiVDynamicMatrix A, double& Mean)
+{
+	Mean = FEiVDeterministic::MatrixMean(A.Matrix);
+}
+
+void UEiVBPLibrary::EiVDeterministicMatrixNorm(FEiVDynamicMatrix A, double& Norm)
+{
+	Norm = FEiVDeterministic::MatrixNorm(A.Matrix);
+}
+
+void UEiVBPLibrary::EiVSetResultCache(bool bEnabled, int32 MaxEntries, int32 MaxMegabytes)
+{
+	FEiVResultCache::SetLimits(MaxEntries, (int64)FMath::Max(MaxMegabytes, 0) << 20);
+	FEiVResultCache::SetEnabled(bEnabled);
+}
+
+void UEiVBPLibrary::EiVClearResultCache()
+{
+	FEiVResultCache::Clear();
+}
+
+void UEiVBPLibrary::EiVGetResultCacheStats(bool& bEnabled, int64& Hits, int64& Misses, int64& Evictions, int32& Entries, int64& Bytes)
+{
+	const FEiVResultCacheStats Stats = FEiVResultCache::GetStats();
+	bEnabled = FEiVResultCache::IsEnabled();
+	Hits = Stats.Hits;
+	Misses = Stats.Misses;
+	Evictions = Stats.Evictions;
+	Entries = Stats.Entries;
+	Bytes = Stats.Bytes;
+}
+
 // EiV Specific Functionality Below =======================================================
 
 void UEiVBPLibrary::EiVMakeDynamicComplexMatrix(TArray<FEiVComplexNumber> Array, int32 Rows, int32 Cols, FEiVDynamicComplexMatrix& Matrix)
@@ -463,43 +1272,46 @@ void UEiVBPLibrary::EiVMakeDynamicComplexMatrix(TArray<FEiVComplexNumber> Array,
 void UEiVBPLibrary::EiVDynamicComplexMatrixToArray(FEiVDynamicComplexMatrix Matrix, TArray<FEiVComplexNumber>& Array)
 {
 	Array = TArray< FEiVComplexNumber>();
+	Array.SetNum(Matrix.Matrix.size());
+	const int32 Cols = Matrix.Matrix.cols();
 	for (int i = 0; i < Matrix.Matrix.rows(); i++) {
-		for (int j = 0; j < Matrix.Matrix.cols(); j++) {
-			Array.Add(FEiVComplexNumber(Matrix.Matrix.coeff(i, j)));
+		for (int j = 0; j < Cols; j++) {
+			Array[j + i * Cols].Complex = Matrix.Matrix.coeff(i, j);
 		}
 	}
 }
 
 void UEiVBPLibrary::EiVStripReals(FEiVDynamicComplexMatrix Matrix, FEiVDynamicMatrix& ImaginaryMatrix)
 {
-	EiVMatrixXd Mat(Matrix.Matrix.rows(), Matrix.Matrix.cols());
-	for (int i = 0; i < Matrix.Matrix.rows(); i++) {
-		for (int j = 0; j < Matrix.Matrix.cols(); j++) {
-			Mat.coeffRef(i, j) = Matrix.Matrix.coeff(i, j).imag();
-		}
-	}
-	ImaginaryMatrix = FEiVDynamicMatrix(Mat);
+	ImaginaryMatrix = FEiVDynamicMatrix(EiVMatrixXd(Matrix.Matrix.imag()));
 }
 
 void UEiVBPLibrary::EiVStripImaginary(FEiVDynamicComplexMatrix Matrix, FEiVDynamicMatrix& RealMatrix)
 {
-	EiVMatrixXd Mat(Matrix.Matrix.rows(), Matrix.Matrix.cols());
-	for (int i = 0; i < Matrix.Matrix.rows(); i++) {
-		for (int j = 0; j < Matrix.Matrix.cols(); j++) {
-			Mat.coeffRef(i, j) = Matrix.Matrix.coeff(i, j).real();
-		}
+	RealMatrix = FEiVDynamicMatrix(EiVMatrixXd(Matrix.Matrix.real()));
+}
+
+void UEiVBPLibrary::EiVMergeRealAndImaginary(FEiVDynamicMatrix RealMatrix, FEiVDynamicMatrix ImaginaryMatrix, FEiVDynamicComplexMatrix& Matrix)
+{
+	if (ImaginaryMatrix.Matrix.size() == 0) {
+		Matrix = FEiVDynamicComplexMatrix(EiVMatrixXcd(RealMatrix.Matrix.cast<std::complex<double>>()));
+	}
+	else if (RealMatrix.Matrix.rows() == ImaginaryMatrix.Matrix.rows() && RealMatrix.Matrix.cols() == ImaginaryMatrix.Matrix.cols()) {
+		EiVMatrixXcd Mat(RealMatrix.Matrix.rows(), RealMatrix.Matrix.cols());
+		Mat.real() = RealMatrix.Matrix;
+		Mat.imag() = ImaginaryMatrix.Matrix;
+		Matrix = FEiVDynamicComplexMatrix(Mat);
+	}
+	else {
+		Matrix = FEiVDynamicComplexMatrix();
 	}
-	RealMatrix = FEiVDynamicMatrix(Mat);
 }
 
 void UEiVBPLibrary::EiVDynamicMatrixToArray(FEiVDynamicMatrix Matrix, TArray<double>& Array)
 {
 	Array = TArray<double>();
-	for (int i = 0; i < Matrix.Matrix.rows(); i++) {
-		for (int j = 0; j < Matrix.Matrix.cols(); j++) {
-			Array.Add(Matrix.Matrix.coeff(i, j));
-		}
-	}
+	Array.SetNumUninitialized(Matrix.Matrix.size());
+	Eigen::Map<EiVRowMajorMatrixXd>(Array.GetData(), Matrix.Matrix.rows(), Matrix.Matrix.cols()) = Matrix.Matrix;
 }
 
 void UEiVBPLibrary::EiVMakeDynamicMatrix(TArray<double> Array, int32 Rows, int32 Cols, FEiVDynamicMatrix& Matrix)
@@ -507,6 +1319,26 @@ void UEiVBPLibrary::EiVMakeDynamicMatrix(TArray<double> Array, int32 Rows, int32
 	Matrix = FEiVDynamicMatrix(Array, Rows, Cols);
 }
 
+void UEiVBPLibrary::EiVMakeRowMajorDynamicMatrix(TArray<double> Array, int32 Rows, int32 Cols, FEiVRowMajorDynamicMatrix& Matrix)
+{
+	Matrix = FEiVRowMajorDynamicMatrix(Array, Rows, Cols);
+}
+
+void UEiVBPLibrary::EiVRowMajorDynamicMatrixToArray(FEiVRowMajorDynamicMatrix Matrix, TArray<double>& Array)
+{
+	Array = FEiVHelper::TArrayFromRowMajorMatrix(Matrix.Matrix);
+}
+
+FEiVDynamicMatrix UEiVBPLibrary::EiVConvRowMajorDynamicMatrixToDynamicMatrix(const FEiVRowMajorDynamicMatrix& Matrix)
+{
+	return FEiVDynamicMatrix(EiVMatrixXd(Matrix.Matrix));
+}
+
+FEiVRowMajorDynamicMatrix UEiVBPLibrary::EiVConvDynamicMatrixToRowMajorDynamicMatrix(const FEiVDynamicMatrix& Matrix)
+{
+	return FEiVRowMajorDynamicMatrix(Matrix);
+}
+
 void UEiVBPLibrary::EiVMakeDynamicVector(TArray<double> Array, int32 Rows, FEiVDynamicMatrix& Matrix, FEiVDynamicVector& Vector)
 {
 	Matrix = FEiVDynamicMatrix(FEiVDynamicVector(Array,Rows).Vector);
@@ -515,13 +1347,90 @@ void UEiVBPLibrary::EiVMakeDynamicVector(TArray<double> Array, int32 Rows, FEiVD
 
 void UEiVBPLibrary::EiVMakeRandomDynamicMatrix(int32 Rows, int32 Cols, FEiVDynamicMatrix& Matrix)
 {
-	Matrix = FEiVDynamicMatrix(EiVMatrixXd::Random(Rows, Cols));
+	EiVMatrixXd Random(FMath::Max(Rows, 0), FMath::Max(Cols, 0));
+	FEiVRandom::FillUniform<double>(FEiVRandom::GlobalKey, FEiVRandom::ReserveGlobalCounters(FEiVRandom::GetNumCounters<double>(Random.size())), -1.0, 1.0, Random.data(), Random.size());
+	Matrix = FEiVDynamicMatrix(Random);
 }
 
 void UEiVBPLibrary::EiVMakeRandomDynamicVector(int32 Cols, FEiVDynamicMatrix& Matrix, FEiVDynamicVector& Vector)
 {
-	Matrix = FEiVDynamicMatrix(FEiVDynamicVector(Cols).Vector);
 	Vector = FEiVDynamicVector(Cols);
+	Matrix = FEiVDynamicMatrix(Vector.Vector, true);
+}
+
+void UEiVBPLibrary::EiVMakeRandomDynamicMatrixFromStream(const FRandomStream& Stream, int32 Rows, int32 Cols, double Min, double Max, FEiVDynamicMatrix& Matrix)
+{
+	EiVMatrixXd Random(FMath::Max(Rows, 0), FMath::Max(Cols, 0));
+	FEiVRandom::FillUniform<double>(FEiVRandom::MakeKey(Stream), 0, Min, Max, Random.data(), Random.size());
+	Matrix = FEiVDynamicMatrix(Random);
+}
+
+void UEiVBPLibrary::EiVMakeRandomDynamicVectorFromStream(const FRandomStream& Stream, int32 Rows, double Min, double Max, FEiVDynamicMatrix& Matrix, FEiVDynamicVector& Vector)
+{
+	EiVVectorXd Random(FMath::Max(Rows, 0));
+	FEiVRandom::FillUniform<double>(FEiVRandom::MakeKey(Stream), 0, Min, Max, Random.data(), Random.size());
+	Matrix = FEiVDynamicMatrix(Random, true);
+	Vector = FEiVDynamicVector(TArray<double>(Random.data(), (int32)Random.size()), (int32)Random.size());
+}
+
+void UEiVBPLibrary::EiVMakeNormalRandomDynamicMatrixFromStream(const FRandomStream& Stream, int32 Rows, int32 Cols, double Mean, double StandardDeviation, FEiVDynamicMatrix& Matrix)
+{
+	EiVMatrixXd Random(FMath::Max(Rows, 0), FMath::Max(Cols, 0));
+	FEiVRandom::FillNormal<double>(FEiVRandom::MakeKey(Stream), 0, Mean, StandardDeviation, Random.data(), Random.size());
+	Matrix = FEiVDynamicMatrix(Random);
+}
+
+void UEiVBPLibrary::EiVSampleMultivariateNormalFromStream(const FRandomStream& Stream, FEiVDynamicVector Mean, FEiVDynamicMatrix Covariance, int32 NumSamples, EEiVBPFuncSuccess& Success, FEiVDynamicMatrix& Samples)
+{
+	static const FName Operation(TEXT("EiVCholesky"));
+	FEiVCachedResult Result;
+	FEiVResultCache::FindOrCompute(Operation, { &Covariance.Matrix }, {}, Result, [&Covariance](FEiVCachedResult& OutResult)
+	{
+		OutResult.bSuccess = Covariance.Matrix.rows() == Covariance.Matrix.cols() && Covariance.Matrix.size() > 0;
+		if (!OutResult.bSuccess) {
+			return;
+		}
+		const EiVLLT<EiVMatrixXd> LLT(Covariance.Matrix);
+		OutResult.bSuccess = LLT.info() == EiVComputationInfo::Success;
+		if (OutResult.bSuccess) {
+			OutResult.Matrices.Add(LLT.matrixL());
+		}
+	});
+	TEiVMultivariateNormal<double> Distribution;
+	EiVMatrixXd Random;
+	if (!Result.bSuccess || !Distribution.SetCholeskyFactor(Mean.Vector, Result.Matrices[0]) || !Distribution.Sample(FEiVRandom::MakeKey(Stream), 0, NumSamples, Random)) {
+		Success = EEiVBPFuncSuccess::FAILURE;
+		Samples = FEiVDynamicMatrix();
+		return;
+	}
+	Success = EEiVBPFuncSuccess::SUCCESS;
+	Samples = FEiVDynamicMatrix(Random);
+}
+
+void UEiVBPLibrary::EiVMakeMultivariateNormal(FEiVDynamicVector Mean, FEiVDynamicMatrix Covariance, EEiVBPFuncSuccess& Success, FEiVMultivariateNormal& Distribution)
+{
+	const TSharedPtr<TEiVMultivariateNormal<double>> Made = MakeShared<TEiVMultivariateNormal<double>>();
+	if (Made->SetDistribution(Mean.Vector, Covariance.Matrix)) {
+		Success = EEiVBPFuncSuccess::SUCCESS;
+		Distribution = FEiVMultivariateNormal(Made);
+	}
+	else {
+		Success = EEiVBPFuncSuccess::FAILURE;
+		Distribution = FEiVMultivariateNormal();
+	}
+}
+
+void UEiVBPLibrary::EiVSampleMultivariateNormalDistributionFromStream(const FRandomStream& Stream, FEiVMultivariateNormal Distribution, int32 NumSamples, EEiVBPFuncSuccess& Success, FEiVDynamicMatrix& Samples)
+{
+	EiVMatrixXd Random;
+	if (Distribution.Distribution.IsValid() && Distribution.Distribution->Sample(FEiVRandom::MakeKey(Stream), 0, NumSamples, Random)) {
+		Success = EEiVBPFuncSuccess::SUCCESS;
+		Samples = FEiVDynamicMatrix(Random);
+	}
+	else {
+		Success = EEiVBPFuncSuccess::FAILURE;
+		Samples = FEiVDynamicMatrix();
+	}
 }
 
 void UEiVBPLibrary::EiVSetEigenThreads(int32 Threads)
@@ -622,6 +1531,17 @@ void UEiVBPLibrary::EiVEigenMatrixToDynamicMatrix(FEiVMatrix Matrix, FEiVDynamic
 	OutDynamicMatrix = FEiVDynamicMatrix(Matrix.Matrix);
 }
 
+void UEiVBPLibrary::EiVMatrixToRowMajorDynamicMatrix(FMatrix Matrix, FEiVRowMajorDynamicMatrix RowMajorMatrix, FMatrix& OutMatrix, FEiVRowMajorDynamicMatrix& OutRowMajorMatrix)
+{
+	if (RowMajorMatrix.Matrix.rows() == 4 && RowMajorMatrix.Matrix.cols() == 4) {
+		OutMatrix = FEiVHelper::FMatrixFromRowMajorMatrix<double>(RowMajorMatrix.Matrix);
+	}
+	else {
+		OutMatrix = FMatrix::Identity;
+	}
+	OutRowMajorMatrix = FEiVRowMajorDynamicMatrix(EiVRowMajorMatrixXd(FEiVHelper::FMatrixToRowMajorMatrix(Matrix)));
+}
+
 void UEiVBPLibrary::EiVVector2DToJacobiRotation(FVector2D Vector, FEiVJacobiRotation JacobiRotation, FVector2D& OutVector, FEiVJacobiRotation& OutJacobiRotation)
 {
 	OutVector = FEiVHelper::Vector2DFromJacobiRotation(JacobiRotation.Rotation);
@@ -666,6 +1586,12 @@ void UEiVBPLibrary::EiVArrayToSparseMatrix(TArray<double> Array, int32 Rows, int
 	OutSparseMatrix = FEiVSparseMatrix(Array,Rows,Cols);
 }
 
+void UEiVBPLibrary::EiVSparseMatrixToRowMajor(FEiVSparseMatrix SparseMatrix, FEiVRowMajorSparseMatrix RowMajorSparseMatrix, FEiVSparseMatrix& OutSparseMatrix, FEiVRowMajorSparseMatrix& OutRowMajorSparseMatrix)
+{
+	OutSparseMatrix = FEiVSparseMatrix(FEiVSparseKernels::ToColumnMajor(RowMajorSparseMatrix.Matrix));
+	OutRowMajorSparseMatrix = FEiVRowMajorSparseMatrix(FEiVSparseKernels::ToRowMajor(SparseMatrix.Matrix));
+}
+
 void UEiVBPLibrary::EiVQuatToQuaternion(FQuat Quat, FEiVQuaternion Quaternion, FQuat& OutQuat, FEiVQuaternion& OutQuaternion)
 {
 	OutQuat = FEiVHelper::QuatFromQuaternion(Quaternion.Quat);
@@ -0,0 +1,67 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#include "EiVKalmanFilterComponent.h"
+
+UEiVKalmanFilterComponent::UEiVKalmanFilterComponent()
+: Filter(0, 0)
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UEiVKalmanFilterComponent::SetModel(FEiVDynamicMatrix Transition, FEiVDynamicMatrix ProcessNoise, FEiVDynamicMatrix Observation, FEiVDynamicMatrix MeasurementNoise, EEiVBPFuncSuccess& Success)
+{
+	const int64 StateSize = Transition.Matrix.rows();
+	const int64 MeasurementSize = Observation.Matrix.rows();
+	if (StateSize == 0 || MeasurementSize == 0 || Transition.Matrix.cols() != StateSize
+		|| ProcessNoise.Matrix.rows() != StateSize || ProcessNoise.Matrix.cols() != StateSize || Observation.Matrix.cols() != StateSize
+		|| MeasurementNoise.Matrix.rows() != MeasurementSize || MeasurementNoise.Matrix.cols() != MeasurementSize) {
+		Success = EEiVBPFuncSuccess::FAILURE;
+		return;
+	}
+	Filter.Resize((int32)StateSize, (int32)MeasurementSize);
+	Filter.Transition = Transition.Matrix;
+	Filter.ProcessNoise = ProcessNoise.Matrix;
+	Filter.Observation = Observation.Matrix;
+	Filter.MeasurementNoise = MeasurementNoise.Matrix;
+	MeasurementBuffer.resize(MeasurementSize);
+	Success = EEiVBPFuncSuccess::SUCCESS;
+}
+
+void UEiVKalmanFilterComponent::SetState(FEiVDynamicMatrix State, FEiVDynamicMatrix Covariance, EEiVBPFuncSuccess& Success)
+{
+	const int64 StateSize = Filter.State.size();
+	if (StateSize == 0 || State.Matrix.rows() != StateSize || State.Matrix.cols() != 1 || Covariance.Matrix.rows() != StateSize || Covariance.Matrix.cols() != StateSize) {
+		Success = EEiVBPFuncSuccess::FAILURE;
+		return;
+	}
+	Filter.State = State.Matrix.col(0);
+	Filter.Covariance = Covariance.Matrix;
+	Success = EEiVBPFuncSuccess::SUCCESS;
+}
+
+void UEiVKalmanFilterComponent::Predict()
+{
+	Filter.Predict();
+}
+
+void UEiVKalmanFilterComponent::Update(FEiVDynamicMatrix Measurement, EEiVBPFuncSuccess& Success)
+{
+	if (MeasurementBuffer.size() == 0 || Measurement.Matrix.rows() != MeasurementBuffer.size() || Measurement.Matrix.cols() != 1) {
+		Success = EEiVBPFuncSuccess::FAILURE;
+		return;
+	}
+	MeasurementBuffer = Measurement.Matrix.col(0);
+	Success = Filter.Update(MeasurementBuffer) ? EEiVBPFuncSuccess::SUCCESS : EEiVBPFuncSuccess::FAILURE;
+}
+
+void UEiVKalmanFilterComponent::GetState(FEiVDynamicMatrix& State, FEiVDynamicMatrix& Covariance) const
+{
+	State = FEiVDynamicMatrix(Filter.State, true);
+	Covariance = FEiVDynamicMatrix(Filter.Covariance);
+}
@@ -3,6 +3,27 @@
 /* Licensed under MIT license. See LICENSE for full license text.
 *
 *        Created: 20th March 2025
-*  Last Modified: 6th April 2025
+*  Last Modified: 19th October 2026
 */
-#include "EiVLibrary.h"
\ No newline at end of file
+
+//<><><><><><><><><><><><> EiVLibrary Import Block <><><><><><><><><><><><>
+//imports the specified headers by the macro definitions
+
+#define EIV_INCLUDE_DENSE_MATRIX_ARRAY    //includes most core and basic features
+#define EIV_INCLUDE_SPARSE_LINEAR_ALGEBRA //includes sparse linear algebra utilities
+#define EIV_INCLUDE_GEOMETRY              //includes geometric utilities
+#define EIV_UNDEFINE_INCLUDES             //ensures that these include macros above are local to this file
+
+#include "EiVLibrary.h"   //takes the EIV_INCLUDE macros as settings and retrieves
+                          //the specified Eigen modules, typedefs, and helper functions
+//<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>
+
+// The one copy of the common FEiVHelper instantiations, see the extern template declarations in EiVLibrary.h.
+// EIV_MODULE_BUILD makes every file of this module include every Eigen module, so all three lists exist here
+// even when another file of a unity build included EiVLibrary.h first
+EIV_HELPER_CORE_INSTANTIATIONS(, double)
+EIV_HELPER_CORE_INSTANTIATIONS(, float)
+EIV_HELPER_SPARSECORE_INSTANTIATIONS(, double)
+EIV_HELPER_SPARSECORE_INSTANTIATIONS(, float)
+EIV_HELPER_GEOMETRY_INSTANTIATIONS(, double)
+EIV_HELPER_GEOMETRY_INSTANTIATIONS(, float)
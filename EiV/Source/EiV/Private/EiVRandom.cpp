@@ -0,0 +1,20 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#include "EiVRandom.h"
+#include <atomic>
+
+namespace EiVRandomPrivate
+{
+	static std::atomic<uint64> NextGlobalCounter(0);
+}
+
+uint64 FEiVRandom::ReserveGlobalCounters(uint64 NumCounters)
+{
+	return EiVRandomPrivate::NextGlobalCounter.fetch_add(NumCounters, std::memory_order_relaxed);
+}
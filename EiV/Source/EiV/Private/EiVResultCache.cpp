@@ -0,0 +1,219 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#include "EiVResultCache.h"
+#include "Containers/List.h"
+#include "Hash/CityHash.h"
+#include "Stats/Stats.h"
+#include <atomic>
+
+DECLARE_STATS_GROUP(TEXT("EiV"), STATGROUP_EiV, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Result Cache Hits"), STAT_EiVResultCacheHits, STATGROUP_EiV);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Result Cache Misses"), STAT_EiVResultCacheMisses, STATGROUP_EiV);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Result Cache Entries"), STAT_EiVResultCacheEntries, STATGROUP_EiV);
+DECLARE_MEMORY_STAT(TEXT("Result Cache Memory"), STAT_EiVResultCacheMemory, STATGROUP_EiV);
+
+namespace EiVResultCachePrivate
+{
+	struct FEntry
+	{
+		FName Operation;
+		TArray<EiVMatrixXd> Inputs;
+		TArray<double> Parameters;
+		FEiVCachedResult Result;
+		int64 Bytes = 0;
+		// the node of the entry in UseOrder
+		TDoubleLinkedList<uint64>::TDoubleLinkedListNode* UseNode = nullptr;
+	};
+
+	static std::atomic<bool> bEnabled(false);
+	// guards everything below
+	static FCriticalSection Lock;
+	static TMap<uint64, FEntry> Entries;
+	// the hashes of the entries, the most recently used at the head, so finding and evicting are O(1)
+	static TDoubleLinkedList<uint64> UseOrder;
+	static int32 MaxEntries = 256;
+	static int64 MaxBytes = 64 << 20;
+	static FEiVResultCacheStats Totals;
+
+	// the bytes hashed at once, so very large matrices never overflow the 32 bit length of CityHash
+	static constexpr int64 HashBlockBytes = 1 << 20;
+
+	static int64 GetBytes(const FEntry& Entry)
+	{
+		int64 Bytes = sizeof(FEntry) + Entry.Parameters.Num() * sizeof(double) + Entry.Result.Scalars.Num() * sizeof(double);
+		for (const EiVMatrixXd& Input : Entry.Inputs) {
+			Bytes += Input.size() * sizeof(double);
+		}
+		for (const EiVMatrixXd& Matrix : Entry.Result.Matrices) {
+			Bytes += Matrix.size() * sizeof(double);
+		}
+		for (const EiVMatrixXcd& Matrix : Entry.Result.ComplexMatrices) {
+			Bytes += Matrix.size() * sizeof(std::complex<double>);
+		}
+		return Bytes;
+	}
+
+	static bool SameKey(const FEntry& Entry, FName Operation, TConstArrayView<const EiVMatrixXd*> Inputs, TConstArrayView<double> Parameters)
+	{
+		if (Entry.Operation != Operation || Entry.Inputs.Num() != Inputs.Num() || Entry.Parameters.Num() != Parameters.Num()) {
+			return false;
+		}
+		// bitwise, so -0 and 0 or two NaNs with different payloads are different keys, like they may be different results
+		if (Parameters.Num() > 0 && FMemory::Memcmp(Entry.Parameters.GetData(), Parameters.GetData(), Parameters.Num() * sizeof(double)) != 0) {
+			return false;
+		}
+		for (int32 Input = 0; Input < Inputs.Num(); Input++) {
+			const EiVMatrixXd& Stored = Entry.Inputs[Input];
+			const EiVMatrixXd& New = *Inputs[Input];
+			if (Stored.rows() != New.rows() || Stored.cols() != New.cols()) {
+				return false;
+			}
+			if (Stored.size() > 0 && FMemory::Memcmp(Stored.data(), New.data(), Stored.size() * sizeof(double)) != 0) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// moves an entry to the head of UseOrder, the lock must be held
+	static void Touch(uint64 Hash, FEntry& Entry)
+	{
+		if (Entry.UseNode != UseOrder.GetHead()) {
+			UseOrder.RemoveNode(Entry.UseNode);
+			UseOrder.AddHead(Hash);
+			Entry.UseNode = UseOrder.GetHead();
+		}
+	}
+
+	// removes the least recently used entries until the limits are kept, the lock must be held
+	static void Evict()
+	{
+		while (Entries.Num() > MaxEntries || (Entries.Num() > 0 && Totals.Bytes > MaxBytes)) {
+			TDoubleLinkedList<uint64>::TDoubleLinkedListNode* Oldest = UseOrder.GetTail();
+			Totals.Bytes -= Entries.FindChecked(Oldest->GetValue()).Bytes;
+			Entries.Remove(Oldest->GetValue());
+			UseOrder.RemoveNode(Oldest);
+			Totals.Evictions++;
+		}
+		Totals.Entries = Entries.Num();
+		SET_DWORD_STAT(STAT_EiVResultCacheEntries, Totals.Entries);
+		SET_MEMORY_STAT(STAT_EiVResultCacheMemory, Totals.Bytes);
+	}
+}
+
+void FEiVResultCache::SetEnabled(bool bEnabled)
+{
+	EiVResultCachePrivate::bEnabled.store(bEnabled, std::memory_order_relaxed);
+	if (!bEnabled) {
+		FEiVResultCache::Clear();
+	}
+}
+
+bool FEiVResultCache::IsEnabled()
+{
+	return EiVResultCachePrivate::bEnabled.load(std::memory_order_relaxed);
+}
+
+void FEiVResultCache::SetLimits(int32 MaxEntries, int64 MaxBytes)
+{
+	using namespace EiVResultCachePrivate;
+	FScopeLock ScopeLock(&Lock);
+	EiVResultCachePrivate::MaxEntries = FMath::Max(MaxEntries, 1);
+	EiVResultCachePrivate::MaxBytes = FMath::Max<int64>(MaxBytes, 0);
+	Evict();
+}
+
+void FEiVResultCache::Clear()
+{
+	using namespace EiVResultCachePrivate;
+	FScopeLock ScopeLock(&Lock);
+	Entries.Empty();
+	UseOrder.Empty();
+	Totals = FEiVResultCacheStats();
+	SET_DWORD_STAT(STAT_EiVResultCacheEntries, 0);
+	SET_MEMORY_STAT(STAT_EiVResultCacheMemory, 0);
+}
+
+FEiVResultCacheStats FEiVResultCache::GetStats()
+{
+	using namespace EiVResultCachePrivate;
+	FScopeLock ScopeLock(&Lock);
+	return Totals;
+}
+
+uint64 FEiVResultCache::HashMatrix(const EiVMatrixXd& Matrix, uint64 Seed)
+{
+	const int64 Sizes[2] = { (int64)Matrix.rows(), (int64)Matrix.cols() };
+	uint64 Hash = CityHash64WithSeed((const char*)Sizes, sizeof(Sizes), Seed);
+	const char* Data = (const char*)Matrix.data();
+	const int64 Bytes = (int64)Matrix.size() * sizeof(double);
+	for (int64 First = 0; First < Bytes; First += EiVResultCachePrivate::HashBlockBytes) {
+		Hash = CityHash64WithSeed(Data + First, (uint32)FMath::Min<int64>(Bytes - First, EiVResultCachePrivate::HashBlockBytes), Hash);
+	}
+	return Hash;
+}
+
+uint64 FEiVResultCache::HashKey(FName Operation, TConstArrayView<const EiVMatrixXd*> Inputs, TConstArrayView<double> Parameters)
+{
+	const uint32 OperationHash = GetTypeHash(Operation);
+	uint64 Hash = CityHash64((const char*)&OperationHash, sizeof(OperationHash));
+	if (Parameters.Num() > 0) {
+		Hash = CityHash64WithSeed((const char*)Parameters.GetData(), (uint32)(Parameters.Num() * sizeof(double)), Hash);
+	}
+	for (const EiVMatrixXd* Input : Inputs) {
+		Hash = FEiVResultCache::HashMatrix(*Input, Hash);
+	}
+	return Hash;
+}
+
+bool FEiVResultCache::Find(uint64 Hash, FName Operation, TConstArrayView<const EiVMatrixXd*> Inputs, TConstArrayView<double> Parameters, FEiVCachedResult& OutResult)
+{
+	using namespace EiVResultCachePrivate;
+	FScopeLock ScopeLock(&Lock);
+	FEntry* Entry = Entries.Find(Hash);
+	if (Entry == nullptr || !SameKey(*Entry, Operation, Inputs, Parameters)) {
+		Totals.Misses++;
+		INC_DWORD_STAT(STAT_EiVResultCacheMisses);
+		return false;
+	}
+	Touch(Hash, *Entry);
+	OutResult = Entry->Result;
+	Totals.Hits++;
+	INC_DWORD_STAT(STAT_EiVResultCacheHits);
+	return true;
+}
+
+void FEiVResultCache::Add(uint64 Hash, FName Operation, TConstArrayView<const EiVMatrixXd*> Inputs, TConstArrayView<double> Parameters, const FEiVCachedResult& Result)
+{
+	using namespace EiVResultCachePrivate;
+	FEntry NewEntry;
+	NewEntry.Operation = Operation;
+	NewEntry.Parameters = TArray<double>(Parameters.GetData(), Parameters.Num());
+	NewEntry.Inputs.Reserve(Inputs.Num());
+	for (const EiVMatrixXd* Input : Inputs) {
+		NewEntry.Inputs.Add(*Input);
+	}
+	NewEntry.Result = Result;
+	NewEntry.Bytes = GetBytes(NewEntry);
+
+	FScopeLock ScopeLock(&Lock);
+	if (!FEiVResultCache::IsEnabled() || NewEntry.Bytes > MaxBytes) {
+		return;
+	}
+	// a colliding or concurrently added entry with the same hash is replaced
+	if (const FEntry* Existing = Entries.Find(Hash)) {
+		Totals.Bytes -= Existing->Bytes;
+		UseOrder.RemoveNode(Existing->UseNode);
+	}
+	UseOrder.AddHead(Hash);
+	NewEntry.UseNode = UseOrder.GetHead();
+	Totals.Bytes += NewEntry.Bytes;
+	Entries.Add(Hash, MoveTemp(NewEntry));
+	Evict();
+}
@@ -3,7 +3,7 @@
 /* Licensed under MIT license. See LICENSE for full license text.
 *
 *        Created: 20th March 2025
-*  Last Modified: 17th June 2025
+*  Last Modified: 19th October 2026
 */
 
 #pragma once
@@ -20,6 +20,8 @@
 #include "EiVLibrary.h"   //takes the EIV_INCLUDE macros as settings and retrieves 
                           //the specified Eigen modules, typedefs, and helper functions
 //<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>
+#include "EiVFwd.h"
+#include "EiVRandom.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "EiVBPLibrary.generated.h"
 
@@ -297,6 +299,28 @@ public:
 	FEiVSparseMatrix(TArray<double> InMatrix, int32 Rows, int32 Cols) {
 		Matrix = FEiVHelper::TArrayToSparseMatrix(InMatrix, Rows, Cols);
 	}
+	FEiVSparseMatrix(EiVSparseMatrix<double> InMatrix) {
+		Matrix = InMatrix;
+	}
+};
+
+USTRUCT(BlueprintType)
+struct FEiVRowMajorSparseMatrix
+{
+	GENERATED_BODY()
+public:
+	EiVRowMajorSparseMatrix<double> Matrix;
+	FEiVRowMajorSparseMatrix() {
+		Matrix = EiVRowMajorSparseMatrix<double>();
+	}
+	FEiVRowMajorSparseMatrix(EiVSparseMatrix<double> InMatrix) {
+		Matrix = InMatrix;
+		Matrix.makeCompressed();
+	}
+	FEiVRowMajorSparseMatrix(EiVRowMajorSparseMatrix<double> InMatrix) {
+		Matrix = InMatrix;
+		Matrix.makeCompressed();
+	}
 };
 
 USTRUCT(BlueprintType)
@@ -315,6 +339,11 @@ public:
 		Matrix = InMatrix;
 	}
 	FEiVDynamicMatrix(TArray<double> InMatrix, int32 Rows, int32 Cols) {
+		if (InMatrix.Num() >= Rows * Cols) {
+			//the array is row-major, so map it as such and let Eigen do the transposing copy
+			Matrix = Eigen::Map<const EiVRowMajorMatrixXd>(InMatrix.GetData(), Rows, Cols);
+			return;
+		}
 		EiVMatrixXd Mtx(Rows, Cols);
 		for (int row = 0; row < Rows; row++) {
 			for (int col = 0; col < Cols && (col + row * Cols) < InMatrix.Num(); col++) {
@@ -325,6 +354,26 @@ public:
 	}
 };
 
+USTRUCT(BlueprintType)
+struct FEiVRowMajorDynamicMatrix
+{
+	GENERATED_BODY()
+public:
+	EiVRowMajorMatrixXd Matrix;
+	FEiVRowMajorDynamicMatrix() {
+		Matrix = EiVRowMajorMatrixXd();
+	}
+	FEiVRowMajorDynamicMatrix(EiVRowMajorMatrixXd InMatrix) {
+		Matrix = InMatrix;
+	}
+	FEiVRowMajorDynamicMatrix(const FEiVDynamicMatrix& InMatrix) {
+		Matrix = InMatrix.Matrix;
+	}
+	FEiVRowMajorDynamicMatrix(TArray<double> InMatrix, int32 Rows, int32 Cols) {
+		Matrix = FEiVHelper::TArrayToRowMajorMatrix(InMatrix, Rows, Cols);
+	}
+};
+
 USTRUCT(BlueprintType)
 struct FEiVDynamicComplexMatrix
 {
@@ -361,7 +410,8 @@ public:
 		Vector = EiVMatrixXd();
 	}
 	FEiVDynamicVector(int32 Rows) {
-		Vector = EiVVectorXd::Random(Rows);
+		Vector.resize(FMath::Max(Rows, 0));
+		FEiVRandom::FillUniform<double>(FEiVRandom::GlobalKey, FEiVRandom::ReserveGlobalCounters(FEiVRandom::GetNumCounters<double>(Vector.size())), -1.0, 1.0, Vector.data(), Vector.size());
 	}
 	FEiVDynamicVector(TArray<double> InVector, int32 Rows) {
 		EiVVectorXd Vec(Rows);
@@ -379,9 +429,105 @@ enum class EEiVBPFuncSuccess : uint8
 	FAILURE
 };
 
+UENUM(BlueprintType)
+enum class EEiVIterativeSolverType : uint8
+{
+	CONJUGATE_GRADIENT UMETA(DisplayName = "Conjugate Gradient"),                            //symmetric positive definite matrices
+	BICGSTAB UMETA(DisplayName = "BiCGSTAB"),                                                //general square matrices
+	LEAST_SQUARES_CONJUGATE_GRADIENT UMETA(DisplayName = "Least Squares Conjugate Gradient") //rectangular matrices
+};
+
+UENUM(BlueprintType)
+enum class EEiVIterativePreconditioner : uint8
+{
+	DIAGONAL UMETA(DisplayName = "Diagonal"),                                   //cheap, rebuilt on every matrix change
+	INCOMPLETE_FACTORIZATION UMETA(DisplayName = "Incomplete Factorization"),   //incomplete Cholesky for CG, incomplete LUT for BiCGSTAB
+	IDENTITY UMETA(DisplayName = "Identity")                                    //no preconditioning
+};
+
+USTRUCT(BlueprintType)
+struct FEiVIterativeSolver
+{
+	GENERATED_BODY()
+public:
+	//shared, so copies of this struct in Blueprint refer to the same solver
+	TSharedPtr<IEiVIterativeSolver<double>> Solver;
+	FEiVIterativeSolver() {
+		Solver = nullptr;
+	}
+	FEiVIterativeSolver(TSharedPtr<IEiVIterativeSolver<double>> InSolver) {
+		Solver = InSolver;
+	}
+};
+
+UENUM(BlueprintType)
+enum class EEiVSparseDirectSolverType : uint8
+{
+	SIMPLICIAL_LDLT UMETA(DisplayName = "Simplicial LDLT"), //symmetric semi-definite matrices
+	SIMPLICIAL_LLT UMETA(DisplayName = "Simplicial LLT"),   //symmetric positive definite matrices
+	SPARSE_LU UMETA(DisplayName = "Sparse LU")              //general square matrices
+};
+
+UENUM(BlueprintType)
+enum class EEiVSparseOrdering : uint8
+{
+	AMD UMETA(DisplayName = "AMD"),         //approximate minimum degree, best for symmetric matrices
+	COLAMD UMETA(DisplayName = "COLAMD"),   //column approximate minimum degree, best for LU
+	NATURAL UMETA(DisplayName = "Natural")  //no reordering
+};
+
+UENUM(BlueprintType)
+enum class EEiVTextMatrixFormat : uint8
+{
+	CSV UMETA(DisplayName = "CSV"),                    //comma separated values, one row per line
+	TSV UMETA(DisplayName = "TSV"),                    //tab separated values, one row per line
+	MATRIX_MARKET UMETA(DisplayName = "Matrix Market") //.mtx files, coordinate or array format
+};
+
+UENUM(BlueprintType)
+enum class EEiVConvolutionMode : uint8
+{
+	FULL UMETA(DisplayName = "Full"),   //every overlap, signal + kernel - 1 values per dimension
+	SAME UMETA(DisplayName = "Same"),   //the size of the signal, centered on the full convolution
+	VALID UMETA(DisplayName = "Valid")  //only where the kernel fully overlaps the signal
+};
+
+USTRUCT(BlueprintType)
+struct FEiVSparseDirectSolver
+{
+	GENERATED_BODY()
+public:
+	//shared, so copies of this struct in Blueprint refer to the same solver
+	TSharedPtr<IEiVSparseDirectSolver<double>> Solver;
+	FEiVSparseDirectSolver() {
+		Solver = nullptr;
+	}
+	FEiVSparseDirectSolver(TSharedPtr<IEiVSparseDirectSolver<double>> InSolver) {
+		Solver = InSolver;
+	}
+};
+
+USTRUCT(BlueprintType)
+struct FEiVMultivariateNormal
+{
+	GENERATED_BODY()
+public:
+	//shared and never changed once made, so copies of this struct in Blueprint can be sampled from any thread
+	TSharedPtr<const TEiVMultivariateNormal<double>> Distribution;
+	FEiVMultivariateNormal() {
+		Distribution = nullptr;
+	}
+	FEiVMultivariateNormal(TSharedPtr<const TEiVMultivariateNormal<double>> InDistribution) {
+		Distribution = InDistribution;
+	}
+};
+
 //;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:;:
 
-UCLASS()
+// The math nodes only work on their own inputs and outputs, so the whole library is thread safe (usable on the
+// Animation Blueprint worker thread fast path) except for the nodes marked NotBlueprintThreadSafe, which change global
+// settings, use the global random generator or touch files
+UCLASS(meta = (BlueprintThreadSafe))
 class UEiVBPLibrary : public UBlueprintFunctionLibrary 
 {
 	GENERATED_UCLASS_BODY()
@@ -580,6 +726,159 @@ class UEiVBPLibrary : public UBlueprintFunctionLibrary
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Normalize", Keywords = "EiV Eigen Matrix Normalize", AutoCreateRefTerm = "A"), Category = "EiV|Core|Matrix")
 	static void EiVMatrixNormalize(UPARAM(ref)FEiVDynamicMatrix& A);
 
+	//EiV 1.1.0 =================================================================
+
+	//Multiplies a row-major sparse matrix with a dense matrix or vector on the worker threads. The columns of A must be the same size as the rows of B otherwise the null matrix is returned.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Sparse Dense Product", CompactNodeTitle = "S*B", Keywords = "EiV Eigen Sparse Matrix Multiply times dense vector SpMV SpMM parallel", AutoCreateRefTerm = "A, B"), Category = "EiV|Sparse Core|Sparse Matrix")
+	static void EiVSparseDenseProduct(FEiVRowMajorSparseMatrix A, FEiVDynamicMatrix B, FEiVDynamicMatrix& Matrix);
+	//Multiplies two row-major sparse matrices on the worker threads. The columns of A must be the same size as the rows of B otherwise an empty sparse matrix is returned.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Sparse Sparse Product", CompactNodeTitle = "S*T", Keywords = "EiV Eigen Sparse Matrix Multiply times SpGEMM parallel", AutoCreateRefTerm = "A, B"), Category = "EiV|Sparse Core|Sparse Matrix")
+	static void EiVSparseSparseProduct(FEiVRowMajorSparseMatrix A, FEiVRowMajorSparseMatrix B, FEiVRowMajorSparseMatrix& Matrix);
+	//The number of stored nonzero elements in a row-major sparse matrix
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Sparse Nonzeros", Keywords = "EiV Eigen Sparse Matrix Nonzeros", AutoCreateRefTerm = "A"), Category = "EiV|Sparse Core|Sparse Matrix")
+	static void EiVSparseNonzeros(FEiVRowMajorSparseMatrix A, int& Nonzeros);
+	//Creates a persistent iterative solver. It keeps its preconditioner while the sparsity pattern of the matrix does not change and can start each solve from the previous solution. A refresh interval of 0 only rebuilds an incomplete factorization when the sparsity pattern changes.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Make Iterative Solver", Keywords = "EiV Eigen Sparse Iterative Solver Conjugate Gradient BiCGSTAB Preconditioner Persistent"), Category = "EiV|Sparse Linear Algebra|Iterative Solver")
+	static void EiVMakeIterativeSolver(EEiVIterativeSolverType SolverType, EEiVIterativePreconditioner Preconditioner, int32 PreconditionerRefreshInterval, FEiVIterativeSolver& Solver);
+	//Sets the system matrix A of a persistent iterative solver. If the sparsity pattern of A did not change only its values are copied. Fails if the preconditioner could not be built.
+	UFUNCTION(BlueprintCallable, meta = (NotBlueprintThreadSafe, DisplayName = "Iterative Solver Set Matrix", Keywords = "EiV Eigen Sparse Iterative Solver Matrix Preconditioner", AutoCreateRefTerm = "A", ExpandEnumAsExecs = "Success"), Category = "EiV|Sparse Linear Algebra|Iterative Solver")
+	static void EiVIterativeSolverSetMatrix(UPARAM(ref) FEiVIterativeSolver& Solver, FEiVSparseMatrix A, bool bRefreshPreconditioner, EEiVBPFuncSuccess& Success);
+	//Solves AX = B with a persistent iterative solver. A Max Iterations or Tolerance of 0 or less uses the Eigen defaults. Fails if the solver did not converge, the best solution found is still returned.
+	UFUNCTION(BlueprintCallable, meta = (NotBlueprintThreadSafe, DisplayName = "Iterative Solver Solve", Keywords = "EiV Eigen Sparse Iterative Solver Solve Warm Start Guess", AutoCreateRefTerm = "B", ExpandEnumAsExecs = "Success"), Category = "EiV|Sparse Linear Algebra|Iterative Solver")
+	static void EiVIterativeSolverSolve(UPARAM(ref) FEiVIterativeSolver& Solver, FEiVDynamicMatrix B, int32 MaxIterations, double Tolerance, bool bWarmStart, EEiVBPFuncSuccess& Success, FEiVDynamicMatrix& Solution, int32& Iterations, double& Error);
+	//Resets a persistent iterative solver. If bKeepMatrix is true only the previous solution is forgotten, so the next solve starts from zero.
+	UFUNCTION(BlueprintCallable, meta = (NotBlueprintThreadSafe, DisplayName = "Iterative Solver Reset", Keywords = "EiV Eigen Sparse Iterative Solver Reset Clear"), Category = "EiV|Sparse Linear Algebra|Iterative Solver")
+	static void EiVIterativeSolverReset(UPARAM(ref) FEiVIterativeSolver& Solver, bool bKeepMatrix);
+	//Creates a sparse direct solver which only redoes the ordering and symbolic analysis when the sparsity pattern of its matrix changes. Use AMD for the simplicial solvers and COLAMD for Sparse LU.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Make Sparse Direct Solver", Keywords = "EiV Eigen Sparse Direct Solver LDLT LLT LU Cholesky Ordering AMD COLAMD Cached"), Category = "EiV|Sparse Linear Algebra|Direct Solver")
+	static void EiVMakeSparseDirectSolver(EEiVSparseDirectSolverType SolverType, EEiVSparseOrdering Ordering, FEiVSparseDirectSolver& Solver);
+	//Factorizes the matrix A with a sparse direct solver. Analyzed is true if the sparsity pattern changed and the symbolic analysis had to be redone. Fails if A could not be factorized.
+	UFUNCTION(BlueprintCallable, meta = (NotBlueprintThreadSafe, DisplayName = "Sparse Direct Solver Set Matrix", Keywords = "EiV Eigen Sparse Direct Solver Matrix Factorize Analyze", AutoCreateRefTerm = "A", ExpandEnumAsExecs = "Success"), Category = "EiV|Sparse Linear Algebra|Direct Solver")
+	static void EiVSparseDirectSolverSetMatrix(UPARAM(ref) FEiVSparseDirectSolver& Solver, FEiVSparseMatrix A, bool bForceAnalyze, EEiVBPFuncSuccess& Success, bool& Analyzed);
+	//Solves AX = B with the factorization of a sparse direct solver. Fails if there is no factorization or the rows of B do not match the rows of A.
+	UFUNCTION(BlueprintCallable, meta = (NotBlueprintThreadSafe, DisplayName = "Sparse Direct Solver Solve", Keywords = "EiV Eigen Sparse Direct Solver Solve", AutoCreateRefTerm = "B", ExpandEnumAsExecs = "Success"), Category = "EiV|Sparse Linear Algebra|Direct Solver")
+	static void EiVSparseDirectSolverSolve(FEiVSparseDirectSolver Solver, FEiVDynamicMatrix B, EEiVBPFuncSuccess& Success, FEiVDynamicMatrix& Solution);
+	//The fill-in of the last factorization (factor nonzeros / matrix nonzeros) and how often the analysis and factorization ran
+	UFUNCTION(BlueprintPure, meta = (NotBlueprintThreadSafe, DisplayName = "Sparse Direct Solver Stats", Keywords = "EiV Eigen Sparse Direct Solver Fill In Nonzeros Statistics"), Category = "EiV|Sparse Linear Algebra|Direct Solver")
+	static void EiVSparseDirectSolverStats(FEiVSparseDirectSolver Solver, int64& MatrixNonzeros, int64& FactorNonzeros, double& FillRatio, int32& AnalyzeCount, int32& FactorizeCount);
+	//Loads a dense matrix from a CSV, TSV or Matrix Market file. The file is read in chunks, so large files are never fully held in memory. bSkipHeader skips the first line of CSV and TSV files.
+	UFUNCTION(BlueprintCallable, meta = (NotBlueprintThreadSafe, DisplayName = "Load Matrix From File", Keywords = "EiV Eigen Matrix Load Read Import File CSV TSV Matrix Market mtx", ExpandEnumAsExecs = "Success"), Category = "EiV|IO")
+	static void EiVLoadMatrixFromFile(FString Path, EEiVTextMatrixFormat Format, bool bSkipHeader, EEiVBPFuncSuccess& Success, FEiVDynamicMatrix& Matrix);
+	//Saves a dense matrix to a CSV, TSV or Matrix Market (array format) file. Numbers are written with enough digits to read back exactly.
+	UFUNCTION(BlueprintCallable, meta = (NotBlueprintThreadSafe, DisplayName = "Save Matrix To File", Keywords = "EiV Eigen Matrix Save Write Export File CSV TSV Matrix Market mtx", AutoCreateRefTerm = "Matrix", ExpandEnumAsExecs = "Success"), Category = "EiV|IO")
+	static void EiVSaveMatrixToFile(FEiVDynamicMatrix Matrix, FString Path, EEiVTextMatrixFormat Format, EEiVBPFuncSuccess& Success);
+	//Loads a sparse matrix from a Matrix Market (.mtx) file in the coordinate or array format
+	UFUNCTION(BlueprintCallable, meta = (NotBlueprintThreadSafe, DisplayName = "Load Sparse Matrix From File", Keywords = "EiV Eigen Sparse Matrix Load Read Import File Matrix Market mtx", ExpandEnumAsExecs = "Success"), Category = "EiV|IO")
+	static void EiVLoadSparseMatrixFromFile(FString Path, EEiVBPFuncSuccess& Success, FEiVSparseMatrix& Matrix);
+	//Saves a sparse matrix to a Matrix Market (.mtx) file in the coordinate format
+	UFUNCTION(BlueprintCallable, meta = (NotBlueprintThreadSafe, DisplayName = "Save Sparse Matrix To File", Keywords = "EiV Eigen Sparse Matrix Save Write Export File Matrix Market mtx", AutoCreateRefTerm = "Matrix", ExpandEnumAsExecs = "Success"), Category = "EiV|IO")
+	static void EiVSaveSparseMatrixToFile(FEiVSparseMatrix Matrix, FString Path, EEiVBPFuncSuccess& Success);
+	//Parses a dense matrix from CSV or TSV text, one row per line, or from Matrix Market text. bSkipHeader skips the first line of CSV and TSV text.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Parse Matrix From String", Keywords = "EiV Eigen Matrix Parse String CSV TSV Matrix Market mtx", ExpandEnumAsExecs = "Success"), Category = "EiV|IO")
+	static void EiVParseMatrixFromString(FString String, EEiVTextMatrixFormat Format, bool bSkipHeader, EEiVBPFuncSuccess& Success, FEiVDynamicMatrix& Matrix);
+	//Adds two complex matrices. They must be the same size (rows and columns) or the null matrix is returned.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Add Complex Matrices", CompactNodeTitle = "A+B", Keywords = "EiV Eigen Complex Matrix Add", AutoCreateRefTerm = "A, B"), Category = "EiV|Core|Matrix")
+	static void EiVAddComplexMatrix(FEiVDynamicComplexMatrix A, FEiVDynamicComplexMatrix B, FEiVDynamicComplexMatrix& Matrix);
+	//Subtracts two complex matrices. They must be the same size (rows and columns) or the null matrix is returned.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Subtract Complex Matrices", CompactNodeTitle = "A-B", Keywords = "EiV Eigen Complex Matrix Subtract Minus", AutoCreateRefTerm = "A, B"), Category = "EiV|Core|Matrix")
+	static void EiVSubtractComplexMatrix(FEiVDynamicComplexMatrix A, FEiVDynamicComplexMatrix B, FEiVDynamicComplexMatrix& Matrix);
+	//Multiplies two complex matrices. The columns of A must be the same size as the rows of B otherwise the null matrix is returned.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Complex Matrix Multiplication", CompactNodeTitle = "A*B", Keywords = "EiV Eigen Complex Matrix Multiply times", AutoCreateRefTerm = "A, B"), Category = "EiV|Core|Matrix")
+	static void EiVComplexMatrixMultiplication(FEiVDynamicComplexMatrix A, FEiVDynamicComplexMatrix B, FEiVDynamicComplexMatrix& Matrix);
+	//Solves the complex linear system AX = B for every column of B. B must have the same number of rows as A.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Complex Matrix Solve (ColPivHHQR)", CompactNodeTitle = "Ax=B", Keywords = "EiV Eigen Complex Matrix Solve", AutoCreateRefTerm = "A, B"), Category = "EiV|Core|Matrix")
+	static void EiVComplexColPivHHQR(FEiVDynamicComplexMatrix A, FEiVDynamicComplexMatrix B, FEiVDynamicComplexMatrix& Solution);
+	//Computes the fast Fourier transform of a complex matrix. Row vectors are transformed along the row, otherwise every column is transformed, or the whole matrix if bTwoDimensional is true. The inverse transform is scaled by 1/n. Any size works, powers of two are the fastest.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "FFT", Keywords = "EiV Eigen FFT Fast Fourier Transform Spectrum Frequency Inverse", AutoCreateRefTerm = "Matrix"), Category = "EiV|FFT")
+	static void EiVFFT(FEiVDynamicComplexMatrix Matrix, bool bInverse, bool bTwoDimensional, FEiVDynamicComplexMatrix& Spectrum);
+	//Computes the fast Fourier transform of a real matrix. Row vectors are transformed along the row, otherwise every column is transformed. Only the n/2+1 non-redundant frequency bins are returned.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Real FFT", Keywords = "EiV Eigen FFT Fast Fourier Transform Spectrum Frequency Real", AutoCreateRefTerm = "Matrix"), Category = "EiV|FFT")
+	static void EiVRealFFT(FEiVDynamicMatrix Matrix, FEiVDynamicComplexMatrix& Spectrum);
+	//Computes the inverse of Real FFT. Length is the length of the original real signals, the spectrum must have Length/2+1 bins. Fails if the sizes do not match.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Inverse Real FFT", Keywords = "EiV Eigen FFT Fast Fourier Transform Spectrum Frequency Real Inverse", AutoCreateRefTerm = "Spectrum", ExpandEnumAsExecs = "Success"), Category = "EiV|FFT")
+	static void EiVInverseRealFFT(FEiVDynamicComplexMatrix Spectrum, int32 Length, EEiVBPFuncSuccess& Success, FEiVDynamicMatrix& Matrix);
+	//Convolves two vectors (row or column). Short kernels are convolved directly, longer ones through the FFT in O(n log n). The result has the orientation of the signal, or the null matrix is returned if either input is not a vector.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Convolve 1D", Keywords = "EiV Eigen FFT Convolution Convolve Filter Signal", AutoCreateRefTerm = "Signal, Kernel"), Category = "EiV|FFT")
+	static void EiVConvolve1D(FEiVDynamicMatrix Signal, FEiVDynamicMatrix Kernel, EEiVConvolutionMode Mode, FEiVDynamicMatrix& Matrix);
+	//Convolves two matrices in 2D. Small kernels are convolved directly, larger ones through the 2D FFT. The null matrix is returned if either input is empty.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Convolve 2D", Keywords = "EiV Eigen FFT Convolution Convolve Filter Image Heightfield", AutoCreateRefTerm = "Signal, Kernel"), Category = "EiV|FFT")
+	static void EiVConvolve2D(FEiVDynamicMatrix Signal, FEiVDynamicMatrix Kernel, EEiVConvolutionMode Mode, FEiVDynamicMatrix& Matrix);
+	//Computes the singular value decomposition A = U * S * V^T. Small matrices use JacobiSVD and larger ones BDCSVD. Thin only computes the first min(rows, cols) columns of U and V, and U and V are left empty if bComputeUV is false. The singular values are returned as a column vector in decreasing order.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Matrix SVD", Keywords = "EiV Eigen Matrix SVD Singular Value Decomposition Jacobi BDCSVD", AutoCreateRefTerm = "A", ExpandEnumAsExecs = "Success"), Category = "EiV|Dense Linear Problems|SVD")
+	static void EiVMatrixSVD(FEiVDynamicMatrix A, bool bThin, bool bComputeUV, EEiVBPFuncSuccess& Success, FEiVDynamicMatrix& U, FEiVDynamicMatrix& SingularValues, FEiVDynamicMatrix& V);
+	//Computes the Rank largest singular values and vectors with a randomized range finder, far faster than a full SVD when Rank is small. Oversampling of 5 to 10 and 1 or 2 Power Iterations are usually enough, the same Seed gives the same result.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Randomized Truncated SVD", Keywords = "EiV Eigen Matrix SVD Singular Value Decomposition Randomized Truncated Low Rank Compression", AutoCreateRefTerm = "A", ExpandEnumAsExecs = "Success"), Category = "EiV|Dense Linear Problems|SVD")
+	static void EiVRandomizedSVD(FEiVDynamicMatrix A, int32 Rank, int32 Oversampling, int32 PowerIterations, int32 Seed, EEiVBPFuncSuccess& Success, FEiVDynamicMatrix& U, FEiVDynamicMatrix& SingularValues, FEiVDynamicMatrix& V);
+	//Converts rotation vectors (the rotation axis scaled by the angle in radians) to rotations with the SO(3) exponential map. Stable for tiny and zero angles.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Rotation Vectors To Quats (SO3 Exp)", Keywords = "EiV Eigen Lie Group SO3 Exp Exponential Rotation Vector Angular Velocity Integrate Quat", AutoCreateRefTerm = "RotationVectors"), Category = "EiV|Geometry|Lie Groups")
+	static void EiVSO3Exp(TArray<FVector> RotationVectors, TArray<FQuat>& Rotations);
+	//Converts rotations to rotation vectors (the rotation axis scaled by the angle in radians, at most pi) with the SO(3) logarithm map. The rotations must be normalized.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Quats To Rotation Vectors (SO3 Log)", Keywords = "EiV Eigen Lie Group SO3 Log Logarithm Rotation Vector Quat", AutoCreateRefTerm = "Rotations"), Category = "EiV|Geometry|Lie Groups")
+	static void EiVSO3Log(TArray<FQuat> Rotations, TArray<FVector>& RotationVectors);
+	//Converts twists (a linear and an angular part) to rigid transforms with the SE(3) exponential map, the motion of a body moving with that constant twist for a unit of time. Both arrays must be the same size or empty arrays are returned.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Twists To Transforms (SE3 Exp)", Keywords = "EiV Eigen Lie Group SE3 Exp Exponential Twist Screw Velocity Integrate Transform", AutoCreateRefTerm = "Linear, Angular"), Category = "EiV|Geometry|Lie Groups")
+	static void EiVSE3Exp(TArray<FVector> Linear, TArray<FVector> Angular, TArray<FQuat>& Rotations, TArray<FVector>& Translations);
+	//Converts rigid transforms to twists with the SE(3) logarithm map. Both arrays must be the same size or empty arrays are returned, the rotations must be normalized.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Transforms To Twists (SE3 Log)", Keywords = "EiV Eigen Lie Group SE3 Log Logarithm Twist Screw Transform", AutoCreateRefTerm = "Rotations, Translations"), Category = "EiV|Geometry|Lie Groups")
+	static void EiVSE3Log(TArray<FQuat> Rotations, TArray<FVector> Translations, TArray<FVector>& Linear, TArray<FVector>& Angular);
+	//Interpolates pairs of rigid transforms along the screw motion between them, so points fixed to the bodies move on helices instead of straight lines. All arrays must be the same size or empty arrays are returned.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Interpolate Transforms (SE3)", Keywords = "EiV Eigen Lie Group SE3 Interpolate Lerp Slerp Screw Transform", AutoCreateRefTerm = "RotationsA, TranslationsA, RotationsB, TranslationsB"), Category = "EiV|Geometry|Lie Groups")
+	static void EiVSE3Interpolate(TArray<FQuat> RotationsA, TArray<FVector> TranslationsA, TArray<FQuat> RotationsB, TArray<FVector> TranslationsB, double Alpha, TArray<FQuat>& Rotations, TArray<FVector>& Translations);
+	//Skins vertex positions (and normals, if any are given) with linear blend or dual quaternion skinning. Every vertex has InfluencesPerVertex consecutive entries in BoneIndices and Weights, and its weights should sum to one. Fails if the array sizes do not match or a bone index is out of range.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Skin Vertices", Keywords = "EiV Eigen Skinning Skin Linear Blend Dual Quaternion LBS DQS Bones Mesh", AutoCreateRefTerm = "Bones, Positions, Normals, BoneIndices, Weights", ExpandEnumAsExecs = "Success"), Category = "EiV|Geometry|Skinning")
+	static void EiVSkinVertices(TArray<FTransform> Bones, TArray<FVector> Positions, TArray<FVector> Normals, TArray<int32> BoneIndices, TArray<double> Weights, int32 InfluencesPerVertex, bool bDualQuaternion, EEiVBPFuncSuccess& Success, TArray<FVector>& SkinnedPositions, TArray<FVector>& SkinnedNormals);
+	//Finds the rotation, translation (and uniform scale, if bScale) which best map the source points onto the target points in the weighted least squares sense (Kabsch / Procrustes). Weights may be empty for equal weights. Fails if the array sizes do not match.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Align Point Sets (Kabsch)", Keywords = "EiV Eigen Kabsch Procrustes Umeyama Align Point Set Registration Shape Matching Best Fit Rotation", AutoCreateRefTerm = "Source, Target, Weights", ExpandEnumAsExecs = "Success"), Category = "EiV|Geometry|Shape Matching")
+	static void EiVKabsch(TArray<FVector> Source, TArray<FVector> Target, TArray<double> Weights, bool bScale, EEiVBPFuncSuccess& Success, FQuat& Rotation, FVector& Translation, double& Scale);
+	//Decomposes a 3x3 matrix into a rotation and a symmetric stretch, A = Rotation * Stretch. The rotation is always proper, so the stretch has a negative eigenvalue if the matrix is a reflection. Fails if the matrix is not 3x3.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Matrix Polar Decomposition", Keywords = "EiV Eigen Polar Decomposition Rotation Stretch Shape Matching Deformation Gradient", ExpandEnumAsExecs = "Success"), Category = "EiV|Geometry|Shape Matching")
+	static void EiVPolarDecomposition(FEiVDynamicMatrix A, EEiVBPFuncSuccess& Success, FEiVDynamicMatrix& Rotation, FEiVDynamicMatrix& Stretch);
+	//Builds the Laplacian (uniform or cotangent weights) and the lumped mass of a triangle mesh, as a sparse matrix and a column vector with one entry per vertex. Indices holds 3 vertex indices per triangle. Fails if an index is out of range.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Mesh Laplacian", Keywords = "EiV Eigen Mesh Laplacian Cotangent Uniform Mass Matrix Sparse Smoothing Deformation", AutoCreateRefTerm = "Vertices, Indices", ExpandEnumAsExecs = "Success"), Category = "EiV|Geometry|Mesh")
+	static void EiVMeshLaplacian(TArray<FVector> Vertices, TArray<int32> Indices, bool bCotangent, EEiVBPFuncSuccess& Success, FEiVSparseMatrix& Laplacian, FEiVDynamicMatrix& Mass);
+	//Smooths the vertices of a triangle mesh with implicit Laplacian smoothing, solving (M + TimeStep * L) X' = M X Iterations times with one factorization. Fails if an index is out of range or the system could not be factorized.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Smooth Mesh Vertices", Keywords = "EiV Eigen Mesh Smooth Smoothing Laplacian Implicit Fairing Denoise", AutoCreateRefTerm = "Vertices, Indices", ExpandEnumAsExecs = "Success"), Category = "EiV|Geometry|Mesh")
+	static void EiVSmoothMeshVertices(TArray<FVector> Vertices, TArray<int32> Indices, bool bCotangent, double TimeStep, int32 Iterations, EEiVBPFuncSuccess& Success, TArray<FVector>& SmoothedVertices);
+	//Finds the tangents of the smooth (C2) cubic spline through the points, with natural ends or looping if bClosed. They are the arrive and leave tangents of spline points whose input keys are their indices, the default of spline components. Solved in linear time.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Cubic Spline Tangents", Keywords = "EiV Eigen Spline Cubic Natural Tangents Interpolate Curve Tridiagonal Thomas", AutoCreateRefTerm = "Points"), Category = "EiV|Geometry|Splines")
+	static void EiVCubicSplineTangents(TArray<FVector> Points, bool bClosed, TArray<FVector>& Tangents);
+	//Fits a clamped uniform B-spline of the given degree (3 for cubic, at most 7) to the points by least squares, placing them along it by chord length. Smoothing above 0 penalizes bends of the control polygon. Fails if there are not more control points than the degree or too few points to fit them.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Fit B-Spline", Keywords = "EiV Eigen Spline BSpline B-Spline Fit Least Squares Smooth Curve Banded Cholesky", AutoCreateRefTerm = "Points", ExpandEnumAsExecs = "Success"), Category = "EiV|Geometry|Splines")
+	static void EiVFitBSpline(TArray<FVector> Points, int32 NumControlPoints, int32 Degree, double Smoothing, EEiVBPFuncSuccess& Success, TArray<FVector>& ControlPoints);
+	//Evaluates a clamped uniform B-spline of the given degree at NumPoints evenly spaced parameters from its start to its end. Fails if there are not more control points than the degree.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Evaluate B-Spline", Keywords = "EiV Eigen Spline BSpline B-Spline Evaluate Sample Curve", AutoCreateRefTerm = "ControlPoints", ExpandEnumAsExecs = "Success"), Category = "EiV|Geometry|Splines")
+	static void EiVEvaluateBSpline(TArray<FVector> ControlPoints, int32 Degree, int32 NumPoints, EEiVBPFuncSuccess& Success, TArray<FVector>& Points);
+	//Makes Matrix Sum, Matrix Mean, Dot Product, Matrix Norm and Matrix Multiplication give bitwise identical results on every machine and thread count, for lockstep multiplayer. They stay parallel and vectorized but are somewhat slower. The setting is global to the process, graphs that must not depend on it can use the Deterministic nodes below, which always are.
+	UFUNCTION(BlueprintCallable, meta = (NotBlueprintThreadSafe, DisplayName = "Set Deterministic Math", Keywords = "EiV Eigen Deterministic Lockstep Reproducible Bitwise Multiplayer"), Category = "EiV|Core|Determinism")
+	static void EiVSetDeterministicMath(bool bEnabled);
+	//Returns true if the deterministic math mode is enabled.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Is Deterministic Math Enabled", Keywords = "EiV Eigen Deterministic Lockstep Reproducible Bitwise Multiplayer"), Category = "EiV|Core|Determinism")
+	static void EiVIsDeterministicMath(bool& bEnabled);
+	//Multiplies two matrices with bitwise identical results on every machine and thread count, whatever the Set Deterministic Math setting. They must be compatible (A columns equals B rows) or the null matrix is returned.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Deterministic Matrix Multiplication", Keywords = "EiV Eigen Deterministic Lockstep Reproducible Bitwise Matrix Multiply times", AutoCreateRefTerm = "A, B"), Category = "EiV|Core|Determinism")
+	static void EiVDeterministicMatrixMultiplication(FEiVDynamicMatrix A, FEiVDynamicMatrix B, FEiVDynamicMatrix& Matrix);
+	//Computes the dot product of the first columns of two matrices with bitwise identical results on every machine and thread count, whatever the Set Deterministic Math setting. Returns 0 if the sizes do not match.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Deterministic Dot Product", Keywords = "EiV Eigen Deterministic Lockstep Reproducible Bitwise Matrix dot product vector", AutoCreateRefTerm = "A, B"), Category = "EiV|Core|Determinism")
+	static void EiVDeterministicDotProduct(FEiVDynamicMatrix A, FEiVDynamicMatrix B, double& DotProduct);
+	//Sums the coefficients of a matrix with bitwise identical results on every machine and thread count, whatever the Set Deterministic Math setting.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Deterministic Matrix Sum", Keywords = "EiV Eigen Deterministic Lockstep Reproducible Bitwise Matrix sum", AutoCreateRefTerm = "A"), Category = "EiV|Core|Determinism")
+	static void EiVDeterministicMatrixSum(FEiVDynamicMatrix A, double& Sum);
+	//Averages the coefficients of a matrix with bitwise identical results on every machine and thread count, whatever the Set Deterministic Math setting.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Deterministic Matrix Mean", Keywords = "EiV Eigen Deterministic Lockstep Reproducible Bitwise Matrix mean average", AutoCreateRefTerm = "A"), Category = "EiV|Core|Determinism")
+	static void EiVDeterministicMatrixMean(FEiVDynamicMatrix A, double& Mean);
+	//Computes the Frobenius norm of a matrix with bitwise identical results on every machine and thread count, whatever the Set Deterministic Math setting.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Deterministic Norm", Keywords = "EiV Eigen Deterministic Lockstep Reproducible Bitwise Matrix Norm Frobenius", AutoCreateRefTerm = "A"), Category = "EiV|Core|Determinism")
+	static void EiVDeterministicMatrixNorm(FEiVDynamicMatrix A, double& Norm);
+	//Makes the Matrix Solve, Eigenvalues, Eigenvectors, Determinant, Inverse, Rank, LU, complete orthogonal decomposition and SVD nodes reuse their results while their inputs do not change, instead of computing them again for every node reading their outputs. Results are found by the content of the inputs and the least recently used ones are evicted past MaxEntries results or MaxMegabytes of memory. Disabling the cache also clears it. The setting is global to the process, and only nodes run on the game thread use the cache.
+	UFUNCTION(BlueprintCallable, meta = (NotBlueprintThreadSafe, DisplayName = "Set Result Cache", Keywords = "EiV Eigen Cache Memoize Memoization Pure Node Performance"), Category = "EiV|Core|Result Cache")
+	static void EiVSetResultCache(bool bEnabled, int32 MaxEntries = 256, int32 MaxMegabytes = 64);
+	//Removes all results from the result cache and resets its statistics.
+	UFUNCTION(BlueprintCallable, meta = (NotBlueprintThreadSafe, DisplayName = "Clear Result Cache", Keywords = "EiV Eigen Cache Memoize Memoization Clear Flush"), Category = "EiV|Core|Result Cache")
+	static void EiVClearResultCache();
+	//Gets the hits, misses and evictions of the result cache since it was last cleared, and the number and memory of the results it holds. The same values show in the "stat EiV" group.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Result Cache Stats", Keywords = "EiV Eigen Cache Memoize Memoization Stats Statistics Hits Misses"), Category = "EiV|Core|Result Cache")
+	static void EiVGetResultCacheStats(bool& bEnabled, int64& Hits, int64& Misses, int64& Evictions, int32& Entries, int64& Bytes);
+
 //=========================================================================================//
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~ FEiVHelper Blueprint functions ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //=========================================================================================//
@@ -596,23 +895,56 @@ class UEiVBPLibrary : public UBlueprintFunctionLibrary
 	//Creates a dynamic matrix containing just the real components
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Strip Imaginary", Keywords = "EiV Eigen Dynamic Complex Matrix Strip Imaginary", AutoCreateRefTerm = "Matrix"), Category = "EiV|Core|Matrix")
 	static void EiVStripImaginary(FEiVDynamicComplexMatrix Matrix, FEiVDynamicMatrix& RealMatrix);
+	//Creates a dynamic complex matrix from its real and imaginary components. An empty imaginary matrix is treated as zero, otherwise both must be the same size or the null matrix is returned.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Merge Real And Imaginary", Keywords = "EiV Eigen Dynamic Complex Matrix Merge Real Imaginary", AutoCreateRefTerm = "RealMatrix, ImaginaryMatrix"), Category = "EiV|Core|Matrix")
+	static void EiVMergeRealAndImaginary(FEiVDynamicMatrix RealMatrix, FEiVDynamicMatrix ImaginaryMatrix, FEiVDynamicComplexMatrix& Matrix);
 	//Creates an array from the context of a dynamic matrix in Row-Major Order
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Dynamic Matrix To Array", Keywords = "EiV Eigen Dynamic Matrix Array", AutoCreateRefTerm = "Matrix"), Category = "EiV|Core|Matrix")
 	static void EiVDynamicMatrixToArray(FEiVDynamicMatrix Matrix, TArray<double>& Array);
 	//Creates a dynamic Eigen matrix that can be of any size. It should be expected that the array elements are inserted and accessed in Row-Major Order.
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Create Dynamic Matrix", Keywords = "EiV Eigen Dynamic Matrix", AutoCreateRefTerm = "Array, Rows, Cols"), Category = "EiV|Core|Matrix")
 	static void EiVMakeDynamicMatrix(TArray<double> Array, int32 Rows, int32 Cols, FEiVDynamicMatrix& Matrix);
+	//Creates a row-major dynamic Eigen matrix that can be of any size. Row-major matrices have the same layout as arrays and Unreal Engine matrices, so this is a single copy. Missing elements are set to zero.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Create Row-Major Dynamic Matrix", Keywords = "EiV Eigen Dynamic Matrix Row Major", AutoCreateRefTerm = "Array, Rows, Cols"), Category = "EiV|Core|Matrix")
+	static void EiVMakeRowMajorDynamicMatrix(TArray<double> Array, int32 Rows, int32 Cols, FEiVRowMajorDynamicMatrix& Matrix);
+	//Creates an array from the context of a row-major dynamic matrix in Row-Major Order with a single copy
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Row-Major Dynamic Matrix To Array", Keywords = "EiV Eigen Dynamic Matrix Row Major Array", AutoCreateRefTerm = "Matrix"), Category = "EiV|Core|Matrix")
+	static void EiVRowMajorDynamicMatrixToArray(FEiVRowMajorDynamicMatrix Matrix, TArray<double>& Array);
+	//Converts a row-major dynamic matrix to a dynamic matrix. Blueprint inserts this automatically, so row-major matrices can be used with every dynamic matrix node.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "To Dynamic Matrix (Row-Major Dynamic Matrix)", CompactNodeTitle = "->", Keywords = "EiV Eigen Dynamic Matrix Row Major Convert", BlueprintAutocast), Category = "EiV|Core|Matrix")
+	static FEiVDynamicMatrix EiVConvRowMajorDynamicMatrixToDynamicMatrix(const FEiVRowMajorDynamicMatrix& Matrix);
+	//Converts a dynamic matrix to a row-major dynamic matrix. Blueprint inserts this automatically.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "To Row-Major Dynamic Matrix (Dynamic Matrix)", CompactNodeTitle = "->", Keywords = "EiV Eigen Dynamic Matrix Row Major Convert", BlueprintAutocast), Category = "EiV|Core|Matrix")
+	static FEiVRowMajorDynamicMatrix EiVConvDynamicMatrixToRowMajorDynamicMatrix(const FEiVDynamicMatrix& Matrix);
 	//Creates a dynamic Eigen vector that can be of any size.
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Create Dynamic Vector", Keywords = "EiV Eigen Dynamic Vector", AutoCreateRefTerm = "Array, Rows"), Category = "EiV|Core|Vector")
 	static void EiVMakeDynamicVector(TArray<double> Array, int32 Rows, FEiVDynamicMatrix& Matrix, FEiVDynamicVector& Vector);
-	//Creates a dynamic Eigen matrix that can be of any size with random elements from 0 to 1.
+	//Creates a dynamic Eigen matrix that can be of any size with random elements from -1 to 1. Uses the global random generator, so the values depend on the order of all calls, Create Random Dynamic Matrix From Stream is reproducible.
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Create Random Dynamic Matrix", Keywords = "EiV Eigen Dynamic Matrix Random", AutoCreateRefTerm = "Array, Rows, Cols"), Category = "EiV|Core|Matrix")
 	static void EiVMakeRandomDynamicMatrix(int32 Rows, int32 Cols, FEiVDynamicMatrix& Matrix);
-	//Creates a dynamic Eigen vector that can be of any size with random elements from 0 to 1.
+	//Creates a dynamic Eigen vector that can be of any size with random elements from -1 to 1. Uses the global random generator, so the values depend on the order of all calls, Create Random Dynamic Vector From Stream is reproducible.
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Create Random Dynamic Vector", Keywords = "EiV Eigen Dynamic Vector Random", AutoCreateRefTerm = "Rows"), Category = "EiV|Core|Vector")
 	static void EiVMakeRandomDynamicVector(int32 Rows, FEiVDynamicMatrix& Matrix, FEiVDynamicVector& Vector);
+	//Creates a dynamic Eigen matrix with random elements uniformly distributed from Min to Max, drawn from a random stream. The same seed gives the same matrix, and different streams can be used on different threads.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Create Random Dynamic Matrix From Stream", Keywords = "EiV Eigen Dynamic Matrix Random Stream Seed Seeded Uniform"), Category = "EiV|Core|Matrix")
+	static void EiVMakeRandomDynamicMatrixFromStream(const FRandomStream& Stream, int32 Rows, int32 Cols, double Min, double Max, FEiVDynamicMatrix& Matrix);
+	//Creates a dynamic Eigen vector with random elements uniformly distributed from Min to Max, drawn from a random stream. The same seed gives the same vector, and different streams can be used on different threads.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Create Random Dynamic Vector From Stream", Keywords = "EiV Eigen Dynamic Vector Random Stream Seed Seeded Uniform"), Category = "EiV|Core|Vector")
+	static void EiVMakeRandomDynamicVectorFromStream(const FRandomStream& Stream, int32 Rows, double Min, double Max, FEiVDynamicMatrix& Matrix, FEiVDynamicVector& Vector);
+	//Creates a dynamic Eigen matrix with normally distributed random elements, drawn from a random stream. The same seed gives the same matrix, and different streams can be used on different threads.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Create Normal Random Dynamic Matrix From Stream", Keywords = "EiV Eigen Dynamic Matrix Random Stream Seed Seeded Normal Gaussian"), Category = "EiV|Core|Matrix")
+	static void EiVMakeNormalRandomDynamicMatrixFromStream(const FRandomStream& Stream, int32 Rows, int32 Cols, double Mean, double StandardDeviation, FEiVDynamicMatrix& Matrix);
+	//Draws samples of the multivariate normal distribution with the Mean vector and the Covariance matrix from a random stream, one sample per column. It is not successful if the sizes do not match or the covariance is not symmetric positive definite. The covariance is factorized on every call unless the result cache is enabled and the node runs on the game thread, so to sample one distribution often make it once with Make Multivariate Normal.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Sample Multivariate Normal From Stream", Keywords = "EiV Eigen Dynamic Matrix Random Stream Seed Seeded Normal Gaussian Multivariate Covariance", AutoCreateRefTerm = "Mean, Covariance", ExpandEnumAsExecs = "Success"), Category = "EiV|Core|Matrix")
+	static void EiVSampleMultivariateNormalFromStream(const FRandomStream& Stream, FEiVDynamicVector Mean, FEiVDynamicMatrix Covariance, int32 NumSamples, EEiVBPFuncSuccess& Success, FEiVDynamicMatrix& Samples);
+	//Makes a multivariate normal distribution with the Mean vector and the Covariance matrix, factorizing the covariance once for every later sample. It is not successful if the sizes do not match or the covariance is not symmetric positive definite.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Make Multivariate Normal", Keywords = "EiV Eigen Dynamic Matrix Random Normal Gaussian Multivariate Covariance Distribution Cholesky", AutoCreateRefTerm = "Mean, Covariance", ExpandEnumAsExecs = "Success"), Category = "EiV|Core|Matrix")
+	static void EiVMakeMultivariateNormal(FEiVDynamicVector Mean, FEiVDynamicMatrix Covariance, EEiVBPFuncSuccess& Success, FEiVMultivariateNormal& Distribution);
+	//Draws samples of a multivariate normal distribution made with Make Multivariate Normal from a random stream, one sample per column. The same seed gives the same samples. It is not successful if the distribution was never made.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Sample Multivariate Normal Distribution From Stream", Keywords = "EiV Eigen Dynamic Matrix Random Stream Seed Seeded Normal Gaussian Multivariate Distribution", ExpandEnumAsExecs = "Success"), Category = "EiV|Core|Matrix")
+	static void EiVSampleMultivariateNormalDistributionFromStream(const FRandomStream& Stream, FEiVMultivariateNormal Distribution, int32 NumSamples, EEiVBPFuncSuccess& Success, FEiVDynamicMatrix& Samples);
 	//This sets the number of threads Eigen can use at any given time
-	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Eigen Threads", Keywords = "EiV Eigen Threads"), Category = "EiV")
+	UFUNCTION(BlueprintCallable, meta = (NotBlueprintThreadSafe, DisplayName = "Set Eigen Threads", Keywords = "EiV Eigen Threads"), Category = "EiV")
 	static void EiVSetEigenThreads(int32 Threads);
 	//This gets the number of threads Eigen can use at any given time
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Get Eigen Threads", Keywords = "EiV Eigen Threads"), Category = "EiV")
@@ -659,6 +991,9 @@ class UEiVBPLibrary : public UBlueprintFunctionLibrary
 	//Creates a dynamic matrix from this Eigen matrix
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Eigen Matrix To Dynamic Matrix", Keywords = "EiV Eigen Dynamic Row Vector", AutoCreateRefTerm = "Matrix"), Category = "EiV|Core|Matrix")
 	static void EiVEigenMatrixToDynamicMatrix(FEiVMatrix Matrix, FEiVDynamicMatrix& OutDynamicMatrix);
+	//Converts between Unreal Engine Matrices and row-major dynamic matrices with a single copy (Input types are inverted). A row-major matrix which is not 4x4 gives the identity matrix.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Matrix To Row-Major Dynamic Matrix", Keywords = "EiV Eigen Matrix Dynamic Row Major", AutoCreateRefTerm = "Matrix, RowMajorMatrix"), Category = "EiV|Core|Matrix")
+	static void EiVMatrixToRowMajorDynamicMatrix(FMatrix Matrix, FEiVRowMajorDynamicMatrix RowMajorMatrix, FMatrix& OutMatrix, FEiVRowMajorDynamicMatrix& OutRowMajorMatrix);
 	//Converts between Unreal Engine Vector2Ds and Eigen JacobiRotation types (Input types are inverted)
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Vector2D To Jacobi Rotation", Keywords = "EiV Eigen Vector2D Jacobi Rotation", AutoCreateRefTerm = "Vector, JacobiRotation"), Category = "EiV|Jacobi|Jacobi Rotation")
 	static void EiVVector2DToJacobiRotation(FVector2D Vector, FEiVJacobiRotation JacobiRotation, FVector2D& OutVector, FEiVJacobiRotation& OutJacobiRotation);
@@ -680,6 +1015,9 @@ class UEiVBPLibrary : public UBlueprintFunctionLibrary
 	//Converts between Unreal Engine Arrays and Eigen Sparse Matrices (Input types are inverted)
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Array To Sparse Matrix", Keywords = "EiV Eigen Sparse Matrix Array", AutoCreateRefTerm = "Array, Rows, Cols, SparseMatrix"), Category = "EiV|Sparse Core|Sparse Matrix")
 	static void EiVArrayToSparseMatrix(TArray<double> Array, int32 Rows, int32 Cols, FEiVSparseMatrix SparseMatrix, TArray<double>& OutArray, FEiVSparseMatrix& OutSparseMatrix);
+	//Converts between column-major and row-major (CSR) Eigen Sparse Matrices (Input types are inverted). The parallel sparse products use row-major sparse matrices.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Sparse Matrix To Row-Major Sparse Matrix", Keywords = "EiV Eigen Sparse Matrix Row Major CSR", AutoCreateRefTerm = "SparseMatrix, RowMajorSparseMatrix"), Category = "EiV|Sparse Core|Sparse Matrix")
+	static void EiVSparseMatrixToRowMajor(FEiVSparseMatrix SparseMatrix, FEiVRowMajorSparseMatrix RowMajorSparseMatrix, FEiVSparseMatrix& OutSparseMatrix, FEiVRowMajorSparseMatrix& OutRowMajorSparseMatrix);
 	//Converts between Unreal Engine and Eigen Quaternion types (Input types are inverted)
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Quat To Quaternion", Keywords = "EiV Eigen Quat Quaternion", AutoCreateRefTerm = "Quat, Quaternion"), Category = "EiV|Geometry|Quaternion")
 	static void EiVQuatToQuaternion(FQuat Quat, FEiVQuaternion Quaternion, FQuat& OutQuat, FEiVQuaternion& OutQuaternion);
@@ -0,0 +1,676 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+//<><><><><><><><><><><><> EiVLibrary Import Block <><><><><><><><><><><><>
+//imports the specified headers by the macro definitions
+
+#define EIV_INCLUDE_DENSE_MATRIX_ARRAY    //includes most core and basic features
+#define EIV_UNDEFINE_INCLUDES             //ensures that these include macros above are local to this file
+
+#include "EiVLibrary.h"   //takes the EIV_INCLUDE macros as settings and retrieves
+                          //the specified Eigen modules, typedefs, and helper functions
+//<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>
+#include <atomic>
+
+/*
+* Banded matrices and their direct solvers. An n x n matrix with Lower nonzero diagonals below the main diagonal and
+* Upper above it is stored by diagonals as in LAPACK's band storage, a (Lower + Upper + 1) x n matrix whose column j
+* holds column j of the matrix, A(i, j) at row Upper + i - j. It takes (Lower + Upper + 1) n numbers instead of n^2,
+* and LU or Cholesky factorizes it in O(n Lower (Lower + Upper)) instead of O(n^3), which for the tridiagonal and
+* pentadiagonal systems of spline fitting is O(n).
+* For this whole class the <NumericType> is the datatype of the entries.
+*/
+template<typename NumericType = double>
+class TEiVBandedMatrix
+{
+public:
+	TEiVBandedMatrix() {}
+	TEiVBandedMatrix(int32 InSize, int32 InLower, int32 InUpper)
+	{
+		Resize(InSize, InLower, InUpper);
+	}
+
+	// This function resizes the matrix and sets every entry to zero
+	// @param InSize - the number of rows and columns
+	// @param InLower - the number of diagonals below the main diagonal
+	// @param InUpper - the number of diagonals above the main diagonal
+	void Resize(int32 InSize, int32 InLower, int32 InUpper)
+	{
+		Size = FMath::Max(InSize, 0);
+		Lower = FMath::Max(InLower, 0);
+		Upper = FMath::Max(InUpper, 0);
+		Band.setZero(Lower + Upper + 1, Size);
+	}
+	// This function sets every entry to zero, keeping the size
+	void SetZero()
+	{
+		Band.setZero();
+	}
+	// @returns - true if A(Row, Col) is inside the matrix and its band
+	bool IsInBand(int32 Row, int32 Col) const
+	{
+		return Row >= 0 && Col >= 0 && Row < Size && Col < Size && Row - Col <= Lower && Col - Row <= Upper;
+	}
+	// @returns - the entry A(Row, Col), which must be in the band
+	NumericType& operator()(int32 Row, int32 Col)
+	{
+		return Band(Upper + Row - Col, Col);
+	}
+	// @returns - the entry A(Row, Col), 0 outside the band
+	NumericType operator()(int32 Row, int32 Col) const
+	{
+		return IsInBand(Row, Col) ? Band(Upper + Row - Col, Col) : (NumericType)0;
+	}
+	// This function multiplies the matrix with a dense matrix, OutY = A X
+	// @param X - Size rows and any number of columns
+	// @param OutY - the product
+	// @returns - false if the sizes do not match
+	bool Multiply(const EiVRef<const EiVMatrixX<NumericType>>& X, EiVMatrixX<NumericType>& OutY) const
+	{
+		if (X.rows() != Size) {
+			return false;
+		}
+		OutY.setZero(Size, X.cols());
+		for (int32 Col = 0; Col < Size; Col++) {
+			const int32 First = FMath::Max(Col - Upper, 0);
+			const int32 Last = FMath::Min(Col + Lower, Size - 1);
+			for (int32 Row = First; Row <= Last; Row++) {
+				OutY.row(Row) += Band(Upper + Row - Col, Col) * X.row(Col);
+			}
+		}
+		return true;
+	}
+	// @returns - the matrix as a dense matrix
+	EiVMatrixX<NumericType> ToDense() const
+	{
+		EiVMatrixX<NumericType> Dense = EiVMatrixX<NumericType>::Zero(Size, Size);
+		for (int32 Col = 0; Col < Size; Col++) {
+			for (int32 Row = FMath::Max(Col - Upper, 0); Row <= FMath::Min(Col + Lower, Size - 1); Row++) {
+				Dense(Row, Col) = Band(Upper + Row - Col, Col);
+			}
+		}
+		return Dense;
+	}
+
+	// @returns - the number of rows and columns
+	int32 GetSize() const { return Size; }
+	// @returns - the number of diagonals below the main diagonal
+	int32 GetLower() const { return Lower; }
+	// @returns - the number of diagonals above the main diagonal
+	int32 GetUpper() const { return Upper; }
+	// @returns - the band storage, A(i, j) at (Upper + i - j, j)
+	const EiVMatrixX<NumericType>& GetBand() const { return Band; }
+	EiVMatrixX<NumericType>& GetBand() { return Band; }
+
+private:
+	EiVMatrixX<NumericType> Band;
+	int32 Size = 0;
+	int32 Lower = 0;
+	int32 Upper = 0;
+};
+
+/*
+* The LU factorization with partial pivoting of a banded matrix, PA = LU, as in LAPACK's gbtf2. The row swaps widen
+* the upper band of U to Lower + Upper diagonals, so the factors take (2 Lower + Upper + 1) n numbers. The storage is
+* kept between factorizations, so factorizing matrices of the same size and bands does not allocate.
+* This object is not thread safe, use one per thread.
+*/
+template<typename NumericType = double>
+class TEiVBandedLU
+{
+public:
+	// This function factorizes a matrix
+	// @param InMatrix - the matrix
+	// @returns - false if the matrix is singular
+	bool Compute(const TEiVBandedMatrix<NumericType>& InMatrix)
+	{
+		Size = InMatrix.GetSize();
+		Lower = InMatrix.GetLower();
+		const int32 Width = Lower + InMatrix.GetUpper();
+		// the first Lower rows take the fill of U, the diagonal is at row Width
+		Factors.resize(Lower + Width + 1, Size);
+		Factors.topRows(Lower).setZero();
+		Factors.bottomRows(Width + 1) = InMatrix.GetBand();
+		Pivots.SetNumUninitialized(Size);
+		bFactorized = false;
+		int32 LastColumn = 0;
+		for (int32 Col = 0; Col < Size; Col++) {
+			const int32 Below = FMath::Min(Lower, Size - 1 - Col);
+			int32 Pivot = 0;
+			Factors.col(Col).segment(Width, Below + 1).cwiseAbs().maxCoeff(&Pivot);
+			Pivots[Col] = Col + Pivot;
+			if (Factors(Width + Pivot, Col) == (NumericType)0) {
+				return false;
+			}
+			// the columns the rows of this step reach, before and after the swap
+			LastColumn = FMath::Max(LastColumn, FMath::Min(Col + InMatrix.GetUpper() + Pivot, Size - 1));
+			if (Pivot != 0) {
+				for (int32 Other = Col; Other <= LastColumn; Other++) {
+					Swap(Factors(Width + Col - Other, Other), Factors(Width + Col + Pivot - Other, Other));
+				}
+			}
+			if (Below > 0) {
+				Factors.col(Col).segment(Width + 1, Below) /= Factors(Width, Col);
+				for (int32 Other = Col + 1; Other <= LastColumn; Other++) {
+					const NumericType Value = Factors(Width + Col - Other, Other);
+					if (Value != (NumericType)0) {
+						Factors.col(Other).segment(Width + Col + 1 - Other, Below) -= Value * Factors.col(Col).segment(Width + 1, Below);
+					}
+				}
+			}
+		}
+		bFactorized = true;
+		return true;
+	}
+	// This function solves AX = B in place
+	// @param InOutB - the right hand sides, one per column, replaced by the solutions
+	// @returns - false if there is no valid factorization or the sizes do not match
+	bool Solve(EiVRef<EiVMatrixX<NumericType>> InOutB) const
+	{
+		if (!bFactorized || InOutB.rows() != Size) {
+			return false;
+		}
+		const int32 Width = (int32)Factors.rows() - 1 - Lower;
+		// L, with the row swaps in the order they were made
+		for (int32 Col = 0; Col < Size - 1; Col++) {
+			if (Pivots[Col] != Col) {
+				InOutB.row(Col).swap(InOutB.row(Pivots[Col]));
+			}
+			const int32 Below = FMath::Min(Lower, Size - 1 - Col);
+			for (int32 Row = 1; Row <= Below; Row++) {
+				InOutB.row(Col + Row) -= Factors(Width + Row, Col) * InOutB.row(Col);
+			}
+		}
+		// U, Width diagonals above the main diagonal
+		for (int32 Col = Size - 1; Col >= 0; Col--) {
+			InOutB.row(Col) /= Factors(Width, Col);
+			for (int32 Row = FMath::Max(Col - Width, 0); Row < Col; Row++) {
+				InOutB.row(Row) -= Factors(Width + Row - Col, Col) * InOutB.row(Col);
+			}
+		}
+		return true;
+	}
+	// @returns - true if the last matrix was factorized successfully
+	bool IsFactorized() const { return bFactorized; }
+
+private:
+	EiVMatrixX<NumericType> Factors;
+	TArray<int32> Pivots;
+	int32 Size = 0;
+	int32 Lower = 0;
+	bool bFactorized = false;
+};
+
+/*
+* The Cholesky factorization of a symmetric positive definite banded matrix, A = L L^T, as in LAPACK's pbtf2. Only the
+* main diagonal and the Lower diagonals below it are read, so the matrix can be built with Upper = 0. L has the same
+* lower band and no pivoting is needed, so it is about twice as fast as the LU and takes half the storage.
+* This object is not thread safe, use one per thread.
+*/
+template<typename NumericType = double>
+class TEiVBandedCholesky
+{
+public:
+	// This function factorizes a matrix
+	// @param InMatrix - the matrix, only its lower band is read
+	// @returns - false if the matrix is not positive definite
+	bool Compute(const TEiVBandedMatrix<NumericType>& InMatrix)
+	{
+		Size = InMatrix.GetSize();
+		Bandwidth = InMatrix.GetLower();
+		// L(j + Row, j) at (Row, j)
+		Factor = InMatrix.GetBand().bottomRows(Bandwidth + 1);
+		bFactorized = false;
+		for (int32 Col = 0; Col < Size; Col++) {
+			const NumericType Diagonal = Factor(0, Col);
+			if (!(Diagonal > (NumericType)0)) {
+				return false;
+			}
+			Factor(0, Col) = FMath::Sqrt(Diagonal);
+			const int32 Below = FMath::Min(Bandwidth, Size - 1 - Col);
+			Factor.col(Col).segment(1, Below) /= Factor(0, Col);
+			// the trailing lower band loses the outer product of this column
+			for (int32 Step = 1; Step <= Below; Step++) {
+				Factor.col(Col + Step).head(Below + 1 - Step) -= Factor(Step, Col) * Factor.col(Col).segment(Step, Below + 1 - Step);
+			}
+		}
+		bFactorized = true;
+		return true;
+	}
+	// This function solves AX = B in place
+	// @param InOutB - the right hand sides, one per column, replaced by the solutions
+	// @returns - false if there is no valid factorization or the sizes do not match
+	bool Solve(EiVRef<EiVMatrixX<NumericType>> InOutB) const
+	{
+		if (!bFactorized || InOutB.rows() != Size) {
+			return false;
+		}
+		for (int32 Col = 0; Col < Size; Col++) {
+			InOutB.row(Col) /= Factor(0, Col);
+			const int32 Below = FMath::Min(Bandwidth, Size - 1 - Col);
+			for (int32 Row = 1; Row <= Below; Row++) {
+				InOutB.row(Col + Row) -= Factor(Row, Col) * InOutB.row(Col);
+			}
+		}
+		for (int32 Col = Size - 1; Col >= 0; Col--) {
+			const int32 Below = FMath::Min(Bandwidth, Size - 1 - Col);
+			for (int32 Row = 1; Row <= Below; Row++) {
+				InOutB.row(Col) -= Factor(Row, Col) * InOutB.row(Col + Row);
+			}
+			InOutB.row(Col) /= Factor(0, Col);
+		}
+		return true;
+	}
+	// @returns - true if the last matrix was factorized successfully
+	bool IsFactorized() const { return bFactorized; }
+
+private:
+	EiVMatrixX<NumericType> Factor;
+	int32 Size = 0;
+	int32 Bandwidth = 0;
+	bool bFactorized = false;
+};
+
+/*
+* Tridiagonal solvers and batched banded solvers. Tridiagonal systems are given as three arrays of Size numbers:
+* Lower[i] = A(i, i - 1), Diagonal[i] = A(i, i) and Upper[i] = A(i, i + 1). Lower[0] and Upper[Size - 1] are outside
+* the matrix and only used by the cyclic solver, as the corners A(0, Size - 1) and A(Size - 1, 0).
+* The Thomas algorithm does not pivot, so it is meant for diagonally dominant or symmetric positive definite systems,
+* such as the ones of spline fitting, use TEiVBandedLU for the others.
+* The batched solvers take many systems stored one after another, system i owning the rows Offsets[i] to
+* Offsets[i + 1] - 1, and split them over the worker threads.
+* For this whole struct the <NumericType> is the datatype of the numbers stored in the Eigen types.
+*/
+struct EIV_API FEiVBandedSolvers
+{
+	// The smallest number of systems worth a worker thread
+	static constexpr int32 MinSystemsPerTask = 16;
+
+	// This function solves a tridiagonal system with the Thomas algorithm in place, in O(Size)
+	// @param Lower - Size numbers, the diagonal below the main diagonal from the second row
+	// @param Diagonal - Size numbers, the main diagonal
+	// @param Upper - Size numbers, the diagonal above the main diagonal up to the second to last row
+	// @param Size - the number of rows
+	// @param InOutB - the right hand sides, one per column, replaced by the solutions
+	// @param Workspace - Size numbers of scratch space
+	// @returns - false if the sizes do not match or a pivot is zero
+	template<typename NumericType = double>
+	static bool SolveTridiagonal(const NumericType* Lower, const NumericType* Diagonal, const NumericType* Upper, int32 Size, EiVRef<EiVMatrixX<NumericType>> InOutB, NumericType* Workspace)
+	{
+		if (InOutB.rows() != Size || Size == 0) {
+			return InOutB.rows() == Size;
+		}
+		// the forward sweep leaves a unit lower bidiagonal system, Workspace holding its upper diagonal
+		NumericType Pivot = Diagonal[0];
+		if (Pivot == (NumericType)0) {
+			return false;
+		}
+		Workspace[0] = Upper[0] / Pivot;
+		InOutB.row(0) /= Pivot;
+		for (int32 Row = 1; Row < Size; Row++) {
+			Pivot = Diagonal[Row] - Lower[Row] * Workspace[Row - 1];
+			if (Pivot == (NumericType)0) {
+				return false;
+			}
+			Workspace[Row] = Upper[Row] / Pivot;
+			InOutB.row(Row) = (InOutB.row(Row) - Lower[Row] * InOutB.row(Row - 1)) / Pivot;
+		}
+		for (int32 Row = Size - 2; Row >= 0; Row--) {
+			InOutB.row(Row) -= Workspace[Row] * InOutB.row(Row + 1);
+		}
+		return true;
+	}
+	// This function solves a cyclic tridiagonal system (with the corners Lower[0] = A(0, Size - 1) and
+	// Upper[Size - 1] = A(Size - 1, 0)) in place, with the Sherman-Morrison formula over two Thomas solves
+	// @param Lower - Size numbers, the diagonal below the main diagonal and the top right corner
+	// @param Diagonal - Size numbers, the main diagonal
+	// @param Upper - Size numbers, the diagonal above the main diagonal and the bottom left corner
+	// @param Size - the number of rows, at least 3
+	// @param InOutB - the right hand sides, one per column, replaced by the solutions
+	// @param Workspace - 3 * Size numbers of scratch space
+	// @returns - false if the sizes do not match or the system is singular
+	template<typename NumericType = double>
+	static bool SolveCyclicTridiagonal(const NumericType* Lower, const NumericType* Diagonal, const NumericType* Upper, int32 Size, EiVRef<EiVMatrixX<NumericType>> InOutB, NumericType* Workspace)
+	{
+		if (InOutB.rows() != Size || Size < 3) {
+			return false;
+		}
+		// A = T + u v^T with u = (Gamma, 0, ..., 0, Corner) and v = (1, 0, ..., 0, TopCorner / Gamma), so T is
+		// tridiagonal, then A^-1 B = T^-1 B - T^-1 u (v^T T^-1 B) / (1 + v^T T^-1 u)
+		const NumericType TopCorner = Lower[0];
+		const NumericType BottomCorner = Upper[Size - 1];
+		const NumericType Gamma = Diagonal[0] != (NumericType)0 ? -Diagonal[0] : (NumericType)-1;
+		NumericType* Modified = Workspace + Size;
+		NumericType* Correction = Workspace + 2 * Size;
+		FMemory::Memcpy(Modified, Diagonal, Size * sizeof(NumericType));
+		Modified[0] -= Gamma;
+		Modified[Size - 1] -= BottomCorner * TopCorner / Gamma;
+		EiVMap<EiVMatrixX<NumericType>> U(Correction, Size, 1);
+		U.setZero();
+		U(0, 0) = Gamma;
+		U(Size - 1, 0) = BottomCorner;
+		if (!FEiVBandedSolvers::SolveTridiagonal<NumericType>(Lower, Modified, Upper, Size, InOutB, Workspace)
+			|| !FEiVBandedSolvers::SolveTridiagonal<NumericType>(Lower, Modified, Upper, Size, U, Workspace)) {
+			return false;
+		}
+		const NumericType Denominator = (NumericType)1 + U(0, 0) + TopCorner * U(Size - 1, 0) / Gamma;
+		if (Denominator == (NumericType)0) {
+			return false;
+		}
+		const EiVMatrix<NumericType, 1, EiVDynamic> Factor = (InOutB.row(0) + (TopCorner / Gamma) * InOutB.row(Size - 1)) / Denominator;
+		InOutB -= U * Factor;
+		return true;
+	}
+	// This function solves a batch of tridiagonal systems in place
+	// @param Lower - the diagonals below the main diagonals of all systems, one number per row
+	// @param Diagonal - the main diagonals of all systems, one number per row
+	// @param Upper - the diagonals above the main diagonals of all systems, one number per row
+	// @param InOutB - the right hand sides of all systems, one per column, replaced by the solutions
+	// @param Offsets - Count + 1 increasing row indices, system i owns the rows Offsets[i] to Offsets[i + 1] - 1
+	// @param Count - the number of systems
+	// @param bCyclic - if true the systems are cyclic, see SolveCyclicTridiagonal
+	// @returns - the number of systems which failed (singular, or offsets that are not increasing and within InOutB)
+	template<typename NumericType = double>
+	static int32 SolveTridiagonalBatch(const NumericType* Lower, const NumericType* Diagonal, const NumericType* Upper, EiVMatrixX<NumericType>& InOutB, const int32* Offsets, int32 Count, bool bCyclic = false)
+	{
+		std::atomic<int32> NumFailed(0);
+		FEiVHelper::ForEachRange(Count, FEiVBandedSolvers::MinSystemsPerTask, [&](int32 First, int32 Last)
+		{
+			TArray<NumericType> Workspace;
+			for (int32 System = First; System < Last; System++) {
+				const int32 Start = Offsets[System];
+				const int32 Size = Offsets[System + 1] - Start;
+				if (Start < 0 || Size < 0 || Start + Size > InOutB.rows()) {
+					NumFailed.fetch_add(1, std::memory_order_relaxed);
+					continue;
+				}
+				if (Workspace.Num() < 3 * Size) {
+					Workspace.SetNumUninitialized(3 * Size);
+				}
+				const bool bSolved = bCyclic
+					? FEiVBandedSolvers::SolveCyclicTridiagonal<NumericType>(Lower + Start, Diagonal + Start, Upper + Start, Size, InOutB.middleRows(Start, Size), Workspace.GetData())
+					: FEiVBandedSolvers::SolveTridiagonal<NumericType>(Lower + Start, Diagonal + Start, Upper + Start, Size, InOutB.middleRows(Start, Size), Workspace.GetData());
+				if (!bSolved) {
+					NumFailed.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+		});
+		return NumFailed.load();
+	}
+	// This function solves a batch of banded systems in place, each task reusing one factorization object
+	// @param Matrices - Count matrices
+	// @param InOutB - Count right hand side matrices, one per system, replaced by the solutions
+	// @param Count - the number of systems
+	// @param bCholesky - if true the matrices are symmetric positive definite and solved with TEiVBandedCholesky,
+	// otherwise with TEiVBandedLU
+	// @returns - the number of systems which failed (singular or not positive definite, or sizes which do not match)
+	template<typename NumericType = double>
+	static int32 SolveBatch(const TEiVBandedMatrix<NumericType>* Matrices, EiVMatrixX<NumericType>* InOutB, int32 Count, bool bCholesky)
+	{
+		std::atomic<int32> NumFailed(0);
+		FEiVHelper::ForEachRange(Count, FEiVBandedSolvers::MinSystemsPerTask, [&](int32 First, int32 Last)
+		{
+			TEiVBandedLU<NumericType> LU;
+			TEiVBandedCholesky<NumericType> Cholesky;
+			for (int32 System = First; System < Last; System++) {
+				const bool bSolved = bCholesky
+					? Cholesky.Compute(Matrices[System]) && Cholesky.Solve(InOutB[System])
+					: LU.Compute(Matrices[System]) && LU.Solve(InOutB[System]);
+				if (!bSolved) {
+					NumFailed.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+		});
+		return NumFailed.load();
+	}
+};
+
+/*
+* Spline fitting over the banded solvers, for curves given as points, one per column (an EiVMatrix3X or a map of FVector
+* data), singly or as batches of curves stored one after another.
+* Cubic interpolation finds the tangents of the C2 cubic Hermite spline through the points with the parameter of every
+* point being its index, which are the arrive and leave tangents of FInterpCurve and USplineComponent points with the
+* default input keys. Their system is tridiagonal, natural (zero curvature) at the ends of open curves and cyclic for
+* closed ones.
+* B-spline fitting finds the control points of a clamped uniform B-spline that best fits sampled points in the least
+* squares sense, the samples placed along it by chord length. The normal equations are symmetric positive definite with
+* Degree diagonals on each side, and are solved with the banded Cholesky. A second difference penalty on the control
+* points smooths noisy samples and makes the fit well defined when spans hold no samples.
+* For this whole struct the <NumericType> is the datatype of the points.
+*/
+struct EIV_API FEiVSplineFitting
+{
+	// The highest supported B-spline degree
+	static constexpr int32 MaxDegree = 7;
+
+	// This function finds the tangents of the C2 cubic spline through points
+	// @param Points - the points, one per column
+	// @param bClosed - if true the curve loops back from the last point to the first, which needs at least 3 points
+	// @param OutTangents - the tangent at every point, with respect to the point index
+	template<typename NumericType = double>
+	static void CubicTangents(const EiVRef<const EiVMatrix3X<NumericType>>& Points, bool bClosed, EiVMatrix3X<NumericType>& OutTangents)
+	{
+		const int32 Offsets[2] = { 0, (int32)Points.cols() };
+		FEiVSplineFitting::CubicTangentsBatch<NumericType>(Points, Offsets, 1, bClosed, OutTangents);
+	}
+	// This function finds the tangents of the C2 cubic splines through a batch of curves
+	// @param Points - the points of all curves, one per column
+	// @param Offsets - Count + 1 increasing column indices, curve i owns the columns Offsets[i] to Offsets[i + 1] - 1
+	// @param Count - the number of curves
+	// @param bClosed - if true every curve loops back from its last point to its first
+	// @param OutTangents - the tangent at every point, zero for the curves which failed
+	// @returns - the number of curves which failed (offsets that are not increasing and within Points)
+	template<typename NumericType = double>
+	static int32 CubicTangentsBatch(const EiVRef<const EiVMatrix3X<NumericType>>& Points, const int32* Offsets, int32 Count, bool bClosed, EiVMatrix3X<NumericType>& OutTangents)
+	{
+		OutTangents.setZero(3, Points.cols());
+		std::atomic<int32> NumFailed(0);
+		FEiVHelper::ForEachRange(Count, FEiVBandedSolvers::MinSystemsPerTask, [&](int32 First, int32 Last)
+		{
+			TArray<NumericType> Diagonals;
+			TArray<NumericType> Workspace;
+			EiVMatrixX<NumericType> System;
+			for (int32 Curve = First; Curve < Last; Curve++) {
+				const int32 Start = Offsets[Curve];
+				const int32 Size = Offsets[Curve + 1] - Start;
+				if (Start < 0 || Size < 0 || Start + Size > Points.cols()) {
+					NumFailed.fetch_add(1, std::memory_order_relaxed);
+					continue;
+				}
+				if (Size < 2) {
+					continue;
+				}
+				const bool bCyclic = bClosed && Size >= 3;
+				if (Workspace.Num() < 3 * Size) {
+					Diagonals.SetNumUninitialized(3 * Size);
+					Workspace.SetNumUninitialized(3 * Size);
+				}
+				NumericType* Lower = Diagonals.GetData();
+				NumericType* Diagonal = Lower + Size;
+				NumericType* Upper = Diagonal + Size;
+				// D[i - 1] + 4 D[i] + D[i + 1] = 3 (P[i + 1] - P[i - 1]) from the continuous curvature at every point,
+				// with 2 D[0] + D[1] = 3 (P[1] - P[0]) and its mirror from the zero curvature at open ends
+				System.resize(Size, 3);
+				for (int32 Row = 0; Row < Size; Row++) {
+					Lower[Row] = (NumericType)1;
+					Diagonal[Row] = (NumericType)4;
+					Upper[Row] = (NumericType)1;
+					const int32 Previous = Row > 0 ? Row - 1 : (bCyclic ? Size - 1 : 0);
+					const int32 Next = Row < Size - 1 ? Row + 1 : (bCyclic ? 0 : Size - 1);
+					System.row(Row) = (NumericType)3 * (Points.col(Start + Next) - Points.col(Start + Previous)).transpose();
+				}
+				if (!bCyclic) {
+					Diagonal[0] = (NumericType)2;
+					Diagonal[Size - 1] = (NumericType)2;
+				}
+				const bool bSolved = bCyclic
+					? FEiVBandedSolvers::SolveCyclicTridiagonal<NumericType>(Lower, Diagonal, Upper, Size, System, Workspace.GetData())
+					: FEiVBandedSolvers::SolveTridiagonal<NumericType>(Lower, Diagonal, Upper, Size, System, Workspace.GetData());
+				if (!bSolved) {
+					NumFailed.fetch_add(1, std::memory_order_relaxed);
+					continue;
+				}
+				OutTangents.middleCols(Start, Size) = System.transpose();
+			}
+		});
+		return NumFailed.load();
+	}
+	// This function fits a clamped uniform B-spline to sampled points
+	// @param Samples - the sampled points in order along the curve, one per column
+	// @param NumControlPoints - the number of control points, more than Degree
+	// @param Degree - the degree of the B-spline, from 1 to MaxDegree (3 for a cubic)
+	// @param Smoothing - the weight of the second difference penalty on the control points, 0 for a plain least squares fit
+	// @param OutControlPoints - the control points, one per column, the first and last on the first and last samples' fit
+	// @returns - false if the arguments are invalid or the fit is not well defined (too few samples and no smoothing)
+	template<typename NumericType = double>
+	static bool FitBSpline(const EiVRef<const EiVMatrix3X<NumericType>>& Samples, int32 NumControlPoints, int32 Degree, NumericType Smoothing, EiVMatrix3X<NumericType>& OutControlPoints)
+	{
+		const int32 Offsets[2] = { 0, (int32)Samples.cols() };
+		return FEiVSplineFitting::FitBSplineBatch<NumericType>(Samples, Offsets, 1, NumControlPoints, Degree, Smoothing, OutControlPoints) == 0;
+	}
+	// This function fits clamped uniform B-splines to a batch of sampled curves, all with the same number of control points
+	// @param Samples - the samples of all curves, one per column
+	// @param Offsets - Count + 1 increasing column indices, curve i owns the columns Offsets[i] to Offsets[i + 1] - 1
+	// @param Count - the number of curves
+	// @param NumControlPoints - the number of control points of every curve, more than Degree
+	// @param Degree - the degree of the B-splines, from 1 to MaxDegree
+	// @param Smoothing - the weight of the second difference penalty on the control points
+	// @param OutControlPoints - Count * NumControlPoints control points, curve i owning the columns from i * NumControlPoints,
+	// zero for the curves which failed
+	// @returns - the number of curves which failed, Count if the arguments are invalid
+	template<typename NumericType = double>
+	static int32 FitBSplineBatch(const EiVRef<const EiVMatrix3X<NumericType>>& Samples, const int32* Offsets, int32 Count, int32 NumControlPoints, int32 Degree, NumericType Smoothing, EiVMatrix3X<NumericType>& OutControlPoints)
+	{
+		if (Count <= 0 || Degree < 1 || Degree > MaxDegree || NumControlPoints <= Degree || Smoothing < (NumericType)0) {
+			OutControlPoints.resize(3, 0);
+			return FMath::Max(Count, 0);
+		}
+		OutControlPoints.setZero(3, (int64)Count * NumControlPoints);
+		// the penalty couples three neighbouring control points, so it needs two diagonals even for lines
+		const int32 Bandwidth = Smoothing > (NumericType)0 ? FMath::Max(Degree, 2) : Degree;
+		std::atomic<int32> NumFailed(0);
+		FEiVHelper::ForEachRange(Count, FEiVBandedSolvers::MinSystemsPerTask, [&](int32 First, int32 Last)
+		{
+			TEiVBandedMatrix<NumericType> Normal(NumControlPoints, Bandwidth, 0);
+			TEiVBandedCholesky<NumericType> Cholesky;
+			EiVMatrixX<NumericType> System(NumControlPoints, 3);
+			EiVVectorX<NumericType> Parameters;
+			for (int32 Curve = First; Curve < Last; Curve++) {
+				const int32 Start = Offsets[Curve];
+				const int32 Size = Offsets[Curve + 1] - Start;
+				if (Start < 0 || Size <= 0 || Start + Size > Samples.cols()) {
+					NumFailed.fetch_add(1, std::memory_order_relaxed);
+					continue;
+				}
+				FEiVSplineFitting::ChordLengthParameters<NumericType>(Samples.middleCols(Start, Size), Parameters);
+				Normal.SetZero();
+				System.setZero();
+				// B^T B C = B^T P, only the lower band of B^T B
+				NumericType Basis[MaxDegree + 1];
+				for (int32 Sample = 0; Sample < Size; Sample++) {
+					const int32 Span = FEiVSplineFitting::BasisFunctions<NumericType>(NumControlPoints, Degree, Parameters[Sample], Basis);
+					const int32 FirstPoint = Span - Degree;
+					for (int32 Row = 0; Row <= Degree; Row++) {
+						for (int32 Col = 0; Col <= Row; Col++) {
+							Normal(FirstPoint + Row, FirstPoint + Col) += Basis[Row] * Basis[Col];
+						}
+						System.row(FirstPoint + Row) += Basis[Row] * Samples.col(Start + Sample).transpose();
+					}
+				}
+				// Smoothing |C[i - 1] - 2 C[i] + C[i + 1]|^2 for every inner control point
+				const NumericType Stencil[3] = { (NumericType)1, (NumericType)-2, (NumericType)1 };
+				for (int32 Point = 1; Smoothing > (NumericType)0 && Point < NumControlPoints - 1; Point++) {
+					for (int32 Row = 0; Row < 3; Row++) {
+						for (int32 Col = 0; Col <= Row; Col++) {
+							Normal(Point - 1 + Row, Point - 1 + Col) += Smoothing * Stencil[Row] * Stencil[Col];
+						}
+					}
+				}
+				if (!Cholesky.Compute(Normal) || !Cholesky.Solve(System)) {
+					NumFailed.fetch_add(1, std::memory_order_relaxed);
+					continue;
+				}
+				OutControlPoints.middleCols((int64)Curve * NumControlPoints, NumControlPoints) = System.transpose();
+			}
+		});
+		return NumFailed.load();
+	}
+	// This function evaluates a clamped uniform B-spline
+	// @param ControlPoints - the control points, one per column, more than Degree
+	// @param Degree - the degree of the B-spline, from 1 to MaxDegree
+	// @param Parameters - the parameters to evaluate at, from 0 (the first control point) to 1 (the last control point)
+	// @param OutPoints - the point at every parameter, one per column
+	// @returns - false if the arguments are invalid
+	template<typename NumericType = double>
+	static bool EvaluateBSpline(const EiVRef<const EiVMatrix3X<NumericType>>& ControlPoints, int32 Degree, const EiVRef<const EiVVectorX<NumericType>>& Parameters, EiVMatrix3X<NumericType>& OutPoints)
+	{
+		const int32 NumControlPoints = (int32)ControlPoints.cols();
+		if (Degree < 1 || Degree > MaxDegree || NumControlPoints <= Degree) {
+			OutPoints.resize(3, 0);
+			return false;
+		}
+		OutPoints.resize(3, Parameters.size());
+		for (int64 Index = 0; Index < Parameters.size(); Index++) {
+			NumericType Basis[MaxDegree + 1];
+			const int32 Span = FEiVSplineFitting::BasisFunctions<NumericType>(NumControlPoints, Degree, Parameters[Index], Basis);
+			OutPoints.col(Index) = ControlPoints.middleCols(Span - Degree, Degree + 1) * EiVMap<const EiVVectorX<NumericType>>(Basis, Degree + 1);
+		}
+		return true;
+	}
+
+private:
+	// the knot k of the clamped uniform knot vector, Degree + 1 zeros, the inner knots evenly spaced, Degree + 1 ones
+	template<typename NumericType>
+	static NumericType Knot(int32 NumControlPoints, int32 Degree, int32 Index)
+	{
+		return FMath::Clamp((NumericType)(Index - Degree) / (NumericType)(NumControlPoints - Degree), (NumericType)0, (NumericType)1);
+	}
+	// the Degree + 1 nonzero basis functions at Parameter (The NURBS Book, A2.2), of the control points from the
+	// returned span - Degree to the span
+	template<typename NumericType>
+	static int32 BasisFunctions(int32 NumControlPoints, int32 Degree, NumericType Parameter, NumericType* OutBasis)
+	{
+		const int32 Spans = NumControlPoints - Degree;
+		const NumericType Clamped = FMath::Clamp(Parameter, (NumericType)0, (NumericType)1);
+		const int32 Span = Degree + FMath::Clamp((int32)(Clamped * (NumericType)Spans), 0, Spans - 1);
+		NumericType Left[MaxDegree + 1];
+		NumericType Right[MaxDegree + 1];
+		OutBasis[0] = (NumericType)1;
+		for (int32 Order = 1; Order <= Degree; Order++) {
+			Left[Order] = Clamped - FEiVSplineFitting::Knot<NumericType>(NumControlPoints, Degree, Span + 1 - Order);
+			Right[Order] = FEiVSplineFitting::Knot<NumericType>(NumControlPoints, Degree, Span + Order) - Clamped;
+			NumericType Saved = (NumericType)0;
+			for (int32 Index = 0; Index < Order; Index++) {
+				const NumericType Term = OutBasis[Index] / (Right[Index + 1] + Left[Order - Index]);
+				OutBasis[Index] = Saved + Right[Index + 1] * Term;
+				Saved = Left[Order - Index] * Term;
+			}
+			OutBasis[Order] = Saved;
+		}
+		return Span;
+	}
+	// the cumulative distances along the points, scaled to end at 1, or evenly spaced if the points do not move
+	template<typename NumericType>
+	static void ChordLengthParameters(const EiVRef<const EiVMatrix3X<NumericType>>& Points, EiVVectorX<NumericType>& OutParameters)
+	{
+		const int64 Size = Points.cols();
+		OutParameters.resize(Size);
+		OutParameters[0] = (NumericType)0;
+		for (int64 Index = 1; Index < Size; Index++) {
+			OutParameters[Index] = OutParameters[Index - 1] + (Points.col(Index) - Points.col(Index - 1)).norm();
+		}
+		if (Size > 1 && OutParameters[Size - 1] > (NumericType)0) {
+			OutParameters /= OutParameters[Size - 1];
+		}
+		else {
+			OutParameters = EiVVectorX<NumericType>::LinSpaced(Size, (NumericType)0, (NumericType)1);
+		}
+	}
+};
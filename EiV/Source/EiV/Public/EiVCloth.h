@@ -0,0 +1,389 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+//<><><><><><><><><><><><> EiVLibrary Import Block <><><><><><><><><><><><>
+//imports the specified headers by the macro definitions
+
+#define EIV_INCLUDE_DENSE_MATRIX_ARRAY    //includes most core and basic features
+#define EIV_INCLUDE_SPARSE_LINEAR_ALGEBRA //includes sparse linear algebra utilities
+#define EIV_UNDEFINE_INCLUDES             //ensures that these include macros above are local to this file
+
+#include "EiVLibrary.h"   //takes the EIV_INCLUDE macros as settings and retrieves
+                          //the specified Eigen modules, typedefs, and helper functions
+//<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>
+#include "EiVIterativeSolvers.h"
+#include "Async/ParallelFor.h"
+#include <algorithm>
+#include <atomic>
+
+/*
+* A mass-spring cloth stepped with implicit (backward) Euler, which stays stable with stiff springs and large time
+* steps. Every step solves (M - h D - h^2 K) v' = M v + h f for the new velocities v', where K and D are the derivatives
+* of the spring forces with respect to the positions and velocities. The damping forces are linear in the velocities,
+* so they only appear in the matrix.
+* The 3N x 3N system matrix is a sparse matrix built once by Init with one 3x3 block per particle and per pair of
+* connected particles. Only its lower triangle is stored, which is all the conjugate gradient solver reads. Every step
+* writes the new values straight into its storage, one block column per particle so the particles can be filled in
+* parallel, and hands it to a persistent conjugate gradient solver which copies the values in place and starts from
+* the previous solution, the velocities of the last frame, so it only needs a few iterations.
+* The compressing part of the spring stiffness is dropped from K so that the system stays positive definite.
+* Pinned particles keep the velocity they are given, set it to move them kinematically.
+* For this whole class the <NumericType> is the datatype of the numbers stored in the Eigen types.
+*/
+template<typename NumericType = double>
+class TEiVMassSpringCloth
+{
+public:
+	// A spring between two particles
+	struct FSpring
+	{
+		int32 Particle0 = 0;
+		int32 Particle1 = 0;
+		// the length at which the spring applies no force
+		NumericType RestLength = (NumericType)0;
+		// the force per unit of stretch
+		NumericType Stiffness = (NumericType)0;
+		// the force per unit of relative velocity along the spring
+		NumericType Damping = (NumericType)0;
+	};
+
+	// the particle positions and velocities, one per column
+	EiVMatrix3X<NumericType> Positions;
+	EiVMatrix3X<NumericType> Velocities;
+	// the acceleration applied to every particle which is not pinned
+	EiVVector3<NumericType> Gravity = EiVVector3<NumericType>(0, 0, (NumericType)-980);
+	// the iteration cap and tolerance of the velocity solve, warm starting is on by default
+	FEiVIterativeSolveSettings SolveSettings;
+
+	TEiVMassSpringCloth()
+	{
+		SolveSettings.MaxIterations = 100;
+		SolveSettings.Tolerance = 1e-6;
+		// the diagonal changes with the springs every step and the diagonal preconditioner is cheap to rebuild
+		Solver.SetPreconditionerRefreshInterval(1);
+	}
+	// The persistent solver keeps a reference to its matrix, so the cloth must not be copied or moved
+	TEiVMassSpringCloth(const TEiVMassSpringCloth&) = delete;
+	TEiVMassSpringCloth& operator=(const TEiVMassSpringCloth&) = delete;
+
+	// This function sets up the particles and springs and builds the sparsity pattern of the system matrix
+	// @param InPositions - the particle positions, one per column, the velocities start at zero
+	// @param Masses - the mass of every particle, a particle with a mass of zero or less is pinned
+	// @param InSprings - the springs, a spring with a negative rest length uses the current distance of its particles
+	// @returns - false if the sizes do not match or a spring index is out of range
+	bool Init(const EiVMatrix3X<NumericType>& InPositions, const EiVVectorX<NumericType>& Masses, const TArray<FSpring>& InSprings)
+	{
+		typedef typename EiVSparseMatrix<NumericType>::StorageIndex StorageIndex;
+		const int32 NumParticles = (int32)InPositions.cols();
+		if (Masses.size() != NumParticles) {
+			return false;
+		}
+		for (const FSpring& Spring : InSprings) {
+			const bool bValid0 = Spring.Particle0 >= 0 && Spring.Particle0 < NumParticles;
+			const bool bValid1 = Spring.Particle1 >= 0 && Spring.Particle1 < NumParticles;
+			if (!bValid0 || !bValid1 || Spring.Particle0 == Spring.Particle1) {
+				return false;
+			}
+		}
+		Positions = InPositions;
+		Velocities.setZero(3, NumParticles);
+		Mass.resize(NumParticles);
+		Pinned.SetNumUninitialized(NumParticles);
+		for (int32 Particle = 0; Particle < NumParticles; Particle++) {
+			Pinned[Particle] = Masses[Particle] <= (NumericType)0 ? 1 : 0;
+			// pinned particles get a unit mass so their rows of the system stay well scaled
+			Mass[Particle] = Pinned[Particle] ? (NumericType)1 : Masses[Particle];
+		}
+		Springs = InSprings;
+		for (FSpring& Spring : Springs) {
+			if (Spring.RestLength < (NumericType)0) {
+				Spring.RestLength = (Positions.col(Spring.Particle0) - Positions.col(Spring.Particle1)).norm();
+			}
+		}
+
+		// the springs of every particle sorted by the other particle, with the rank of the other particle's block in the
+		// block column of this particle
+		ParticleStarts.SetNumZeroed(NumParticles + 1);
+		for (const FSpring& Spring : Springs) {
+			ParticleStarts[Spring.Particle0 + 1]++;
+			ParticleStarts[Spring.Particle1 + 1]++;
+		}
+		for (int32 Particle = 0; Particle < NumParticles; Particle++) {
+			ParticleStarts[Particle + 1] += ParticleStarts[Particle];
+		}
+		Adjacency.SetNumUninitialized(2 * Springs.Num());
+		{
+			TArray<int32> Fill(ParticleStarts.GetData(), NumParticles);
+			for (int32 SpringIndex = 0; SpringIndex < Springs.Num(); SpringIndex++) {
+				Adjacency[Fill[Springs[SpringIndex].Particle0]++] = FAdjacent{ SpringIndex, Springs[SpringIndex].Particle1, 0 };
+				Adjacency[Fill[Springs[SpringIndex].Particle1]++] = FAdjacent{ SpringIndex, Springs[SpringIndex].Particle0, 0 };
+			}
+		}
+		BlockCounts.SetNumUninitialized(NumParticles);
+		for (int32 Particle = 0; Particle < NumParticles; Particle++) {
+			FAdjacent* First = Adjacency.GetData() + ParticleStarts[Particle];
+			FAdjacent* Last = Adjacency.GetData() + ParticleStarts[Particle + 1];
+			std::sort(First, Last, [](const FAdjacent& A, const FAdjacent& B) { return A.Neighbour < B.Neighbour; });
+			// block 0 is the diagonal, the blocks of lower particles are stored in their own columns and several
+			// springs between the same particles share a block
+			int32 Block = 1;
+			for (FAdjacent* Item = First; Item < Last; Item++) {
+				if (Item->Neighbour < Particle) {
+					Item->Block = INDEX_NONE;
+				}
+				else if (Item > First && Item[-1].Neighbour == Item->Neighbour) {
+					Item->Block = Item[-1].Block;
+				}
+				else {
+					Item->Block = Block++;
+				}
+			}
+			BlockCounts[Particle] = Block;
+		}
+
+		// column Axis of a particle holds the rows Axis to 2 of its diagonal block followed by 3 rows per block
+		System.resize(3 * NumParticles, 3 * NumParticles);
+		StorageIndex NonZeros = 0;
+		for (int32 Particle = 0; Particle < NumParticles; Particle++) {
+			NonZeros += 6 + 9 * (BlockCounts[Particle] - 1);
+		}
+		System.resizeNonZeros(NonZeros);
+		StorageIndex* Outer = System.outerIndexPtr();
+		StorageIndex* Inner = System.innerIndexPtr();
+		Outer[0] = 0;
+		for (int32 Particle = 0; Particle < NumParticles; Particle++) {
+			for (int32 Axis = 0; Axis < 3; Axis++) {
+				StorageIndex* Column = Inner + Outer[3 * Particle + Axis];
+				for (int32 Row = Axis; Row < 3; Row++) {
+					Column[Row - Axis] = (StorageIndex)(3 * Particle + Row);
+				}
+				for (int32 Item = ParticleStarts[Particle]; Item < ParticleStarts[Particle + 1]; Item++) {
+					if (Adjacency[Item].Block != INDEX_NONE) {
+						for (int32 Row = 0; Row < 3; Row++) {
+							Column[BlockOffset(Axis, Adjacency[Item].Block) + Row] = (StorageIndex)(3 * Adjacency[Item].Neighbour + Row);
+						}
+					}
+				}
+				Outer[3 * Particle + Axis + 1] = Outer[3 * Particle + Axis] + BlockOffset(Axis, BlockCounts[Particle]);
+			}
+		}
+		EiVMap<EiVVectorX<NumericType>>(System.valuePtr(), System.nonZeros()).setZero();
+
+		SpringBlocks.SetNumUninitialized(Springs.Num());
+		SpringForces.resize(3, Springs.Num());
+		RightHandSide.resize(3 * NumParticles, 1);
+		Solver.Reset();
+		LastStats = FEiVIterativeSolveStats();
+		return true;
+	}
+	// This function pins or releases a particle, a released particle gets the given mass
+	// @param Particle - the index of the particle
+	// @param bPin - if true the particle keeps its velocity, otherwise it is simulated
+	// @param InMass - the mass of a released particle
+	void SetPinned(int32 Particle, bool bPin, NumericType InMass = (NumericType)1)
+	{
+		Pinned[Particle] = bPin ? 1 : 0;
+		Mass[Particle] = bPin ? (NumericType)1 : InMass;
+	}
+	// This function advances the cloth by one implicit Euler step
+	// @param TimeStep - the time step h
+	// @param bParallel - if true the system is filled by several threads, turn it off when many cloths are stepped in parallel
+	// @returns - false if there are no particles, the time step is not positive or the solve failed, the cloth is unchanged then
+	bool Step(NumericType TimeStep, bool bParallel = true)
+	{
+		const int32 NumParticles = (int32)Positions.cols();
+		if (NumParticles == 0 || BlockCounts.Num() != NumParticles || TimeStep <= (NumericType)0) {
+			return false;
+		}
+		const NumericType TimeStepSquared = TimeStep * TimeStep;
+
+		// the elastic force on the first particle of every spring and the block h^2 K + h D it adds to the system
+		FEiVHelper::ForEachRange(Springs.Num(), MinItemsPerTask, [&](int32 First, int32 Last)
+		{
+			for (int32 SpringIndex = First; SpringIndex < Last; SpringIndex++) {
+				const FSpring& Spring = Springs[SpringIndex];
+				const EiVVector3<NumericType> Delta = Positions.col(Spring.Particle0) - Positions.col(Spring.Particle1);
+				const NumericType Length = Delta.norm();
+				if (Length <= Eigen::NumTraits<NumericType>::epsilon() * (NumericType)16 * FMath::Max(Spring.RestLength, (NumericType)1)) {
+					// the direction of a collapsed spring is undefined
+					SpringForces.col(SpringIndex).setZero();
+					SpringBlocks[SpringIndex].setZero();
+					continue;
+				}
+				const EiVVector3<NumericType> Direction = Delta / Length;
+				const EiVMatrix3<NumericType> Outer = Direction * Direction.transpose();
+				SpringForces.col(SpringIndex) = -Spring.Stiffness * (Length - Spring.RestLength) * Direction;
+				// the transverse stiffness k (1 - L / l) is negative for a compressed spring and is dropped then
+				const NumericType Transverse = Spring.Stiffness * FMath::Max((NumericType)1 - Spring.RestLength / Length, (NumericType)0);
+				SpringBlocks[SpringIndex] = (TimeStepSquared * (Spring.Stiffness - Transverse) + TimeStep * Spring.Damping) * Outer;
+				SpringBlocks[SpringIndex].diagonal().array() += TimeStepSquared * Transverse;
+			}
+		}, bParallel);
+
+		// every particle writes its own block column and row of the right hand side. The matrix blocks are added
+		// with a minus sign as A = M + sum of the spring blocks on the diagonal and minus the spring block off it.
+		// The blocks coupling a pinned particle are moved to the right hand side
+		FEiVHelper::ForEachRange(NumParticles, MinItemsPerTask, [&](int32 First, int32 Last)
+		{
+			const auto* Outer = System.outerIndexPtr();
+			NumericType* Values = System.valuePtr();
+			for (int32 Particle = First; Particle < Last; Particle++) {
+				NumericType* Columns[3] = { Values + Outer[3 * Particle], Values + Outer[3 * Particle + 1], Values + Outer[3 * Particle + 2] };
+				for (int32 Axis = 0; Axis < 3; Axis++) {
+					EiVMap<EiVVectorX<NumericType>>(Columns[Axis], BlockOffset(Axis, BlockCounts[Particle])).setZero();
+				}
+				EiVVector3<NumericType> Force = EiVVector3<NumericType>::Zero();
+				EiVMatrix3<NumericType> Diagonal = EiVMatrix3<NumericType>::Identity() * Mass[Particle];
+				if (!Pinned[Particle]) {
+					Force = Mass[Particle] * Gravity;
+					for (int32 Item = ParticleStarts[Particle]; Item < ParticleStarts[Particle + 1]; Item++) {
+						const FAdjacent& Adjacent = Adjacency[Item];
+						const EiVMatrix3<NumericType>& Block = SpringBlocks[Adjacent.Spring];
+						Force += Springs[Adjacent.Spring].Particle0 == Particle ? SpringForces.col(Adjacent.Spring) : (-SpringForces.col(Adjacent.Spring)).eval();
+						Diagonal += Block;
+						if (Pinned[Adjacent.Neighbour]) {
+							Force += Block * Velocities.col(Adjacent.Neighbour) / TimeStep;
+						}
+						else if (Adjacent.Block != INDEX_NONE) {
+							for (int32 Axis = 0; Axis < 3; Axis++) {
+								EiVMap<EiVVector3<NumericType>>(Columns[Axis] + BlockOffset(Axis, Adjacent.Block)) -= Block.col(Axis);
+							}
+						}
+					}
+				}
+				for (int32 Axis = 0; Axis < 3; Axis++) {
+					for (int32 Row = Axis; Row < 3; Row++) {
+						Columns[Axis][Row - Axis] = Diagonal(Row, Axis);
+					}
+				}
+				RightHandSide.template block<3, 1>(3 * Particle, 0) = Mass[Particle] * Velocities.col(Particle) + TimeStep * Force;
+			}
+		}, bParallel);
+
+		if (!Solver.SetMatrix(System) || !Solver.Solve(RightHandSide, Solution, SolveSettings, LastStats)) {
+			return false;
+		}
+		Velocities = EiVMap<const EiVMatrix3X<NumericType>>(Solution.data(), 3, NumParticles);
+		Positions += TimeStep * Velocities;
+		return true;
+	}
+	// This function steps many independent cloths in parallel, one cloth per task
+	// @param Cloths - the cloths to step
+	// @param NumCloths - the number of cloths
+	// @param TimeStep - the time step h
+	// @returns - the number of cloths whose step failed
+	static int32 StepMany(TEiVMassSpringCloth* const* Cloths, int32 NumCloths, NumericType TimeStep)
+	{
+		std::atomic<int32> Failures(0);
+		ParallelFor(NumCloths, [&](int32 Cloth)
+		{
+			if (!Cloths[Cloth]->Step(TimeStep, false)) {
+				Failures++;
+			}
+		}, NumCloths == 1);
+		return Failures.load();
+	}
+	// This function builds a rectangular grid of particles in the XY plane with structural, shear and bend springs
+	// @param Columns - the number of particles along X
+	// @param Rows - the number of particles along Y
+	// @param Spacing - the distance between neighbouring particles
+	// @param Stiffness - the stiffness of the structural springs between direct neighbours
+	// @param ShearStiffness - the stiffness of the diagonal springs, zero leaves them out
+	// @param BendStiffness - the stiffness of the springs skipping one particle, zero leaves them out
+	// @param Damping - the damping of every spring
+	// @param OutPositions - the particle positions, particle X + Y * Columns is at (X, Y) * Spacing
+	// @param OutSprings - the springs at their rest length
+	static void MakeGrid(int32 Columns, int32 Rows, NumericType Spacing, NumericType Stiffness, NumericType ShearStiffness,
+		NumericType BendStiffness, NumericType Damping, EiVMatrix3X<NumericType>& OutPositions, TArray<FSpring>& OutSprings)
+	{
+		OutPositions.resize(3, Columns * Rows);
+		OutSprings.Reset();
+		const NumericType Diagonal = Spacing * FMath::Sqrt((NumericType)2);
+		auto AddSpring = [&](int32 Particle0, int32 Particle1, NumericType RestLength, NumericType SpringStiffness)
+		{
+			if (SpringStiffness > (NumericType)0) {
+				FSpring& Spring = OutSprings.AddDefaulted_GetRef();
+				Spring.Particle0 = Particle0;
+				Spring.Particle1 = Particle1;
+				Spring.RestLength = RestLength;
+				Spring.Stiffness = SpringStiffness;
+				Spring.Damping = Damping;
+			}
+		};
+		for (int32 Y = 0; Y < Rows; Y++) {
+			for (int32 X = 0; X < Columns; X++) {
+				const int32 Particle = X + Y * Columns;
+				OutPositions.col(Particle) = EiVVector3<NumericType>(X * Spacing, Y * Spacing, 0);
+				if (X + 1 < Columns) {
+					AddSpring(Particle, Particle + 1, Spacing, Stiffness);
+				}
+				if (Y + 1 < Rows) {
+					AddSpring(Particle, Particle + Columns, Spacing, Stiffness);
+				}
+				if (X + 1 < Columns && Y + 1 < Rows) {
+					AddSpring(Particle, Particle + Columns + 1, Diagonal, ShearStiffness);
+					AddSpring(Particle + 1, Particle + Columns, Diagonal, ShearStiffness);
+				}
+				if (X + 2 < Columns) {
+					AddSpring(Particle, Particle + 2, 2 * Spacing, BendStiffness);
+				}
+				if (Y + 2 < Rows) {
+					AddSpring(Particle, Particle + 2 * Columns, 2 * Spacing, BendStiffness);
+				}
+			}
+		}
+	}
+
+	// @returns - the iterations and error of the last velocity solve
+	const FEiVIterativeSolveStats& GetStats() const { return LastStats; }
+	// @returns - the lower triangle of the system matrix of the last step
+	const EiVSparseMatrix<NumericType>& GetSystemMatrix() const { return System; }
+	// @returns - the springs, with the rest lengths filled in
+	const TArray<FSpring>& GetSprings() const { return Springs; }
+	// @returns - true if the particle is pinned
+	bool IsPinned(int32 Particle) const { return Pinned[Particle] != 0; }
+
+private:
+	// A spring seen from one of its particles
+	struct FAdjacent
+	{
+		int32 Spring;
+		// the other particle of the spring
+		int32 Neighbour;
+		// the block of the other particle in the block column of this particle, INDEX_NONE if the other particle is lower
+		int32 Block;
+	};
+
+	static constexpr int32 MinItemsPerTask = 512;
+
+	// the offset of a block in column Axis of a particle, after the 3 - Axis entries of the diagonal block
+	static int32 BlockOffset(int32 Axis, int32 Block)
+	{
+		return 3 - Axis + 3 * (Block - 1);
+	}
+
+	TArray<FSpring> Springs;
+	EiVVectorX<NumericType> Mass;
+	// 1 for pinned particles, bytes rather than bools so the particles can be written by different threads
+	TArray<uint8> Pinned;
+	// the springs of particle P are Adjacency[ParticleStarts[P]] to Adjacency[ParticleStarts[P + 1] - 1]
+	TArray<int32> ParticleStarts;
+	TArray<FAdjacent> Adjacency;
+	// the number of 3x3 blocks in the lower block column of every particle, including the diagonal block
+	TArray<int32> BlockCounts;
+	// per step values, kept so their memory is reused
+	TArray<EiVMatrix3<NumericType>> SpringBlocks;
+	EiVMatrix3X<NumericType> SpringForces;
+	EiVSparseMatrix<NumericType> System;
+	EiVMatrixX<NumericType> RightHandSide;
+	EiVMatrixX<NumericType> Solution;
+	TEiVPersistentConjugateGradient<NumericType> Solver;
+	FEiVIterativeSolveStats LastStats;
+};
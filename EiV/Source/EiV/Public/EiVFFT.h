@@ -0,0 +1,432 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+//<><><><><><><><><><><><> EiVLibrary Import Block <><><><><><><><><><><><>
+//imports the specified headers by the macro definitions
+
+#define EIV_INCLUDE_DENSE_MATRIX_ARRAY    //includes most core and basic features
+#define EIV_UNDEFINE_INCLUDES             //ensures that these include macros above are local to this file
+
+#include "EiVLibrary.h"   //takes the EIV_INCLUDE macros as settings and retrieves
+                          //the specified Eigen modules, typedefs, and helper functions
+//<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>
+#include "Async/ParallelFor.h"
+
+/*
+* Fast Fourier transforms and FFT based convolution of dense Eigen matrices. Power of two lengths use an iterative
+* radix-2 transform, every other length is turned into a power of two circular convolution (Bluestein's algorithm),
+* so all lengths are O(n log n). The forward transform is unscaled and the inverse transform is scaled by 1/n.
+* Real signals are transformed with a complex transform of half their length, giving the n/2+1 non-redundant bins.
+*/
+
+// The precomputed tables of a complex FFT of one length. Building a plan costs about as much as one transform, so
+// keep plans around when transforming many signals of the same length. A plan is read only after Init, so one plan
+// can be shared by several threads.
+template<typename NumericType = double>
+class TEiVFFTPlan
+{
+public:
+	typedef std::complex<NumericType> ComplexType;
+
+	TEiVFFTPlan() {}
+	explicit TEiVFFTPlan(int32 InLength)
+	{
+		Init(InLength);
+	}
+
+	// This function builds the tables for a new length
+	// @param InLength - the number of values in each transformed signal
+	void Init(int32 InLength)
+	{
+		Length = FMath::Max(InLength, 0);
+		if (Length <= 1) {
+			RadixLength = Length;
+			return;
+		}
+		if (FMath::IsPowerOfTwo(Length)) {
+			RadixLength = Length;
+			BuildRadixTables();
+			Chirp.resize(0);
+			ChirpFilter.resize(0);
+			return;
+		}
+		// Bluestein: X_k = w_k * sum_j (x_j * w_j) * conj(w_{k-j}) with w_k = exp(-i*pi*k^2/n), which is a circular
+		// convolution once padded to a power of two of at least 2n-1
+		RadixLength = (int32)FMath::RoundUpToPowerOfTwo((uint32)(2 * Length - 1));
+		BuildRadixTables();
+		Chirp.resize(Length);
+		for (int64 k = 0; k < Length; k++) {
+			// k^2 mod 2n keeps the angle exact for long signals
+			const int64 Phase = (k * k) % (2 * (int64)Length);
+			const double Angle = -UE_DOUBLE_PI * (double)Phase / (double)Length;
+			Chirp(k) = ComplexType((NumericType)FMath::Cos(Angle), (NumericType)FMath::Sin(Angle));
+		}
+		ChirpFilter = EiVVectorX<ComplexType>::Zero(RadixLength);
+		ChirpFilter(0) = std::conj(Chirp(0));
+		for (int32 k = 1; k < Length; k++) {
+			ChirpFilter(k) = ChirpFilter(RadixLength - k) = std::conj(Chirp(k));
+		}
+		Radix2(ChirpFilter.data(), false);
+	}
+
+	// @returns - the number of values in each transformed signal
+	int32 GetLength() const
+	{
+		return Length;
+	}
+
+	// This function transforms a signal in place
+	// @param Data - Length contiguous values
+	// @param bInverse - if true the inverse transform (scaled by 1/Length) is computed
+	void Transform(ComplexType* Data, bool bInverse) const
+	{
+		if (Length <= 1) {
+			return;
+		}
+		if (Chirp.size() == 0) {
+			Radix2(Data, bInverse);
+		}
+		else {
+			Bluestein(Data, bInverse);
+		}
+		if (bInverse) {
+			Eigen::Map<EiVVectorX<ComplexType>>(Data, Length) *= (NumericType)1 / (NumericType)Length;
+		}
+	}
+
+private:
+	void BuildRadixTables()
+	{
+		BitReverse.SetNumUninitialized(RadixLength);
+		const int32 Bits = FMath::FloorLog2(RadixLength);
+		for (int32 i = 0; i < RadixLength; i++) {
+			int32 Reversed = 0;
+			for (int32 Bit = 0; Bit < Bits; Bit++) {
+				Reversed |= ((i >> Bit) & 1) << (Bits - 1 - Bit);
+			}
+			BitReverse[i] = Reversed;
+		}
+		Twiddles.resize(RadixLength / 2);
+		for (int32 k = 0; k < RadixLength / 2; k++) {
+			const double Angle = -2.0 * UE_DOUBLE_PI * (double)k / (double)RadixLength;
+			Twiddles(k) = ComplexType((NumericType)FMath::Cos(Angle), (NumericType)FMath::Sin(Angle));
+		}
+	}
+
+	// unscaled in place radix-2 transform of RadixLength values
+	void Radix2(ComplexType* Data, bool bInverse) const
+	{
+		for (int32 i = 0; i < RadixLength; i++) {
+			if (i < BitReverse[i]) {
+				Swap(Data[i], Data[BitReverse[i]]);
+			}
+		}
+		for (int32 Size = 2; Size <= RadixLength; Size <<= 1) {
+			const int32 Half = Size >> 1;
+			const int32 Step = RadixLength / Size;
+			for (int32 Start = 0; Start < RadixLength; Start += Size) {
+				ComplexType* Even = Data + Start;
+				ComplexType* Odd = Even + Half;
+				for (int32 k = 0; k < Half; k++) {
+					const ComplexType W = bInverse ? std::conj(Twiddles(k * Step)) : Twiddles(k * Step);
+					const ComplexType T = W * Odd[k];
+					Odd[k] = Even[k] - T;
+					Even[k] += T;
+				}
+			}
+		}
+	}
+
+	// unscaled transform of any length through a power of two circular convolution
+	void Bluestein(ComplexType* Data, bool bInverse) const
+	{
+		// the inverse transform is conj(forward(conj(x)))
+		Eigen::Map<EiVVectorX<ComplexType>> Signal(Data, Length);
+		EiVVectorX<ComplexType> Work = EiVVectorX<ComplexType>::Zero(RadixLength);
+		if (bInverse) {
+			Work.head(Length) = Signal.conjugate().cwiseProduct(Chirp);
+		}
+		else {
+			Work.head(Length) = Signal.cwiseProduct(Chirp);
+		}
+		Radix2(Work.data(), false);
+		Work = Work.cwiseProduct(ChirpFilter);
+		Radix2(Work.data(), true);
+		const NumericType Scale = (NumericType)1 / (NumericType)RadixLength;
+		if (bInverse) {
+			Signal = (Work.head(Length).cwiseProduct(Chirp) * Scale).conjugate();
+		}
+		else {
+			Signal = Work.head(Length).cwiseProduct(Chirp) * Scale;
+		}
+	}
+
+	int32 Length = 0;
+	int32 RadixLength = 0;
+	TArray<int32> BitReverse;
+	EiVVectorX<ComplexType> Twiddles;
+	EiVVectorX<ComplexType> Chirp;
+	EiVVectorX<ComplexType> ChirpFilter;
+};
+
+/*
+* FFT and convolution functions working on the columns of dense Eigen matrices.
+* For this whole struct the <NumericType> is the datatype of the real numbers, the complex values are std::complex<NumericType>.
+*/
+struct EIV_API FEiVFFT
+{
+	// The smallest number of values worth a worker thread when transforming many columns
+	static constexpr int64 MinValuesPerChunk = 16384;
+	// Convolutions where the shorter input has at most this many values are computed directly, which beats the FFT
+	static constexpr int32 DirectConvolutionMaxKernel = 32;
+
+	// This function transforms every column of a complex matrix in place
+	// @param Data - the signals to transform, one per column
+	// @param bInverse - if true the inverse transform (scaled by 1/rows) is computed
+	template<typename NumericType = double>
+	static void TransformColumns(EiVMatrixX<std::complex<NumericType>>& Data, bool bInverse)
+	{
+		const TEiVFFTPlan<NumericType> Plan((int32)Data.rows());
+		FEiVFFT::TransformColumns(Plan, Data, bInverse);
+	}
+	// This function transforms every column of a complex matrix in place with an existing plan
+	// @param Plan - a plan with the same length as the rows of Data
+	// @param Data - the signals to transform, one per column
+	// @param bInverse - if true the inverse transform (scaled by 1/rows) is computed
+	// @returns - false if the plan does not match the rows of Data
+	template<typename NumericType = double>
+	static bool TransformColumns(const TEiVFFTPlan<NumericType>& Plan, EiVMatrixX<std::complex<NumericType>>& Data, bool bInverse)
+	{
+		if (Plan.GetLength() != Data.rows()) {
+			return false;
+		}
+		const int32 Cols = (int32)Data.cols();
+		const int32 NumChunks = FMath::Min<int32>(FEiVHelper::GetParallelChunkCount((int64)Data.size(), MinValuesPerChunk), FMath::Max(Cols, 1));
+		ParallelFor(NumChunks, [&](int32 Chunk)
+		{
+			const int32 First = (int32)((int64)Cols * Chunk / NumChunks);
+			const int32 Last = (int32)((int64)Cols * (Chunk + 1) / NumChunks);
+			for (int32 Col = First; Col < Last; Col++) {
+				Plan.Transform(Data.col(Col).data(), bInverse);
+			}
+		}, NumChunks == 1);
+		return true;
+	}
+	// This function computes the 2D transform of a complex matrix in place (the columns, then the rows)
+	// @param Data - the 2D signal to transform
+	// @param bInverse - if true the inverse transform (scaled by 1/(rows*cols)) is computed
+	template<typename NumericType = double>
+	static void Transform2D(EiVMatrixX<std::complex<NumericType>>& Data, bool bInverse)
+	{
+		FEiVFFT::TransformColumns(Data, bInverse);
+		// the rows are strided in a column-major matrix, transposing keeps every transform contiguous
+		EiVMatrixX<std::complex<NumericType>> Transposed = Data.transpose();
+		FEiVFFT::TransformColumns(Transposed, bInverse);
+		Data = Transposed.transpose();
+	}
+	// This function computes the transform of every column of a real matrix. Real signals have conjugate symmetric
+	// spectra, so only the first rows/2+1 bins are returned.
+	// @param InData - the real signals to transform, one per column
+	// @param OutSpectrum - the rows/2+1 non-redundant bins of every column
+	template<typename NumericType = double>
+	static void RealForward(const EiVMatrixX<NumericType>& InData, EiVMatrixX<std::complex<NumericType>>& OutSpectrum)
+	{
+		typedef std::complex<NumericType> ComplexType;
+		const int32 Length = (int32)InData.rows();
+		const int32 Bins = Length / 2 + 1;
+		if (Length == 0) {
+			OutSpectrum.resize(0, InData.cols());
+			return;
+		}
+		if (Length % 2 != 0) {
+			EiVMatrixX<ComplexType> Full = InData.template cast<ComplexType>();
+			FEiVFFT::TransformColumns(Full, false);
+			OutSpectrum = Full.topRows(Bins);
+			return;
+		}
+		// pack the even and odd samples into one complex signal of half the length, then untangle the two spectra
+		const int32 Half = Length / 2;
+		const TEiVFFTPlan<NumericType> Plan(Half);
+		EiVMatrixX<ComplexType> Packed(Half, InData.cols());
+		for (int64 Col = 0; Col < InData.cols(); Col++) {
+			for (int32 i = 0; i < Half; i++) {
+				Packed(i, Col) = ComplexType(InData(2 * i, Col), InData(2 * i + 1, Col));
+			}
+		}
+		FEiVFFT::TransformColumns(Plan, Packed, false);
+		const EiVVectorX<ComplexType> Twiddles = FEiVFFT::HalfTwiddles<NumericType>(Length, false);
+		OutSpectrum.resize(Bins, InData.cols());
+		for (int64 Col = 0; Col < InData.cols(); Col++) {
+			for (int32 k = 0; k < Bins; k++) {
+				const ComplexType Z = Packed(k % Half, Col);
+				const ComplexType ZMirror = std::conj(Packed((Half - k) % Half, Col));
+				const ComplexType Even = (Z + ZMirror) * (NumericType)0.5;
+				const ComplexType Odd = (Z - ZMirror) * ComplexType(0, (NumericType)-0.5);
+				OutSpectrum(k, Col) = Even + Twiddles(k) * Odd;
+			}
+		}
+	}
+	// This function computes the inverse of RealForward
+	// @param InSpectrum - the Length/2+1 non-redundant bins of every column
+	// @param Length - the length of the real signals, InSpectrum must have Length/2+1 rows
+	// @param OutData - the real signals, one per column
+	// @returns - false if InSpectrum does not have Length/2+1 rows
+	template<typename NumericType = double>
+	static bool RealInverse(const EiVMatrixX<std::complex<NumericType>>& InSpectrum, int32 Length, EiVMatrixX<NumericType>& OutData)
+	{
+		typedef std::complex<NumericType> ComplexType;
+		if (Length <= 0 || InSpectrum.rows() != Length / 2 + 1) {
+			return false;
+		}
+		if (Length % 2 != 0) {
+			// rebuild the redundant half from the conjugate symmetry
+			EiVMatrixX<ComplexType> Full(Length, InSpectrum.cols());
+			Full.topRows(InSpectrum.rows()) = InSpectrum;
+			for (int32 k = (int32)InSpectrum.rows(); k < Length; k++) {
+				Full.row(k) = InSpectrum.row(Length - k).conjugate();
+			}
+			FEiVFFT::TransformColumns(Full, true);
+			OutData = Full.real();
+			return true;
+		}
+		const int32 Half = Length / 2;
+		const TEiVFFTPlan<NumericType> Plan(Half);
+		const EiVVectorX<ComplexType> Twiddles = FEiVFFT::HalfTwiddles<NumericType>(Length, true);
+		EiVMatrixX<ComplexType> Packed(Half, InSpectrum.cols());
+		for (int64 Col = 0; Col < InSpectrum.cols(); Col++) {
+			for (int32 k = 0; k < Half; k++) {
+				const ComplexType X = InSpectrum(k, Col);
+				const ComplexType XMirror = std::conj(InSpectrum(Half - k, Col));
+				const ComplexType Even = (X + XMirror) * (NumericType)0.5;
+				const ComplexType Odd = (X - XMirror) * (NumericType)0.5 * Twiddles(k);
+				Packed(k, Col) = Even + ComplexType(0, 1) * Odd;
+			}
+		}
+		FEiVFFT::TransformColumns(Plan, Packed, true);
+		OutData.resize(Length, InSpectrum.cols());
+		for (int64 Col = 0; Col < InSpectrum.cols(); Col++) {
+			for (int32 i = 0; i < Half; i++) {
+				OutData(2 * i, Col) = Packed(i, Col).real();
+				OutData(2 * i + 1, Col) = Packed(i, Col).imag();
+			}
+		}
+		return true;
+	}
+	// This function computes the full linear convolution of two real signals, Signal.size() + Kernel.size() - 1 values.
+	// Short kernels are convolved directly, everything else through a power of two FFT.
+	// @param Signal - the first signal
+	// @param Kernel - the second signal
+	// @param OutResult - the convolution, empty if either input is empty
+	template<typename NumericType = double>
+	static void Convolve(const EiVVectorX<NumericType>& Signal, const EiVVectorX<NumericType>& Kernel, EiVVectorX<NumericType>& OutResult)
+	{
+		typedef std::complex<NumericType> ComplexType;
+		if (Signal.size() == 0 || Kernel.size() == 0) {
+			OutResult.resize(0);
+			return;
+		}
+		const int32 OutLength = (int32)(Signal.size() + Kernel.size() - 1);
+		if (FMath::Min(Signal.size(), Kernel.size()) <= DirectConvolutionMaxKernel) {
+			const bool bSignalLonger = Signal.size() >= Kernel.size();
+			const EiVVectorX<NumericType>& Long = bSignalLonger ? Signal : Kernel;
+			const EiVVectorX<NumericType>& Short = bSignalLonger ? Kernel : Signal;
+			OutResult = EiVVectorX<NumericType>::Zero(OutLength);
+			for (int64 Tap = 0; Tap < Short.size(); Tap++) {
+				OutResult.segment(Tap, Long.size()) += Short(Tap) * Long;
+			}
+			return;
+		}
+		// both real inputs share one complex transform: z = signal + i*kernel
+		const int32 Padded = (int32)FMath::RoundUpToPowerOfTwo((uint32)OutLength);
+		EiVMatrixX<ComplexType> Packed = EiVMatrixX<ComplexType>::Zero(Padded, 1);
+		Packed.col(0).head(Signal.size()).real() = Signal;
+		Packed.col(0).head(Kernel.size()).imag() = Kernel;
+		const TEiVFFTPlan<NumericType> Plan(Padded);
+		Plan.Transform(Packed.data(), false);
+		FEiVFFT::MultiplyPackedSpectra<NumericType>(Packed);
+		Plan.Transform(Packed.data(), true);
+		OutResult = Packed.col(0).head(OutLength).real();
+	}
+	// This function computes the full 2D linear convolution of two real matrices,
+	// (Signal.rows() + Kernel.rows() - 1) x (Signal.cols() + Kernel.cols() - 1) values.
+	// Small kernels are convolved directly, everything else through a power of two 2D FFT.
+	// @param Signal - the first matrix
+	// @param Kernel - the second matrix
+	// @param OutResult - the convolution, empty if either input is empty
+	template<typename NumericType = double>
+	static void Convolve2D(const EiVMatrixX<NumericType>& Signal, const EiVMatrixX<NumericType>& Kernel, EiVMatrixX<NumericType>& OutResult)
+	{
+		typedef std::complex<NumericType> ComplexType;
+		if (Signal.size() == 0 || Kernel.size() == 0) {
+			OutResult.resize(0, 0);
+			return;
+		}
+		const int32 OutRows = (int32)(Signal.rows() + Kernel.rows() - 1);
+		const int32 OutCols = (int32)(Signal.cols() + Kernel.cols() - 1);
+		if (FMath::Min(Signal.size(), Kernel.size()) <= DirectConvolutionMaxKernel) {
+			const bool bSignalLarger = Signal.size() >= Kernel.size();
+			const EiVMatrixX<NumericType>& Large = bSignalLarger ? Signal : Kernel;
+			const EiVMatrixX<NumericType>& Small = bSignalLarger ? Kernel : Signal;
+			OutResult = EiVMatrixX<NumericType>::Zero(OutRows, OutCols);
+			for (int64 Col = 0; Col < Small.cols(); Col++) {
+				for (int64 Row = 0; Row < Small.rows(); Row++) {
+					OutResult.block(Row, Col, Large.rows(), Large.cols()) += Small(Row, Col) * Large;
+				}
+			}
+			return;
+		}
+		const int32 PaddedRows = (int32)FMath::RoundUpToPowerOfTwo((uint32)OutRows);
+		const int32 PaddedCols = (int32)FMath::RoundUpToPowerOfTwo((uint32)OutCols);
+		EiVMatrixX<ComplexType> Packed = EiVMatrixX<ComplexType>::Zero(PaddedRows, PaddedCols);
+		Packed.topLeftCorner(Signal.rows(), Signal.cols()).real() = Signal;
+		Packed.topLeftCorner(Kernel.rows(), Kernel.cols()).imag() = Kernel;
+		FEiVFFT::Transform2D(Packed, false);
+		FEiVFFT::MultiplyPackedSpectra<NumericType>(Packed);
+		FEiVFFT::Transform2D(Packed, true);
+		OutResult = Packed.topLeftCorner(OutRows, OutCols).real();
+	}
+
+private:
+	// exp(-+2*pi*i*k/Length) for k in [0, Length/2]
+	template<typename NumericType>
+	static EiVVectorX<std::complex<NumericType>> HalfTwiddles(int32 Length, bool bInverse)
+	{
+		EiVVectorX<std::complex<NumericType>> Twiddles(Length / 2 + 1);
+		for (int32 k = 0; k <= Length / 2; k++) {
+			const double Angle = (bInverse ? 2.0 : -2.0) * UE_DOUBLE_PI * (double)k / (double)Length;
+			Twiddles(k) = std::complex<NumericType>((NumericType)FMath::Cos(Angle), (NumericType)FMath::Sin(Angle));
+		}
+		return Twiddles;
+	}
+	// Z is the spectrum of a + i*b, so A = (Z_k + conj(Z_-k))/2, B = (Z_k - conj(Z_-k))/2i and A*B = (Z_k^2 - conj(Z_-k)^2)/4i.
+	// Replaces Z with A*B, the spectrum of the circular convolution of a and b. Works for 1D (one column) and 2D spectra.
+	template<typename NumericType>
+	static void MultiplyPackedSpectra(EiVMatrixX<std::complex<NumericType>>& Spectrum)
+	{
+		typedef std::complex<NumericType> ComplexType;
+		const int64 Rows = Spectrum.rows();
+		const int64 Cols = Spectrum.cols();
+		const ComplexType Quarter(0, (NumericType)-0.25); // 1/4i
+		// each pair (k, -k) is updated together, so the mirrored value is still the original one
+		for (int64 Col = 0; Col < Cols; Col++) {
+			const int64 MirrorCol = (Cols - Col) % Cols;
+			for (int64 Row = 0; Row < Rows; Row++) {
+				const int64 MirrorRow = (Rows - Row) % Rows;
+				if (MirrorCol < Col || (MirrorCol == Col && MirrorRow < Row)) {
+					continue;
+				}
+				const ComplexType Z = Spectrum(Row, Col);
+				const ComplexType ZMirror = Spectrum(MirrorRow, MirrorCol);
+				Spectrum(Row, Col) = (Z * Z - std::conj(ZMirror) * std::conj(ZMirror)) * Quarter;
+				Spectrum(MirrorRow, MirrorCol) = (ZMirror * ZMirror - std::conj(Z) * std::conj(Z)) * Quarter;
+			}
+		}
+	}
+};
@@ -0,0 +1,57 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+#include "CoreTypes.h"
+
+/*
+* Forward declarations of the EiV Blueprint types and solver interfaces, without any Eigen include.
+* Headers which only pass these types by reference or pointer (plain C++ functions, members behind a pointer)
+* can include this file instead of EiVBPLibrary.h and leave the Eigen include to their .cpp files.
+* UFUNCTION and UPROPERTY declarations still need the full definitions, so include EiVBPLibrary.h for those.
+*/
+
+// Blueprint structs (EiVBPLibrary.h)
+struct FEiVQuaternion;
+struct FEiVUniformScaling;
+struct FEiVRotation2D;
+struct FEiVAngleAxis;
+struct FEiVTranslation;
+struct FEiVAxisAlignedBox;
+struct FEiVParameterizedLine;
+struct FEiVComplexNumber;
+struct FEiVArray;
+struct FEiVTriplet;
+struct FEiVJacobiRotation;
+struct FEiVVector;
+struct FEiVRowVector;
+struct FEiVSparseVector;
+struct FEiVNullMatrix;
+struct FEiVMatrix;
+struct FEiVSparseMatrix;
+struct FEiVRowMajorSparseMatrix;
+struct FEiVDynamicMatrix;
+struct FEiVRowMajorDynamicMatrix;
+struct FEiVDynamicComplexMatrix;
+struct FEiVDynamicVector;
+struct FEiVIterativeSolver;
+struct FEiVSparseDirectSolver;
+
+// Blueprint enums (EiVBPLibrary.h)
+enum class EEiVBPFuncSuccess : uint8;
+enum class EEiVIterativeSolverType : uint8;
+enum class EEiVIterativePreconditioner : uint8;
+enum class EEiVSparseDirectSolverType : uint8;
+enum class EEiVSparseOrdering : uint8;
+enum class EEiVTextMatrixFormat : uint8;
+enum class EEiVConvolutionMode : uint8;
+
+// Solver interfaces held by the Blueprint solver structs (EiVIterativeSolvers.h, EiVSparseDirectSolvers.h)
+template<typename NumericType> class IEiVIterativeSolver;
+template<typename NumericType> class IEiVSparseDirectSolver;
@@ -0,0 +1,301 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+//<><><><><><><><><><><><> EiVLibrary Import Block <><><><><><><><><><><><>
+//imports the specified headers by the macro definitions
+
+#define EIV_INCLUDE_DENSE_MATRIX_ARRAY    //includes most core and basic features
+#define EIV_INCLUDE_GEOMETRY              //includes geometric utilities
+#define EIV_INCLUDE_CHOLESKY              //includes the LLT and LDLT decompositions
+#define EIV_UNDEFINE_INCLUDES             //ensures that these include macros above are local to this file
+
+#include "EiVLibrary.h"   //takes the EIV_INCLUDE macros as settings and retrieves
+                          //the specified Eigen modules, typedefs, and helper functions
+//<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>
+#include "EiVLieGroups.h"
+
+/*
+* A damped least squares inverse kinematics solver for joint chains and trees. Every joint is one revolute degree of
+* freedom about a local axis, a ball joint is three joints with zero offsets. Tasks pull a point on a joint towards a target
+* position, and optionally the joint's rotation towards a target rotation.
+* Every iteration assembles the task Jacobian J and solves dq = J^T (J J^T + lambda^2 D)^-1 e with one LDLT, where D holds
+* the per-task damping factors so that hard to reach tasks can be damped more than the others. The joint step is clamped to
+* MaxStep, and a secondary objective (pulling towards the rest angles) is projected into the nullspace of the tasks.
+* Init sizes every workspace matrix for the rig, after that Solve does not allocate. Solvers are independent, so
+* SolveParallel runs the solvers of many characters on worker threads.
+* For this whole class the <NumericType> is the datatype of the numbers stored in the Eigen types.
+*/
+template<typename NumericType = double>
+class TEiVIKSolver
+{
+public:
+	// One revolute degree of freedom. The joint's frame is its parent's frame moved by Offset, rotated by RestRotation
+	// and then by the joint angle about Axis.
+	struct FJoint
+	{
+		// the index of the parent joint, which must come before this joint, or INDEX_NONE for a root
+		int32 Parent = INDEX_NONE;
+		// the translation from the parent joint, in the parent's frame
+		EiVVector3<NumericType> Offset = EiVVector3<NumericType>::Zero();
+		// the rotation from the parent's frame at zero angle
+		EiVQuaternion<NumericType> RestRotation = EiVQuaternion<NumericType>::Identity();
+		// the rotation axis in the joint's frame
+		EiVVector3<NumericType> Axis = EiVVector3<NumericType>::UnitZ();
+		// the angle limits in radians
+		NumericType MinAngle = -std::numeric_limits<NumericType>::infinity();
+		NumericType MaxAngle = std::numeric_limits<NumericType>::infinity();
+		// the angle the nullspace objective pulls towards
+		NumericType RestAngle = 0;
+	};
+
+	// A goal for a point on a joint
+	struct FTask
+	{
+		// the joint the point is attached to
+		int32 Joint = 0;
+		// the point in the joint's frame
+		EiVVector3<NumericType> LocalPoint = EiVVector3<NumericType>::Zero();
+		// the target of the point, in the root's frame
+		EiVVector3<NumericType> TargetPosition = EiVVector3<NumericType>::Zero();
+		// the target of the joint's rotation, only used if bRotation is true
+		EiVQuaternion<NumericType> TargetRotation = EiVQuaternion<NumericType>::Identity();
+		bool bRotation = false;
+		// the importance of the task, its error and Jacobian rows are scaled by it
+		NumericType Weight = 1;
+		// the multiplier of the damping for this task's rows
+		NumericType DampingScale = 1;
+	};
+
+	// the joint angles in radians, the solution of Solve
+	EiVVectorX<NumericType> Angles;
+	// the damping lambda, larger values are more stable near singular poses but converge slower
+	NumericType Damping = (NumericType)0.1;
+	// the largest change of any joint angle in one iteration, in radians
+	NumericType MaxStep = (NumericType)0.5;
+	// the gain of the secondary objective, 0 disables it
+	NumericType NullspaceGain = 0;
+
+	// This function sets up the rig and sizes all the workspace, the angles become the rest angles
+	// @param InJoints - the joints, parents before their children
+	// @param InTasks - the tasks
+	// @returns - false if a parent or task joint index is invalid
+	bool Init(const TArray<FJoint>& InJoints, const TArray<FTask>& InTasks)
+	{
+		for (int32 Index = 0; Index < InJoints.Num(); Index++) {
+			if (InJoints[Index].Parent != INDEX_NONE && (InJoints[Index].Parent < 0 || InJoints[Index].Parent >= Index)) {
+				return false;
+			}
+		}
+		for (const FTask& Task : InTasks) {
+			if (Task.Joint < 0 || Task.Joint >= InJoints.Num()) {
+				return false;
+			}
+		}
+		Joints = InJoints;
+		Tasks = InTasks;
+		const int32 NumJoints = Joints.Num();
+		int32 NumRows = 0;
+		for (FJoint& Joint : Joints) {
+			Joint.Axis.normalize();
+		}
+		// the joints which move each task's point, the only nonzero Jacobian columns of its rows
+		TaskChainStarts.SetNum(Tasks.Num() + 1);
+		TaskChains.Reset();
+		for (int32 TaskIndex = 0; TaskIndex < Tasks.Num(); TaskIndex++) {
+			TaskChainStarts[TaskIndex] = TaskChains.Num();
+			for (int32 Joint = Tasks[TaskIndex].Joint; Joint != INDEX_NONE; Joint = Joints[Joint].Parent) {
+				TaskChains.Add(Joint);
+			}
+			NumRows += Tasks[TaskIndex].bRotation ? 6 : 3;
+		}
+		TaskChainStarts[Tasks.Num()] = TaskChains.Num();
+
+		Angles.resize(NumJoints);
+		for (int32 Index = 0; Index < NumJoints; Index++) {
+			Angles[Index] = Joints[Index].RestAngle;
+		}
+		Positions.resize(3, NumJoints);
+		Rotations.resize(4, NumJoints);
+		WorldAxes.resize(3, NumJoints);
+		Jacobian.setZero(NumRows, NumJoints);
+		Error.resize(NumRows);
+		DampingDiagonal.resize(NumRows);
+		Normal.resize(NumRows, NumRows);
+		Multipliers.resize(NumRows);
+		Step.resize(NumJoints);
+		Secondary.resize(NumJoints);
+		LDLT = EiVLDLT<EiVMatrixX<NumericType>>(NumRows);
+		ForwardKinematics();
+		return true;
+	}
+
+	// This function moves the target of a task
+	// @param TaskIndex - the task
+	// @param Position - the target of the task's point
+	// @param Rotation - the target rotation, ignored by position only tasks
+	void SetTarget(int32 TaskIndex, const EiVVector3<NumericType>& Position, const EiVQuaternion<NumericType>& Rotation = EiVQuaternion<NumericType>::Identity())
+	{
+		Tasks[TaskIndex].TargetPosition = Position;
+		Tasks[TaskIndex].TargetRotation = Rotation.normalized();
+	}
+
+	// This function iterates damped least squares steps from the current angles
+	// @param MaxIterations - the largest number of iterations
+	// @param Tolerance - the solve stops once the norm of the weighted task error is below this
+	// @returns - the weighted task error norm at the final angles
+	NumericType Solve(int32 MaxIterations, NumericType Tolerance)
+	{
+		ForwardKinematics();
+		NumericType ErrorNorm = ComputeErrorAndJacobian();
+		for (int32 Iteration = 0; Iteration < MaxIterations && ErrorNorm > Tolerance; Iteration++) {
+			if (!ComputeStep()) {
+				break;
+			}
+			Angles += Step;
+			for (int32 Index = 0; Index < Joints.Num(); Index++) {
+				Angles[Index] = FMath::Clamp(Angles[Index], Joints[Index].MinAngle, Joints[Index].MaxAngle);
+			}
+			ForwardKinematics();
+			ErrorNorm = ComputeErrorAndJacobian();
+		}
+		return ErrorNorm;
+	}
+
+	// This function runs Solve on many independent solvers, spread over worker threads
+	// @param Solvers - Count solvers
+	// @param Count - the number of solvers
+	// @param MaxIterations - see Solve
+	// @param Tolerance - see Solve
+	static void SolveParallel(TEiVIKSolver* Solvers, int32 Count, int32 MaxIterations, NumericType Tolerance)
+	{
+		FEiVHelper::ForEachRange(Count, MinSolversPerTask, [&](int32 First, int32 Last)
+		{
+			for (int32 Index = First; Index < Last; Index++) {
+				Solvers[Index].Solve(MaxIterations, Tolerance);
+			}
+		});
+	}
+
+	// This function updates the joint positions and rotations from the angles, Solve calls it itself
+	void ForwardKinematics()
+	{
+		for (int32 Index = 0; Index < Joints.Num(); Index++) {
+			const FJoint& Joint = Joints[Index];
+			const EiVQuaternion<NumericType> Local = Joint.RestRotation * EiVQuaternion<NumericType>(EiVAngleAxis<NumericType>(Angles[Index], Joint.Axis));
+			EiVMap<EiVQuaternion<NumericType>> Rotation(Rotations.col(Index).data());
+			if (Joint.Parent == INDEX_NONE) {
+				Positions.col(Index) = Joint.Offset;
+				Rotation = Local;
+			}
+			else {
+				const EiVMap<const EiVQuaternion<NumericType>> ParentRotation(Rotations.col(Joint.Parent).data());
+				Positions.col(Index) = Positions.col(Joint.Parent) + ParentRotation * Joint.Offset;
+				Rotation = ParentRotation * Local;
+			}
+			WorldAxes.col(Index) = Rotation * Joint.Axis;
+		}
+	}
+
+	// @returns - the position of a joint in the root's frame, after the last Solve or ForwardKinematics
+	EiVVector3<NumericType> GetJointPosition(int32 Index) const { return Positions.col(Index); }
+	// @returns - the rotation of a joint in the root's frame, after the last Solve or ForwardKinematics
+	EiVQuaternion<NumericType> GetJointRotation(int32 Index) const { return EiVMap<const EiVQuaternion<NumericType>>(Rotations.col(Index).data()); }
+	// @returns - the weighted task Jacobian of the last iteration, 3 rows per position and 3 more per rotation task
+	const EiVMatrixX<NumericType>& GetJacobian() const { return Jacobian; }
+
+private:
+	// The smallest number of solvers worth a worker thread
+	static constexpr int32 MinSolversPerTask = 4;
+	// The number of times the damped nullspace projector is applied to the secondary objective
+	static constexpr int32 NullspaceProjections = 4;
+
+	TArray<FJoint> Joints;
+	TArray<FTask> Tasks;
+	// the ancestors of every task's joint, task i owns TaskChains[TaskChainStarts[i] .. TaskChainStarts[i + 1])
+	TArray<int32> TaskChains;
+	TArray<int32> TaskChainStarts;
+
+	// world joint frames, one per column (rotations as x y z w)
+	EiVMatrix<NumericType, 3, EiVDynamic> Positions;
+	EiVMatrix<NumericType, 4, EiVDynamic> Rotations;
+	EiVMatrix<NumericType, 3, EiVDynamic> WorldAxes;
+	// solve workspace, sized by Init
+	EiVMatrixX<NumericType> Jacobian;
+	EiVVectorX<NumericType> Error;
+	EiVVectorX<NumericType> DampingDiagonal;
+	EiVMatrixX<NumericType> Normal;
+	EiVVectorX<NumericType> Multipliers;
+	EiVVectorX<NumericType> Step;
+	EiVVectorX<NumericType> Secondary;
+	EiVLDLT<EiVMatrixX<NumericType>> LDLT;
+
+	// fills the weighted error and Jacobian rows of every task, returns the error norm
+	NumericType ComputeErrorAndJacobian()
+	{
+		int32 Row = 0;
+		for (int32 TaskIndex = 0; TaskIndex < Tasks.Num(); TaskIndex++) {
+			const FTask& Task = Tasks[TaskIndex];
+			const EiVMap<const EiVQuaternion<NumericType>> Rotation(Rotations.col(Task.Joint).data());
+			const EiVVector3<NumericType> Point = Positions.col(Task.Joint) + Rotation * Task.LocalPoint;
+			Error.template segment<3>(Row) = Task.Weight * (Task.TargetPosition - Point);
+			DampingDiagonal.template segment<3>(Row).setConstant(Task.DampingScale);
+			for (int32 Chain = TaskChainStarts[TaskIndex]; Chain < TaskChainStarts[TaskIndex + 1]; Chain++) {
+				const int32 Joint = TaskChains[Chain];
+				Jacobian.template block<3, 1>(Row, Joint) = Task.Weight * WorldAxes.col(Joint).cross(Point - Positions.col(Joint));
+			}
+			Row += 3;
+			if (Task.bRotation) {
+				Error.template segment<3>(Row) = Task.Weight * FEiVLieGroups::SO3Log<NumericType>(Task.TargetRotation * EiVQuaternion<NumericType>(Rotation).conjugate());
+				DampingDiagonal.template segment<3>(Row).setConstant(Task.DampingScale);
+				for (int32 Chain = TaskChainStarts[TaskIndex]; Chain < TaskChainStarts[TaskIndex + 1]; Chain++) {
+					const int32 Joint = TaskChains[Chain];
+					Jacobian.template block<3, 1>(Row, Joint) = Task.Weight * WorldAxes.col(Joint);
+				}
+				Row += 3;
+			}
+		}
+		return Error.norm();
+	}
+
+	// dq = J^T (J J^T + lambda^2 D)^-1 e plus the nullspace projection of the secondary objective, clamped to MaxStep
+	bool ComputeStep()
+	{
+		// only the lower triangle is filled, which is the half LDLT reads
+		Normal.setZero();
+		Normal.template selfadjointView<Eigen::Lower>().rankUpdate(Jacobian);
+		Normal.diagonal() += (Damping * Damping) * DampingDiagonal;
+		LDLT.compute(Normal);
+		if (LDLT.info() != Eigen::Success) {
+			return false;
+		}
+		Multipliers = Error;
+		LDLT.solveInPlace(Multipliers);
+		Step.noalias() = Jacobian.transpose() * Multipliers;
+		if (NullspaceGain > 0) {
+			// the damped projector z - J^T (J J^T + lambda^2 D)^-1 J z only shrinks the part of z which would disturb the
+			// tasks by lambda^2 / (sigma^2 + lambda^2) per singular value sigma, applying it again shrinks that part further
+			// (so the tasks still converge) while directions near a singularity stay bounded
+			for (int32 Index = 0; Index < Joints.Num(); Index++) {
+				Secondary[Index] = NullspaceGain * (Joints[Index].RestAngle - Angles[Index]);
+			}
+			for (int32 Projection = 0; Projection < NullspaceProjections; Projection++) {
+				Multipliers.noalias() = Jacobian * Secondary;
+				LDLT.solveInPlace(Multipliers);
+				Secondary.noalias() -= Jacobian.transpose() * Multipliers;
+			}
+			Step += Secondary;
+		}
+		const NumericType Largest = Step.size() > 0 ? Step.cwiseAbs().maxCoeff() : (NumericType)0;
+		if (Largest > MaxStep) {
+			Step *= MaxStep / Largest;
+		}
+		return true;
+	}
+};
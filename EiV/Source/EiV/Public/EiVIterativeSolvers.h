@@ -0,0 +1,258 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+//<><><><><><><><><><><><> EiVLibrary Import Block <><><><><><><><><><><><>
+//imports the specified headers by the macro definitions
+
+#define EIV_INCLUDE_DENSE_MATRIX_ARRAY    //includes most core and basic features
+#define EIV_INCLUDE_SPARSE_LINEAR_ALGEBRA //includes sparse linear algebra utilities
+#define EIV_UNDEFINE_INCLUDES             //ensures that these include macros above are local to this file
+
+#include "EiVLibrary.h"   //takes the EIV_INCLUDE macros as settings and retrieves
+                          //the specified Eigen modules, typedefs, and helper functions
+//<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>
+#include "EiVSparseKernels.h"
+
+/*
+* Persistent iterative sparse solvers. Eigen's iterative solvers are normally built, used once and thrown away, which
+* rebuilds the preconditioner and starts from a zero guess every time. The solvers here keep their own copy of the
+* system matrix, so a matrix with the same sparsity pattern only copies its new values in place and keeps the
+* (possibly stale, but still useful) preconditioner. Each solve can start from the previous solution, so systems that
+* change slowly from frame to frame converge in a few iterations.
+* These objects are not thread safe, use one solver per thread.
+*/
+
+// Per solve settings of a persistent iterative solver
+struct FEiVIterativeSolveSettings
+{
+	// The maximum number of iterations, zero or less uses the Eigen default (twice the number of columns)
+	int32 MaxIterations = -1;
+	// The relative tolerance of the residual, zero or less uses the machine epsilon (the Eigen default)
+	double Tolerance = -1.0;
+	// If true the solve starts from the previous solution (when it has the right size) instead of zero
+	bool bWarmStart = true;
+	// If true the true relative residual |AX - B| / |B| is computed after the solve, this costs one extra product
+	bool bComputeResidual = false;
+};
+
+// What happened during a solve of a persistent iterative solver
+struct FEiVIterativeSolveStats
+{
+	// The number of iterations used by the last solve
+	int32 Iterations = 0;
+	// The relative error estimated by the solver
+	double Error = 0.0;
+	// The true relative residual, only set if bComputeResidual was set, -1 otherwise
+	double Residual = -1.0;
+	// If the solver reached the tolerance within the maximum number of iterations
+	bool bConverged = false;
+	// If the solve started from the previous solution
+	bool bWarmStarted = false;
+	// If the preconditioner was rebuilt since the previous solve
+	bool bPreconditionerRebuilt = false;
+};
+
+// The type erased interface of a persistent iterative solver, so that solvers of different types can be stored together
+template<typename NumericType = double>
+class IEiVIterativeSolver
+{
+public:
+	virtual ~IEiVIterativeSolver() {}
+	// This function sets the system matrix. If its sparsity pattern is the same as the previous matrix only the values are copied.
+	// @param InMatrix - the system matrix A of AX = B
+	// @param bRefreshPreconditioner - if true the preconditioner is rebuilt even if the sparsity pattern did not change
+	// @returns - false if the preconditioner could not be built
+	virtual bool SetMatrix(const EiVSparseMatrix<NumericType>& InMatrix, bool bRefreshPreconditioner = false) = 0;
+	// This function solves AX = B with the current system matrix
+	// @param InB - the right hand side, its rows must match the rows of the system matrix
+	// @param OutX - the solution
+	// @param Settings - the iteration cap, tolerance and warm start settings of this solve
+	// @param OutStats - the iterations, error and residual of this solve
+	// @returns - false if there is no system matrix, its preconditioner failed or the sizes do not match. A solve which did not converge still returns true, check OutStats.
+	virtual bool Solve(const EiVMatrixX<NumericType>& InB, EiVMatrixX<NumericType>& OutX, const FEiVIterativeSolveSettings& Settings, FEiVIterativeSolveStats& OutStats) = 0;
+	// This function sets how often the preconditioner is rebuilt when only the values of the matrix change
+	// @param Interval - rebuild every Interval calls to SetMatrix, zero or less only rebuilds when the sparsity pattern changes
+	virtual void SetPreconditionerRefreshInterval(int32 Interval) = 0;
+	// This function forgets the previous solution, so the next solve starts from zero
+	virtual void ResetGuess() = 0;
+	// This function releases the system matrix, preconditioner and previous solution
+	virtual void Reset() = 0;
+	// @returns - true if a system matrix has been set
+	virtual bool HasMatrix() const = 0;
+	// @returns - the solution of the previous solve, empty if there is none
+	virtual const EiVMatrixX<NumericType>& GetLastSolution() const = 0;
+};
+
+// The triangle of the system matrix an Eigen iterative solver reads, Eigen::Lower | Eigen::Upper if it reads all of it
+template<typename SolverType>
+struct TEiVSolverUpLo
+{
+	static constexpr int Value = Eigen::Lower | Eigen::Upper;
+};
+template<typename MatrixType, int UpLo, typename Preconditioner>
+struct TEiVSolverUpLo<Eigen::ConjugateGradient<MatrixType, UpLo, Preconditioner>>
+{
+	static constexpr int Value = UpLo;
+};
+
+/*
+* A persistent iterative solver wrapping any Eigen iterative solver over a column-major sparse matrix,
+* for example TEiVIterativeSolver<EiVConjugateGradient<EiVSparseMatrix<double>, Eigen::Lower, EiVIncompleteCholesky<double>>>
+*/
+template<typename SolverType>
+class TEiVIterativeSolver : public IEiVIterativeSolver<typename SolverType::Scalar>
+{
+public:
+	typedef typename SolverType::Scalar NumericType;
+	typedef typename SolverType::MatrixType MatrixType;
+
+	TEiVIterativeSolver() {}
+	// @param Interval - see SetPreconditionerRefreshInterval
+	explicit TEiVIterativeSolver(int32 Interval) : RefreshInterval(Interval) {}
+	// The Eigen solver keeps a reference to Matrix, so this object must not be copied or moved
+	TEiVIterativeSolver(const TEiVIterativeSolver&) = delete;
+	TEiVIterativeSolver& operator=(const TEiVIterativeSolver&) = delete;
+
+	virtual bool SetMatrix(const EiVSparseMatrix<NumericType>& InMatrix, bool bRefreshPreconditioner = false) override
+	{
+		const uint64 NewPatternHash = FEiVSparseKernels::HashSparsityPattern(InMatrix);
+		// the hash only rules out changes, so a match is confirmed against the stored pattern before the values are copied
+		if (bHasMatrix && NewPatternHash == PatternHash
+			&& FEiVSparseKernels::MatchesSparsityPattern(InMatrix, Matrix.rows(), Matrix.cols(), Matrix.outerIndexPtr(), Matrix.innerIndexPtr())) {
+			// same pattern, so every outer segment has the same length and the values can be copied in place.
+			// the storage of Matrix does not move, so the reference held by the Eigen solver stays valid
+			const auto* InOuter = InMatrix.outerIndexPtr();
+			const auto* InInnerNonZeros = InMatrix.innerNonZeroPtr();
+			for (int64 Outer = 0; Outer < InMatrix.outerSize(); Outer++) {
+				const int64 Count = InInnerNonZeros ? (int64)InInnerNonZeros[Outer] : (int64)(InOuter[Outer + 1] - InOuter[Outer]);
+				FMemory::Memcpy(Matrix.valuePtr() + Matrix.outerIndexPtr()[Outer], InMatrix.valuePtr() + InOuter[Outer], Count * sizeof(NumericType));
+			}
+			SetMatrixCalls++;
+			if (bRefreshPreconditioner || (RefreshInterval > 0 && SetMatrixCalls >= RefreshInterval)) {
+				Solver.factorize(Matrix);
+				bPreconditionerValid = Solver.info() == Eigen::Success;
+				SetMatrixCalls = 0;
+				bPreconditionerRebuilt = true;
+			}
+		}
+		else {
+			Matrix = InMatrix;
+			Matrix.makeCompressed();
+			Solver.compute(Matrix);
+			bPreconditionerValid = Solver.info() == Eigen::Success;
+			PatternHash = NewPatternHash;
+			bHasMatrix = true;
+			SetMatrixCalls = 0;
+			bPreconditionerRebuilt = true;
+			if (LastSolution.rows() != Matrix.cols()) {
+				LastSolution.resize(0, 0);
+			}
+		}
+		// Solver.info() holds the result of the previous solve when the preconditioner was kept
+		return bPreconditionerValid;
+	}
+
+	virtual bool Solve(const EiVMatrixX<NumericType>& InB, EiVMatrixX<NumericType>& OutX, const FEiVIterativeSolveSettings& Settings, FEiVIterativeSolveStats& OutStats) override
+	{
+		OutStats = FEiVIterativeSolveStats();
+		if (!bHasMatrix || !bPreconditionerValid || InB.rows() != Matrix.rows()) {
+			return false;
+		}
+		Solver.setMaxIterations(Settings.MaxIterations > 0 ? (Eigen::Index)Settings.MaxIterations : (Eigen::Index)-1); // -1 restores the Eigen default
+		Solver.setTolerance(Settings.Tolerance > 0.0 ? (typename Eigen::NumTraits<NumericType>::Real)Settings.Tolerance : Eigen::NumTraits<NumericType>::epsilon());
+		OutStats.bWarmStarted = Settings.bWarmStart && LastSolution.rows() == Matrix.cols() && LastSolution.cols() == InB.cols();
+		if (OutStats.bWarmStarted) {
+			LastSolution = Solver.solveWithGuess(InB, LastSolution).eval();
+		}
+		else {
+			LastSolution = Solver.solve(InB);
+		}
+		OutStats.Iterations = (int32)Solver.iterations();
+		OutStats.Error = (double)Solver.error();
+		OutStats.bConverged = Solver.info() == Eigen::Success;
+		OutStats.bPreconditionerRebuilt = bPreconditionerRebuilt;
+		bPreconditionerRebuilt = false;
+		if (Settings.bComputeResidual) {
+			const double BNorm = (double)InB.norm();
+			// the conjugate gradient solver only reads one triangle, which may be all the caller stored
+			constexpr int UpLo = TEiVSolverUpLo<SolverType>::Value;
+			EiVMatrixX<NumericType> Product;
+			if constexpr (UpLo == (Eigen::Lower | Eigen::Upper)) {
+				Product = Matrix * LastSolution;
+			}
+			else {
+				Product = Matrix.template selfadjointView<UpLo>() * LastSolution;
+			}
+			const double RNorm = (double)(InB - Product).norm();
+			OutStats.Residual = BNorm > 0.0 ? RNorm / BNorm : RNorm;
+		}
+		OutX = LastSolution;
+		return true;
+	}
+
+	virtual void SetPreconditionerRefreshInterval(int32 Interval) override
+	{
+		RefreshInterval = Interval;
+	}
+
+	virtual void ResetGuess() override
+	{
+		LastSolution.resize(0, 0);
+	}
+
+	virtual void Reset() override
+	{
+		// the Eigen solver is only used again after SetMatrix has called compute on the new matrix
+		Matrix = MatrixType();
+		LastSolution.resize(0, 0);
+		PatternHash = 0;
+		bHasMatrix = false;
+		bPreconditionerValid = false;
+		SetMatrixCalls = 0;
+		bPreconditionerRebuilt = false;
+	}
+
+	virtual bool HasMatrix() const override
+	{
+		return bHasMatrix;
+	}
+
+	virtual const EiVMatrixX<NumericType>& GetLastSolution() const override
+	{
+		return LastSolution;
+	}
+
+	// @returns - the wrapped Eigen solver, for settings not covered by FEiVIterativeSolveSettings
+	SolverType& GetSolver()
+	{
+		return Solver;
+	}
+
+private:
+	SolverType Solver;
+	MatrixType Matrix;
+	EiVMatrixX<NumericType> LastSolution;
+	uint64 PatternHash = 0;
+	int32 RefreshInterval = 0;
+	int32 SetMatrixCalls = 0;
+	bool bHasMatrix = false;
+	bool bPreconditionerValid = false;
+	bool bPreconditionerRebuilt = false;
+};
+
+// Persistent conjugate gradient solver, for symmetric positive definite matrices. Only the lower triangle is used.
+template<typename NumericType = double, typename Preconditioner = EiVDiagonalPreconditioner<NumericType>>
+using TEiVPersistentConjugateGradient = TEiVIterativeSolver<EiVConjugateGradient<EiVSparseMatrix<NumericType>, Eigen::Lower, Preconditioner>>;
+// Persistent bi conjugate gradient stabilized solver, for general square matrices
+template<typename NumericType = double, typename Preconditioner = EiVDiagonalPreconditioner<NumericType>>
+using TEiVPersistentBiCGSTAB = TEiVIterativeSolver<EiVBiCGSTAB<EiVSparseMatrix<NumericType>, Preconditioner>>;
+// Persistent least squares conjugate gradient solver, for rectangular matrices
+template<typename NumericType = double, typename Preconditioner = EiVLeastSquareDiagonalPreconditioner<NumericType>>
+using TEiVPersistentLeastSquaresConjugateGradient = TEiVIterativeSolver<EiVLeastSquaresConjugateGradient<EiVSparseMatrix<NumericType>, Preconditioner>>;
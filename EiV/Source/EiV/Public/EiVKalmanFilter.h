@@ -0,0 +1,299 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+//<><><><><><><><><><><><> EiVLibrary Import Block <><><><><><><><><><><><>
+//imports the specified headers by the macro definitions
+
+#define EIV_INCLUDE_DENSE_MATRIX_ARRAY    //includes most core and basic features
+#define EIV_INCLUDE_CHOLESKY              //includes the LLT and LDLT decompositions
+#define EIV_UNDEFINE_INCLUDES             //ensures that these include macros above are local to this file
+
+#include "EiVLibrary.h"   //takes the EIV_INCLUDE macros as settings and retrieves
+                          //the specified Eigen modules, typedefs, and helper functions
+//<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>
+#include <atomic>
+
+/*
+* A linear Kalman filter with extended Kalman filter hooks. The state, measurement and control sizes are template
+* parameters, fixed sizes keep every matrix on the stack and inline the small products, EiVDynamic sizes are set once by
+* the constructor or Resize. All the workspace lives in the filter, so Predict and Update never allocate.
+* Update uses the Joseph form P = (I - K H) P (I - K H)^T + K R K^T, which keeps the covariance symmetric positive
+* semi-definite under rounding, and solves the innovation covariance with LDLT instead of inverting it.
+* For the extended filter evaluate the nonlinear models yourself and pass their values and Jacobians to PredictExtended
+* and UpdateExtended.
+* For this whole class the <NumericType> is the datatype of the numbers stored in the Eigen types.
+*/
+template<typename NumericType, int StateSize, int MeasurementSize, int ControlSize = 0>
+class TEiVKalmanFilter
+{
+public:
+	typedef EiVVector<NumericType, StateSize> StateVector;
+	typedef EiVMatrix<NumericType, StateSize, StateSize> StateMatrix;
+	typedef EiVVector<NumericType, MeasurementSize> MeasurementVector;
+	typedef EiVMatrix<NumericType, MeasurementSize, MeasurementSize> MeasurementMatrix;
+	typedef EiVMatrix<NumericType, MeasurementSize, StateSize> ObservationMatrix;
+	typedef EiVMatrix<NumericType, StateSize, MeasurementSize> GainMatrix;
+	typedef EiVVector<NumericType, ControlSize> ControlVector;
+	typedef EiVMatrix<NumericType, StateSize, ControlSize> ControlMatrix;
+
+	// The temporaries of Predict and Update, sized once so the filter steps never allocate
+	struct FWorkspace
+	{
+		StateVector StateVectorTemp;
+		StateMatrix StateTemp;
+		StateMatrix IdentityMinusKH;
+		ObservationMatrix HP;
+		GainMatrix GainTransposeR;
+		EiVMatrix<NumericType, MeasurementSize, StateSize> GainTranspose;
+		MeasurementMatrix InnovationCovariance;
+		MeasurementVector Innovation;
+		EiVLDLT<MeasurementMatrix> LDLT;
+
+		void Resize(int32 InStateSize, int32 InMeasurementSize)
+		{
+			StateVectorTemp.resize(InStateSize);
+			StateTemp.resize(InStateSize, InStateSize);
+			IdentityMinusKH.resize(InStateSize, InStateSize);
+			HP.resize(InMeasurementSize, InStateSize);
+			GainTransposeR.resize(InStateSize, InMeasurementSize);
+			GainTranspose.resize(InMeasurementSize, InStateSize);
+			InnovationCovariance.resize(InMeasurementSize, InMeasurementSize);
+			Innovation.resize(InMeasurementSize);
+			LDLT = EiVLDLT<MeasurementMatrix>(InMeasurementSize);
+		}
+	};
+
+	// the current state estimate x and its covariance P
+	StateVector State;
+	StateMatrix Covariance;
+	// the process model x' = F x + B u with noise covariance Q
+	StateMatrix Transition;
+	ControlMatrix Control;
+	StateMatrix ProcessNoise;
+	// the measurement model z = H x with noise covariance R
+	ObservationMatrix Observation;
+	MeasurementMatrix MeasurementNoise;
+
+	// Creates a filter with a zero state, identity covariance and transition, and zero noise and observation models.
+	// The sizes only have to be given for EiVDynamic template sizes.
+	TEiVKalmanFilter(int32 InStateSize = StateSize, int32 InMeasurementSize = MeasurementSize, int32 InControlSize = ControlSize)
+	{
+		Resize(InStateSize, InMeasurementSize, InControlSize);
+	}
+
+	// This function sets the sizes of a filter with EiVDynamic template sizes and resets it, see the constructor
+	// @param InStateSize - the number of state variables
+	// @param InMeasurementSize - the number of measured values
+	// @param InControlSize - the number of control inputs
+	void Resize(int32 InStateSize, int32 InMeasurementSize, int32 InControlSize = ControlSize)
+	{
+		InStateSize = FMath::Max(InStateSize, 0);
+		InMeasurementSize = FMath::Max(InMeasurementSize, 0);
+		InControlSize = FMath::Max(InControlSize, 0);
+		State.setZero(InStateSize);
+		Covariance.setIdentity(InStateSize, InStateSize);
+		Transition.setIdentity(InStateSize, InStateSize);
+		Control.setZero(InStateSize, InControlSize);
+		ProcessNoise.setZero(InStateSize, InStateSize);
+		Observation.setZero(InMeasurementSize, InStateSize);
+		MeasurementNoise.setZero(InMeasurementSize, InMeasurementSize);
+		Workspace.Resize(InStateSize, InMeasurementSize);
+	}
+
+	// This function advances the state with the linear process model, x = F x and P = F P F^T + Q
+	void Predict()
+	{
+		TEiVKalmanFilter::PredictState(State, Transition, Workspace);
+		TEiVKalmanFilter::PredictCovariance(Covariance, Transition, ProcessNoise, Workspace);
+	}
+	// This function advances the state with the linear process model and a control input, x = F x + B u
+	// @param Input - the control input u
+	void Predict(const ControlVector& Input)
+	{
+		TEiVKalmanFilter::PredictState(State, Transition, Workspace);
+		State.noalias() += Control * Input;
+		TEiVKalmanFilter::PredictCovariance(Covariance, Transition, ProcessNoise, Workspace);
+	}
+	// This function advances the state with a nonlinear process model (extended Kalman filter)
+	// @param PredictedState - f(x), the nonlinear model evaluated at the current state
+	// @param Jacobian - the Jacobian of f at the current state
+	void PredictExtended(const StateVector& PredictedState, const StateMatrix& Jacobian)
+	{
+		State = PredictedState;
+		TEiVKalmanFilter::PredictCovariance(Covariance, Jacobian, ProcessNoise, Workspace);
+	}
+	// This function corrects the state with a measurement of the linear measurement model
+	// @param Measurement - the measurement z
+	// @returns - false if the innovation covariance H P H^T + R is not positive definite, the state is unchanged then
+	bool Update(const MeasurementVector& Measurement)
+	{
+		Workspace.Innovation = Measurement;
+		Workspace.Innovation.noalias() -= Observation * State;
+		return TEiVKalmanFilter::UpdateJoseph(State, Covariance, Observation, MeasurementNoise, Workspace);
+	}
+	// This function corrects the state with a measurement of a nonlinear measurement model (extended Kalman filter)
+	// @param Measurement - the measurement z
+	// @param PredictedMeasurement - h(x), the nonlinear model evaluated at the current state
+	// @param Jacobian - the Jacobian of h at the current state
+	// @returns - false if the innovation covariance is not positive definite, the state is unchanged then
+	bool UpdateExtended(const MeasurementVector& Measurement, const MeasurementVector& PredictedMeasurement, const ObservationMatrix& Jacobian)
+	{
+		Workspace.Innovation = Measurement - PredictedMeasurement;
+		return TEiVKalmanFilter::UpdateJoseph(State, Covariance, Jacobian, MeasurementNoise, Workspace);
+	}
+
+	// x = F x, through the workspace so that it never allocates
+	static void PredictState(EiVRef<StateVector> InOutState, const StateMatrix& InTransition, FWorkspace& InWorkspace)
+	{
+		InWorkspace.StateVectorTemp = InOutState;
+		InOutState.noalias() = InTransition * InWorkspace.StateVectorTemp;
+	}
+	// P = F P F^T + Q
+	static void PredictCovariance(EiVRef<StateMatrix> InOutCovariance, const StateMatrix& InTransition, const StateMatrix& InProcessNoise, FWorkspace& InWorkspace)
+	{
+		InWorkspace.StateTemp.noalias() = InTransition * InOutCovariance;
+		InOutCovariance = InProcessNoise;
+		InOutCovariance.noalias() += InWorkspace.StateTemp * InTransition.transpose();
+	}
+	// the Joseph form update for the innovation already stored in the workspace
+	static bool UpdateJoseph(EiVRef<StateVector> InOutState, EiVRef<StateMatrix> InOutCovariance, const ObservationMatrix& InObservation, const MeasurementMatrix& InMeasurementNoise, FWorkspace& InWorkspace)
+	{
+		if (InObservation.rows() == 0) {
+			// no measured values, so there is nothing to correct (and minCoeff of an empty LDLT would assert)
+			return true;
+		}
+		// S = H P H^T + R
+		InWorkspace.HP.noalias() = InObservation * InOutCovariance;
+		InWorkspace.InnovationCovariance = InMeasurementNoise;
+		InWorkspace.InnovationCovariance.noalias() += InWorkspace.HP * InObservation.transpose();
+		InWorkspace.LDLT.compute(InWorkspace.InnovationCovariance);
+		if (InWorkspace.LDLT.info() != Eigen::Success || !InWorkspace.LDLT.isPositive() || InWorkspace.LDLT.vectorD().minCoeff() <= (NumericType)0) {
+			return false;
+		}
+		// K^T = S^-1 H P, since P and S are symmetric
+		InWorkspace.GainTranspose = InWorkspace.HP;
+		InWorkspace.LDLT.solveInPlace(InWorkspace.GainTranspose);
+		InOutState.noalias() += InWorkspace.GainTranspose.transpose() * InWorkspace.Innovation;
+		// P = (I - K H) P (I - K H)^T + K R K^T
+		InWorkspace.IdentityMinusKH.setIdentity();
+		InWorkspace.IdentityMinusKH.noalias() -= InWorkspace.GainTranspose.transpose() * InObservation;
+		InWorkspace.StateTemp.noalias() = InWorkspace.IdentityMinusKH * InOutCovariance;
+		InOutCovariance.noalias() = InWorkspace.StateTemp * InWorkspace.IdentityMinusKH.transpose();
+		InWorkspace.GainTransposeR.noalias() = InWorkspace.GainTranspose.transpose() * InMeasurementNoise;
+		InOutCovariance.noalias() += InWorkspace.GainTransposeR * InWorkspace.GainTranspose;
+		// remove the asymmetry left by rounding
+		InWorkspace.StateTemp = InOutCovariance.transpose();
+		InOutCovariance += InWorkspace.StateTemp;
+		InOutCovariance *= (NumericType)0.5;
+		return true;
+	}
+
+private:
+	FWorkspace Workspace;
+};
+
+/*
+* A batch of independent Kalman filters sharing one process and measurement model, for tracking many entities.
+* The states and covariances are stored as two arrays with one column per filter and allocated once by Init, Predict and
+* Update then step every filter in parallel chunks without allocating. The sizes must be fixed.
+* For this whole class the <NumericType> is the datatype of the numbers stored in the Eigen types.
+*/
+template<typename NumericType, int StateSize, int MeasurementSize>
+class TEiVKalmanFilterBatch
+{
+	static_assert(StateSize > 0 && MeasurementSize > 0, "TEiVKalmanFilterBatch needs fixed state and measurement sizes");
+
+public:
+	typedef TEiVKalmanFilter<NumericType, StateSize, MeasurementSize> FilterType;
+	typedef typename FilterType::StateVector StateVector;
+	typedef typename FilterType::StateMatrix StateMatrix;
+	typedef typename FilterType::MeasurementVector MeasurementVector;
+	typedef typename FilterType::MeasurementMatrix MeasurementMatrix;
+	typedef typename FilterType::ObservationMatrix ObservationMatrix;
+
+	// The smallest number of filters worth a worker thread
+	static constexpr int32 MinFiltersPerTask = 256;
+
+	// the shared process model x' = F x with noise covariance Q
+	StateMatrix Transition = StateMatrix::Identity();
+	StateMatrix ProcessNoise = StateMatrix::Zero();
+	// the shared measurement model z = H x with noise covariance R
+	ObservationMatrix Observation = ObservationMatrix::Zero();
+	MeasurementMatrix MeasurementNoise = MeasurementMatrix::Zero();
+
+	// This function allocates the filters and sets all of them to the same initial estimate
+	// @param NumFilters - the number of filters
+	// @param InitialState - the initial state of every filter
+	// @param InitialCovariance - the initial covariance of every filter
+	void Init(int32 NumFilters, const StateVector& InitialState, const StateMatrix& InitialCovariance)
+	{
+		NumFilters = FMath::Max(NumFilters, 0);
+		States = InitialState.replicate(1, NumFilters);
+		Covariances = EiVMap<const EiVVector<NumericType, StateSize * StateSize>>(InitialCovariance.data()).replicate(1, NumFilters);
+	}
+	// @returns - the number of filters
+	int32 Num() const { return (int32)States.cols(); }
+	// @returns - the state of a filter, which can be read and written
+	EiVMap<StateVector> GetState(int32 Index) { return EiVMap<StateVector>(States.col(Index).data()); }
+	// @returns - the covariance of a filter, which can be read and written
+	EiVMap<StateMatrix> GetCovariance(int32 Index) { return EiVMap<StateMatrix>(Covariances.col(Index).data()); }
+	// @returns - the states of all filters, one per column
+	const EiVMatrix<NumericType, StateSize, EiVDynamic>& GetStates() const { return States; }
+
+	// This function advances every filter with the shared process model
+	void Predict()
+	{
+		FEiVHelper::ForEachRange(Num(), MinFiltersPerTask, [this](int32 First, int32 Last)
+		{
+			// every task steps its filters with its own (stack) workspace
+			typename FilterType::FWorkspace Workspace;
+			for (int32 Index = First; Index < Last; Index++) {
+				EiVMap<StateVector> State = GetState(Index);
+				EiVMap<StateMatrix> Covariance = GetCovariance(Index);
+				FilterType::PredictState(State, Transition, Workspace);
+				FilterType::PredictCovariance(Covariance, Transition, ProcessNoise, Workspace);
+			}
+		});
+	}
+	// This function corrects the filters with their measurements
+	// @param Measurements - one measurement per filter, measurement i belongs to filter i
+	// @param bHasMeasurement - optional, Num() flags, filters whose flag is false are not updated
+	// @returns - the number of filters which were updated (filters whose innovation covariance was not positive definite are skipped)
+	int32 Update(const EiVMatrix<NumericType, MeasurementSize, EiVDynamic>& Measurements, const bool* bHasMeasurement = nullptr)
+	{
+		if (Measurements.cols() != Num()) {
+			return 0;
+		}
+		std::atomic<int32> NumUpdated(0);
+		FEiVHelper::ForEachRange(Num(), MinFiltersPerTask, [&](int32 First, int32 Last)
+		{
+			typename FilterType::FWorkspace Workspace;
+			int32 TaskUpdated = 0;
+			for (int32 Index = First; Index < Last; Index++) {
+				if (bHasMeasurement != nullptr && !bHasMeasurement[Index]) {
+					continue;
+				}
+				EiVMap<StateVector> State = GetState(Index);
+				EiVMap<StateMatrix> Covariance = GetCovariance(Index);
+				Workspace.Innovation = Measurements.col(Index);
+				Workspace.Innovation.noalias() -= Observation * State;
+				if (FilterType::UpdateJoseph(State, Covariance, Observation, MeasurementNoise, Workspace)) {
+					TaskUpdated++;
+				}
+			}
+			NumUpdated.fetch_add(TaskUpdated, std::memory_order_relaxed);
+		});
+		return NumUpdated.load();
+	}
+
+private:
+	EiVMatrix<NumericType, StateSize, EiVDynamic> States;
+	EiVMatrix<NumericType, StateSize * StateSize, EiVDynamic> Covariances;
+};
@@ -0,0 +1,52 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+#include "EiVBPLibrary.h"
+#include "EiVKalmanFilter.h"
+#include "Components/ActorComponent.h"
+#include "EiVKalmanFilterComponent.generated.h"
+
+/*
+* An actor component holding one linear Kalman filter for Blueprints, for example to smooth a noisy tracked position.
+* SetModel sizes the filter and its workspace once, after that Predict and Update reuse the same memory every frame.
+* The component does not tick, call Predict and Update from your own events.
+*/
+UCLASS(ClassGroup = (EiV), meta = (BlueprintSpawnableComponent))
+class EIV_API UEiVKalmanFilterComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UEiVKalmanFilterComponent();
+
+	//Sets the process model x' = F x with noise covariance Q and the measurement model z = H x with noise covariance R. The state becomes zero and the covariance identity. Fails if the matrix sizes do not match.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Kalman Filter Model", Keywords = "EiV Eigen Kalman Filter Model Transition Observation Noise", ExpandEnumAsExecs = "Success"), Category = "EiV|Filtering|Kalman Filter")
+	void SetModel(FEiVDynamicMatrix Transition, FEiVDynamicMatrix ProcessNoise, FEiVDynamicMatrix Observation, FEiVDynamicMatrix MeasurementNoise, EEiVBPFuncSuccess& Success);
+	//Sets the state estimate (a column vector) and its covariance. Fails if their sizes do not match the model.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Kalman Filter State", Keywords = "EiV Eigen Kalman Filter State Covariance Reset", ExpandEnumAsExecs = "Success"), Category = "EiV|Filtering|Kalman Filter")
+	void SetState(FEiVDynamicMatrix State, FEiVDynamicMatrix Covariance, EEiVBPFuncSuccess& Success);
+	//Advances the state estimate with the process model.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Kalman Filter Predict", Keywords = "EiV Eigen Kalman Filter Predict Step"), Category = "EiV|Filtering|Kalman Filter")
+	void Predict();
+	//Corrects the state estimate with a measurement (a column vector). Fails if its size does not match the model or the innovation covariance is not positive definite, the estimate is unchanged then.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Kalman Filter Update", Keywords = "EiV Eigen Kalman Filter Update Correct Measurement", ExpandEnumAsExecs = "Success"), Category = "EiV|Filtering|Kalman Filter")
+	void Update(FEiVDynamicMatrix Measurement, EEiVBPFuncSuccess& Success);
+	//Returns the state estimate as a column vector and its covariance.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Kalman Filter State", Keywords = "EiV Eigen Kalman Filter State Covariance Estimate"), Category = "EiV|Filtering|Kalman Filter")
+	void GetState(FEiVDynamicMatrix& State, FEiVDynamicMatrix& Covariance) const;
+
+	// @returns - the filter, for C++ code which sets up extended models or reads the estimate without copies
+	TEiVKalmanFilter<double, EiVDynamic, EiVDynamic>& GetFilter() { return Filter; }
+
+private:
+	TEiVKalmanFilter<double, EiVDynamic, EiVDynamic> Filter;
+	// the measurement copied out of the Blueprint matrix, kept so Update does not allocate
+	EiVVectorXd MeasurementBuffer;
+};
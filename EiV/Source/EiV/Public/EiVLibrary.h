@@ -3,12 +3,13 @@
 /* Licensed under MIT license. See LICENSE for full license text.
 *
 *        Created: 20th March 2025
-*  Last Modified: 21st March 2025
+*  Last Modified: 19th October 2026
 */
 
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
 #if defined(_WIN64) || defined(_WIN32)
 #include <Windows/WindowsPlatformCompilerPreSetup.h>
 #endif
@@ -20,6 +21,24 @@
 #endif
 #include "EiVLibrary.generated.h"
 
+// Inside the EiV module itself (EIV_MODULE_BUILD is a private definition of EiV.Build.cs) every file enables every
+// Eigen module, so FEiVHelper is the same complete struct whichever file of a unity build includes this file first,
+// and EiVLibrary.cpp can always compile every instantiation the other modules declare extern below
+#ifdef EIV_MODULE_BUILD
+#ifndef EIV_INCLUDE_DENSE_MATRIX_ARRAY
+#define EIV_INCLUDE_DENSE_MATRIX_ARRAY
+#endif
+#ifndef EIV_INCLUDE_DENSE_LINEAR_PROBLEMS
+#define EIV_INCLUDE_DENSE_LINEAR_PROBLEMS
+#endif
+#ifndef EIV_INCLUDE_SPARSE_LINEAR_ALGEBRA
+#define EIV_INCLUDE_SPARSE_LINEAR_ALGEBRA
+#endif
+#ifndef EIV_INCLUDE_GEOMETRY
+#define EIV_INCLUDE_GEOMETRY
+#endif
+#endif
+
 // Swath macros that include several modules or similar/grouped modules
 #ifdef EIV_INCLUDE_DENSE_MATRIX_ARRAY
 #ifndef EIV_INCLUDE_CORE
@@ -205,7 +224,7 @@ template<typename MatrixType,uint32 Mode>																			using EiVTriangularV
 template<typename VectorType, int Size = -1>																		using EiVVectorBlock          = Eigen::VectorBlock<VectorType,Size>;
 template<typename ExpressionType, int Direction>																	using EiVVectorwiseOp         = Eigen::VectorwiseOp<ExpressionType,Direction>;
 template<typename ExpressionType>																					using EiVWithFormat           = Eigen::WithFormat<ExpressionType>;
-template<typename PlainObjectType, int Options = 0, typename StrideType = typename Eigen::internal::conditional<PlainObjectType::isVectorAtCompileTime, Eigen::InnerStride<1>, Eigen::OuterStride<>>::type>                         using EiVRef                = Eigen::Ref<PlainObjectType, Options, StrideType>;
+template<typename PlainObjectType, int Options = 0, typename StrideType = typename Eigen::internal::conditional<PlainObjectType::IsVectorAtCompileTime, Eigen::InnerStride<1>, Eigen::OuterStride<>>::type>                         using EiVRef                = Eigen::Ref<PlainObjectType, Options, StrideType>;
 template<typename Derived, int Level = Eigen::internal::accessors_level<Derived>::has_write_access ? Eigen::WriteAccessors : Eigen::ReadOnlyAccessors>                                                                              using EiVMapBase            = Eigen::MapBase<Derived, Level>;
 template<typename Scalar, int Rows, int Cols, int Options = Eigen::AutoAlign | ((Rows == 1 && Cols != 1) ? Eigen::RowMajor : (Cols == 1 && Rows != 1) ? Eigen::ColMajor : Eigen::ColMajor), int MaxRows = Rows, int MaxCols = Cols> using EiVMatrix             = Eigen::Matrix<Scalar, Rows, Cols, Options, MaxRows, MaxCols>;
 template<typename Scalar, int Rows, int Cols, int Options = Eigen::AutoAlign | ((Rows == 1 && Cols != 1) ? Eigen::RowMajor : (Cols == 1 && Rows != 1) ? Eigen::ColMajor : Eigen::ColMajor), int MaxRows = Rows, int MaxCols = Cols> using EiVArray              = Eigen::Array<Scalar, Rows, Cols, Options, MaxRows, MaxCols>;
@@ -275,6 +294,15 @@ MAKE_MATRIX_COMMON_TYPEDEFS(EiVDynamic,          2, X, 2);
 MAKE_MATRIX_COMMON_TYPEDEFS(EiVDynamic,          3, X, 3);
 MAKE_MATRIX_COMMON_TYPEDEFS(EiVDynamic,          4, X, 4);
 MAKE_MATRIX_COMMON_TYPEDEFS(EiVDynamic, EiVDynamic, X,  );
+// row-major storage matches the layout of TArray matrices and FMatrix. Eigen does not allow row-major column vectors, so use these for matrices with more than one column.
+template<typename Type, int Rows, int Cols> using EiVRowMajorMatrix = EiVMatrix<Type, Rows, Cols, Eigen::AutoAlign | Eigen::RowMajor>;
+template<typename Type> using EiVRowMajorMatrix4                    = EiVRowMajorMatrix<Type, 4, 4>;
+template<typename Type> using EiVRowMajorMatrixX                    = EiVRowMajorMatrix<Type, EiVDynamic, EiVDynamic>;
+typedef EiVRowMajorMatrixX<std::complex<double>> EiVRowMajorMatrixXcd;
+typedef EiVRowMajorMatrixX<std::complex<float>>  EiVRowMajorMatrixXcf;
+typedef EiVRowMajorMatrixX<double>               EiVRowMajorMatrixXd;
+typedef EiVRowMajorMatrixX<float>                EiVRowMajorMatrixXf;
+typedef EiVRowMajorMatrixX<int>                  EiVRowMajorMatrixXi;
 
 #undef MAKE_COMMON_TYPEDEFS
 #undef MAKE_MATRIX_COMMON_TYPEDEFS
@@ -328,6 +356,7 @@ template<typename MatrixType> using EiVTridiagonalization                = Eigen
 template<typename Derived, int Level = Eigen::internal::accessors_level<Derived>::has_write_access ? Eigen::WriteAccessors : Eigen::ReadOnlyAccessors> using EiVSparseMapBase = Eigen::SparseMapBase<Derived, Level>;
 template<typename Scalar, int Options = 0, typename StorageIndex = int>                               using EiVSparseMatrix = Eigen::SparseMatrix<Scalar, Options, StorageIndex>;
 template<typename Scalar, int Options = 0, typename StorageIndex = int>                               using EiVSparseVector = Eigen::SparseVector<Scalar, Options, StorageIndex>;
+template<typename Scalar, typename StorageIndex = int>                                                using EiVRowMajorSparseMatrix = Eigen::SparseMatrix<Scalar, Eigen::RowMajor, StorageIndex>;
 template<typename Scalar, typename StorageIndex = typename Eigen::SparseMatrix<Scalar>::StorageIndex> using EiVTriplet = Eigen::Triplet<Scalar, StorageIndex>;
 template<typename Derived>                 using EiVSparseCompressedBase   = Eigen::SparseCompressedBase<Derived>;
 template<typename MatrixType, uint32 Mode> using EiVSparseSelfAdjointView  = Eigen::SparseSelfAdjointView<MatrixType, Mode>;
@@ -366,6 +395,7 @@ template<typename MatrixType, int UpLo = 1, typename Preconditioner = Eigen::Dia
 template<typename MatrixType, typename Preconditioner = Eigen::LeastSquareDiagonalPreconditioner<typename MatrixType::Scalar>>    using EiVLeastSquaresConjugateGradient = Eigen::LeastSquaresConjugateGradient<MatrixType, Preconditioner>;
 template<typename Scalar>                                              using EiVDiagonalPreconditioner            = Eigen::DiagonalPreconditioner<Scalar>;
 template<typename Scalar, typename StorageIndex = int>                 using EiVIncompleteLUT                     = Eigen::IncompleteLUT<Scalar, StorageIndex>;
+template<typename Scalar, int UpLo = Eigen::Lower, typename Ordering = Eigen::AMDOrdering<int>>  using EiVIncompleteCholesky                = Eigen::IncompleteCholesky<Scalar, UpLo, Ordering>;
 template<typename Scalar>                                              using EiVLeastSquareDiagonalPreconditioner = Eigen::LeastSquareDiagonalPreconditioner<Scalar>;
 template<typename Decomposition, typename RhsType, typename GuessType> using EiVSolveWithGuess                    = Eigen::SolveWithGuess<Decomposition,RhsType,GuessType>;
 template<typename Derived>                                             using EiVIterativeSolverBase               = Eigen::IterativeSolverBase<Derived>;
@@ -467,6 +497,50 @@ public:
 	// This gets the number of threads Eigen can currently use
 	// @returns the number of threads Eigen can use
 	static inline int32 GetEigenThreads() { return Eigen::nbThreads(); }
+	// This gets the number of chunks an EiV parallel kernel should split its work into. Chunks never
+	// hold less than MinItemsPerChunk work items, so small problems stay on the calling thread.
+	// @param WorkItems - the total amount of work (rows, nonzeros, bodies, etc.)
+	// @param MinItemsPerChunk - the smallest amount of work that is worth handing to a worker thread
+	// @returns the number of chunks to split the work into (always at least 1)
+	static int32 GetParallelChunkCount(const int64 WorkItems, const int64 MinItemsPerChunk)
+	{
+		const int64 MaxChunks = (int64)FMath::Max(FPlatformMisc::NumberOfCoresIncludingHyperthreads(), 1) * 4;
+		const int64 Chunks = WorkItems / FMath::Max<int64>(MinItemsPerChunk, 1);
+		return (int32)FMath::Clamp<int64>(Chunks, 1, MaxChunks);
+	}
+	// This splits Count items into GetParallelChunkCount ranges of about the same size and runs them on the worker threads
+	// @param Count - the number of items
+	// @param MinItemsPerChunk - the smallest number of items that is worth handing to a worker thread
+	// @param Kernel - called as Kernel(First, Last) for the items First to Last - 1
+	// @param bParallel - if this is false all the items are run as one range on the calling thread
+	template<typename KernelType>
+	static void ForEachRange(const int32 Count, const int64 MinItemsPerChunk, const KernelType& Kernel, const bool bParallel = true)
+	{
+		if (Count <= 0) {
+			return;
+		}
+		const int32 NumTasks = bParallel ? GetParallelChunkCount(Count, MinItemsPerChunk) : 1;
+		ParallelFor(NumTasks, [&](int32 Task)
+		{
+			Kernel((int32)((int64)Count * Task / NumTasks), (int32)((int64)Count * (Task + 1) / NumTasks));
+		}, NumTasks == 1);
+	}
+	// This is ForEachRange for kernels that work on fixed size blocks (stack arrays etc.), every range
+	// is cut further into chunks of at most ChunkSize items
+	// @param Count - the number of items
+	// @param ChunkSize - the largest number of items handed to one call of Kernel
+	// @param MinItemsPerChunk - the smallest number of items that is worth handing to a worker thread
+	// @param Kernel - called as Kernel(Start, Num) for the items Start to Start + Num - 1
+	template<typename KernelType>
+	static void ForEachChunk(const int32 Count, const int32 ChunkSize, const int64 MinItemsPerChunk, const KernelType& Kernel)
+	{
+		ForEachRange(Count, MinItemsPerChunk, [&](int32 First, int32 Last)
+		{
+			for (int32 Start = First; Start < Last; Start += ChunkSize) {
+				Kernel(Start, FMath::Min(ChunkSize, Last - Start));
+			}
+		});
+	}
 	// Converts a FVector2D to a c++ complex number type for use in Eigen
 	// @param InVector - the vector input
 	// @param AsPhasor - if this is true the complex number created is formed from the angle from the real axis and the magnitude
@@ -684,15 +758,8 @@ public:
 	template<typename NumericType = double>
 	static EiVMatrix<NumericType,4,4> FMatrixToMatrix(const FMatrix& InMatrix)
 	{
-		EiVMatrix<NumericType, 4, 4> Mtx = EiVMatrix<NumericType, 4, 4>();
-		Mtx.coeffRef(0, 0) = InMatrix.M[0][0]; Mtx.coeffRef(0, 1) = InMatrix.M[0][1];
-		Mtx.coeffRef(0, 2) = InMatrix.M[0][2]; Mtx.coeffRef(0, 3) = InMatrix.M[0][3];
-		Mtx.coeffRef(1, 0) = InMatrix.M[1][0]; Mtx.coeffRef(1, 1) = InMatrix.M[1][1];
-		Mtx.coeffRef(1, 2) = InMatrix.M[1][2]; Mtx.coeffRef(1, 3) = InMatrix.M[1][3];
-		Mtx.coeffRef(2, 0) = InMatrix.M[2][0]; Mtx.coeffRef(2, 1) = InMatrix.M[2][1];
-		Mtx.coeffRef(2, 2) = InMatrix.M[2][2]; Mtx.coeffRef(2, 3) = InMatrix.M[2][3];
-		Mtx.coeffRef(3, 0) = InMatrix.M[3][0]; Mtx.coeffRef(3, 1) = InMatrix.M[3][1];
-		Mtx.coeffRef(3, 2) = InMatrix.M[3][2]; Mtx.coeffRef(3, 3) = InMatrix.M[3][3];
+		// FMatrix is row-major, so map it as such and let Eigen do the transposing copy
+		EiVMatrix<NumericType, 4, 4> Mtx = Eigen::Map<const EiVRowMajorMatrix4<FMatrix::FReal>>(&InMatrix.M[0][0]).template cast<NumericType>();
 		return Mtx;
 	}
 	// This function converts to an Unreal Engine FMatrix from an Eigen Matrix
@@ -702,14 +769,26 @@ public:
 	static FMatrix FMatrixFromMatrix(const EiVMatrix<NumericType, 4, 4>& InMatrix)
 	{
 		FMatrix Mtx = FMatrix();
-		Mtx.M[0][0] = InMatrix.coeff(0, 0); Mtx.M[0][1] = InMatrix.coeff(0, 1);
-		Mtx.M[0][2] = InMatrix.coeff(0, 2); Mtx.M[0][3] = InMatrix.coeff(0, 3);
-		Mtx.M[1][0] = InMatrix.coeff(1, 0); Mtx.M[1][1] = InMatrix.coeff(1, 1);
-		Mtx.M[1][2] = InMatrix.coeff(1, 2); Mtx.M[1][3] = InMatrix.coeff(1, 3);
-		Mtx.M[2][0] = InMatrix.coeff(2, 0); Mtx.M[2][1] = InMatrix.coeff(2, 1);
-		Mtx.M[2][2] = InMatrix.coeff(2, 2); Mtx.M[2][3] = InMatrix.coeff(2, 3);
-		Mtx.M[3][0] = InMatrix.coeff(3, 0); Mtx.M[3][1] = InMatrix.coeff(3, 1);
-		Mtx.M[3][2] = InMatrix.coeff(3, 2); Mtx.M[3][3] = InMatrix.coeff(3, 3);
+		Eigen::Map<EiVRowMajorMatrix4<FMatrix::FReal>>(&Mtx.M[0][0]) = InMatrix.template cast<FMatrix::FReal>();
+		return Mtx;
+	}
+	// This function converts from an Unreal Engine FMatrix to a row-major Eigen Matrix. Both have the same layout, so this is a straight copy.
+	// @param InMatrix - the matrix to convert
+	// @returns - the row-major Eigen version of this matrix
+	template<typename NumericType = double>
+	static EiVRowMajorMatrix4<NumericType> FMatrixToRowMajorMatrix(const FMatrix& InMatrix)
+	{
+		EiVRowMajorMatrix4<NumericType> Mtx = Eigen::Map<const EiVRowMajorMatrix4<FMatrix::FReal>>(&InMatrix.M[0][0]).template cast<NumericType>();
+		return Mtx;
+	}
+	// This function converts to an Unreal Engine FMatrix from a row-major Eigen Matrix. Both have the same layout, so this is a straight copy.
+	// @param InMatrix - the row-major matrix to convert
+	// @returns - the Unreal Engine version of this matrix
+	template<typename NumericType = double>
+	static FMatrix FMatrixFromRowMajorMatrix(const EiVRowMajorMatrix4<NumericType>& InMatrix)
+	{
+		FMatrix Mtx = FMatrix();
+		Eigen::Map<EiVRowMajorMatrix4<FMatrix::FReal>>(&Mtx.M[0][0]) = InMatrix.template cast<FMatrix::FReal>();
 		return Mtx;
 	}
 	// This function converts from an Unreal Engine TArray to an Eigen Matrix
@@ -719,6 +798,13 @@ public:
 	static EiVMatrix<NumericType,Rows,Cols> TArrayToMatrix(const TArray<NumericType>& InArray)
 	{
 		EiVMatrix<NumericType, Rows, Cols> Mtx = EiVMatrix<NumericType, Rows, Cols>();
+		// dynamic sizes are negative, their matrices stay empty as before
+		if constexpr (Rows > 0 && Cols > 0) {
+			if (InArray.Num() >= Rows * Cols) {
+				Mtx = Eigen::Map<const EiVRowMajorMatrixX<NumericType>>(InArray.GetData(), Rows, Cols);
+				return Mtx;
+			}
+		}
 		for (int row = 0; row < Rows; row++) {
 			for (int col = 0; col < Cols && (col + row * Cols) < InArray.Num(); col++) {
 				Mtx.coeffRef(row, col) = InArray[col + row * Cols];
@@ -733,11 +819,36 @@ public:
 	static TArray<NumericType> TArrayFromMatrix(const EiVMatrix<NumericType, Rows, Cols>& InMatrix)
 	{
 		TArray<NumericType> Arr = TArray<NumericType>();
-		for (int row = 0; row < InMatrix.rows(); row++) {
-			for (int col = 0; col < InMatrix.cols(); col++) {
-				Arr.Add(InMatrix.coeffRef(row, col));
-			}
+		Arr.SetNumUninitialized(InMatrix.size());
+		Eigen::Map<EiVRowMajorMatrixX<NumericType>>(Arr.GetData(), InMatrix.rows(), InMatrix.cols()) = InMatrix;
+		return Arr;
+	}
+	// This function converts from an Unreal Engine TArray in row-major order to a dynamic row-major Eigen Matrix with a single copy.
+	// Missing elements are set to zero.
+	// @param InArray - the array of matrix elements
+	// @param InRows - the rows of the matrix
+	// @param InCols - the columns of the matrix
+	// @returns - the row-major Eigen version of this array-matrix
+	template<typename NumericType = double>
+	static EiVRowMajorMatrixX<NumericType> TArrayToRowMajorMatrix(const TArray<NumericType>& InArray, const int32& InRows, const int32& InCols)
+	{
+		EiVRowMajorMatrixX<NumericType> Mtx(InRows, InCols);
+		const int64 Count = FMath::Min<int64>(Mtx.size(), InArray.Num());
+		FMemory::Memcpy(Mtx.data(), InArray.GetData(), Count * sizeof(NumericType));
+		if (Count < Mtx.size()) {
+			Eigen::Map<EiVVectorX<NumericType>>(Mtx.data() + Count, Mtx.size() - Count).setZero();
 		}
+		return Mtx;
+	}
+	// This function converts to an Unreal Engine TArray in row-major order from a dynamic row-major Eigen Matrix with a single copy
+	// @param InMatrix - the row-major matrix
+	// @returns - the Unreal Engine version of this array-matrix
+	template<typename NumericType = double>
+	static TArray<NumericType> TArrayFromRowMajorMatrix(const EiVRowMajorMatrixX<NumericType>& InMatrix)
+	{
+		TArray<NumericType> Arr = TArray<NumericType>();
+		Arr.SetNumUninitialized(InMatrix.size());
+		FMemory::Memcpy(Arr.GetData(), InMatrix.data(), InMatrix.size() * sizeof(NumericType));
 		return Arr;
 	}
 #endif
@@ -954,8 +1065,8 @@ public:
 		FVector Axis;
 		double Angle;
 		InQuat.ToAxisAndAngle(Axis,Angle);
-		EiVVector3d VecAxis(Axis.X,Axis.Y,Axis.Z);
-		EiVAngleAxis<NumericType> AAxis(Angle,VecAxis);
+		EiVVector3<NumericType> VecAxis(Axis.X,Axis.Y,Axis.Z);
+		EiVAngleAxis<NumericType> AAxis((NumericType)Angle,VecAxis);
 		return AAxis;
 	}
 	// This function creates an Eigen AngleAxis object from an Unreal Engine FRotator
@@ -965,7 +1076,7 @@ public:
 	static EiVAngleAxis<NumericType> RotatorToAngleAxis(const FRotator& InRotator)
 	{
 		FQuat Quat = InRotator.Quaternion();
-		return FEiVHelper::QuatToAngleAxis(Quat);
+		return FEiVHelper::QuatToAngleAxis<NumericType>(Quat);
 	}
 	// This function creates an Eigen Quaternion object from an Unreal Engine FQuat
 	// @param InQuat - the FQuat to convert to the quaternion
@@ -1017,7 +1128,7 @@ public:
 	{
 		FVector2D Min = InBox.Min;
 		FVector2D Max = InBox.Max;
-		EiVAlignedBox<NumericType, 2> Box = EiVAlignedBox<NumericType, 2>(EiVVector2d(Min.X, Min.Y), EiVVector2d(Max.X, Max.Y));
+		EiVAlignedBox<NumericType, 2> Box = EiVAlignedBox<NumericType, 2>(EiVVector2<NumericType>(Min.X, Min.Y), EiVVector2<NumericType>(Max.X, Max.Y));
 		return Box;
 	}
 	// This function creates an Eigen AlignedBox object from an Unreal Engine FBox
@@ -1028,7 +1139,7 @@ public:
 	{
 		FVector Min = InBox.Min;
 		FVector Max = InBox.Max;
-		EiVAlignedBox<NumericType, 3> Box = EiVAlignedBox<NumericType, 3>(EiVVector3d(Min.X, Min.Y, Min.Z), EiVVector3d(Max.X, Max.Y, Max.Z));
+		EiVAlignedBox<NumericType, 3> Box = EiVAlignedBox<NumericType, 3>(EiVVector3<NumericType>(Min.X, Min.Y, Min.Z), EiVVector3<NumericType>(Max.X, Max.Y, Max.Z));
 		return Box;
 	}
 	// Constructs an Eigen UnformScaling object from a scalar
@@ -1081,7 +1192,7 @@ public:
 	static FQuat QuatFromAngleAxis(const EiVAngleAxis<NumericType>& InAngleAxis)
 	{
 		FVector Axis;
-		EiVVector3d Vec = InAngleAxis.axis();
+		EiVVector3d Vec = InAngleAxis.axis().template cast<double>();
 		Axis.X = Vec.x();
 		Axis.Y = Vec.y();
 		Axis.Z = Vec.z();
@@ -1137,8 +1248,8 @@ public:
 	template<typename NumericType = double>
 	static FBox2D FBoxFromAABox(const EiVAlignedBox<NumericType, 2>& InAABox)
 	{
-		EiVVector3d VecMin = InAABox.min();
-		EiVVector3d VecMax = InAABox.max();
+		EiVVector2d VecMin = InAABox.min().template cast<double>();
+		EiVVector2d VecMax = InAABox.max().template cast<double>();
 		FVector2D Min = FVector2D(VecMin.x(), VecMin.y());
 		FVector2D Max = FVector2D(VecMax.x(), VecMax.y());
 		return FBox2D(Min, Max);
@@ -1149,8 +1260,8 @@ public:
 	template<typename NumericType = double>
 	static FBox FBoxFromAABox(const EiVAlignedBox<NumericType, 3>& InAABox)
 	{
-		EiVVector3d VecMin = InAABox.min();
-		EiVVector3d VecMax = InAABox.max();
+		EiVVector3d VecMin = InAABox.min().template cast<double>();
+		EiVVector3d VecMax = InAABox.max().template cast<double>();
 		FVector Min = FVector(VecMin.x(), VecMin.y(), VecMin.z());
 		FVector Max = FVector(VecMax.x(), VecMax.y(), VecMax.z());
 		return FBox(Min, Max);
@@ -1196,6 +1307,82 @@ public:
 
 };
 
+// Explicit instantiations of the most used FEiVHelper templates (double and float, 2, 3, 4 and dynamic sizes).
+// Every file including EiV declares them (extern template) and links against the one copy EiVLibrary.cpp compiles,
+// instead of instantiating and code generating them again. EiVLibrary.cpp sees the same declarations and follows
+// them with the definitions, which is allowed, so no flag has to be set there and nothing leaks into the files
+// after it in a unity build.
+// Define EIV_NO_EXTERN_TEMPLATES before including this file to have them instantiated locally instead.
+#if defined(EIGEN_CORE_H) && !defined(EIV_NO_UTILITY)
+#define EIV_HELPER_CORE_INSTANTIATIONS(Extern, NumericType) \
+	Extern template std::complex<NumericType> FEiVHelper::Vector2DToComplex<NumericType>(const FVector2D&, bool); \
+	Extern template FVector2D FEiVHelper::ComplexToVector2D<NumericType>(const std::complex<NumericType>&, bool); \
+	Extern template EiVArray<NumericType, 1, EiVDynamic> FEiVHelper::TArrayToDynamicArray<NumericType>(const TArray<NumericType>&); \
+	Extern template TArray<NumericType> FEiVHelper::TArrayFromDynamicArray<NumericType>(const EiVArray<NumericType, 1, EiVDynamic>&); \
+	Extern template EiVVector2<NumericType> FEiVHelper::FVectorToVector<NumericType>(const FVector2D&); \
+	Extern template EiVVector3<NumericType> FEiVHelper::FVectorToVector<NumericType>(const FVector&); \
+	Extern template EiVVector4<NumericType> FEiVHelper::FVectorToVector<NumericType>(const FVector4&); \
+	Extern template FVector2D FEiVHelper::FVectorFromVector<NumericType>(const EiVVector2<NumericType>&); \
+	Extern template FVector FEiVHelper::FVectorFromVector<NumericType>(const EiVVector3<NumericType>&); \
+	Extern template FVector4 FEiVHelper::FVectorFromVector<NumericType>(const EiVVector4<NumericType>&); \
+	Extern template EiVRowVector2<NumericType> FEiVHelper::FVectorToRowVector<NumericType>(const FVector2D&); \
+	Extern template EiVRowVector3<NumericType> FEiVHelper::FVectorToRowVector<NumericType>(const FVector&); \
+	Extern template EiVRowVector4<NumericType> FEiVHelper::FVectorToRowVector<NumericType>(const FVector4&); \
+	Extern template FVector2D FEiVHelper::FVectorFromRowVector<NumericType>(const EiVRowVector2<NumericType>&); \
+	Extern template FVector FEiVHelper::FVectorFromRowVector<NumericType>(const EiVRowVector3<NumericType>&); \
+	Extern template FVector4 FEiVHelper::FVectorFromRowVector<NumericType>(const EiVRowVector4<NumericType>&); \
+	Extern template EiVMatrix<NumericType, 4, 4> FEiVHelper::FMatrixToMatrix<NumericType>(const FMatrix&); \
+	Extern template FMatrix FEiVHelper::FMatrixFromMatrix<NumericType>(const EiVMatrix<NumericType, 4, 4>&); \
+	Extern template EiVRowMajorMatrix4<NumericType> FEiVHelper::FMatrixToRowMajorMatrix<NumericType>(const FMatrix&); \
+	Extern template FMatrix FEiVHelper::FMatrixFromRowMajorMatrix<NumericType>(const EiVRowMajorMatrix4<NumericType>&); \
+	Extern template EiVMatrix<NumericType, 2, 2> FEiVHelper::TArrayToMatrix<NumericType, 2, 2>(const TArray<NumericType>&); \
+	Extern template EiVMatrix<NumericType, 3, 3> FEiVHelper::TArrayToMatrix<NumericType, 3, 3>(const TArray<NumericType>&); \
+	Extern template EiVMatrix<NumericType, 4, 4> FEiVHelper::TArrayToMatrix<NumericType, 4, 4>(const TArray<NumericType>&); \
+	Extern template EiVMatrix<NumericType, EiVDynamic, EiVDynamic> FEiVHelper::TArrayToMatrix<NumericType, EiVDynamic, EiVDynamic>(const TArray<NumericType>&); \
+	Extern template TArray<NumericType> FEiVHelper::TArrayFromMatrix<NumericType, 2, 2>(const EiVMatrix<NumericType, 2, 2>&); \
+	Extern template TArray<NumericType> FEiVHelper::TArrayFromMatrix<NumericType, 3, 3>(const EiVMatrix<NumericType, 3, 3>&); \
+	Extern template TArray<NumericType> FEiVHelper::TArrayFromMatrix<NumericType, 4, 4>(const EiVMatrix<NumericType, 4, 4>&); \
+	Extern template TArray<NumericType> FEiVHelper::TArrayFromMatrix<NumericType, EiVDynamic, EiVDynamic>(const EiVMatrix<NumericType, EiVDynamic, EiVDynamic>&); \
+	Extern template EiVRowMajorMatrixX<NumericType> FEiVHelper::TArrayToRowMajorMatrix<NumericType>(const TArray<NumericType>&, const int32&, const int32&); \
+	Extern template TArray<NumericType> FEiVHelper::TArrayFromRowMajorMatrix<NumericType>(const EiVRowMajorMatrixX<NumericType>&);
+#if !defined(EIV_NO_EXTERN_TEMPLATES)
+EIV_HELPER_CORE_INSTANTIATIONS(extern, double)
+EIV_HELPER_CORE_INSTANTIATIONS(extern, float)
+#endif
+#endif
+
+#if defined(EIGEN_SPARSECORE_MODULE_H) && !defined(EIV_NO_UTILITY)
+#define EIV_HELPER_SPARSECORE_INSTANTIATIONS(Extern, NumericType) \
+	Extern template EiVSparseMatrix<NumericType> FEiVHelper::FMatrixToSparseMatrix<NumericType>(const FMatrix&); \
+	Extern template FMatrix FEiVHelper::FMatrixFromSparseMatrix<NumericType>(const EiVSparseMatrix<NumericType>&); \
+	Extern template EiVSparseMatrix<NumericType> FEiVHelper::TArrayToSparseMatrix<NumericType>(const TArray<NumericType>&, const int32&, const int32&); \
+	Extern template TArray<NumericType> FEiVHelper::TArrayFromSparseMatrix<NumericType>(const EiVSparseMatrix<NumericType>&);
+#if !defined(EIV_NO_EXTERN_TEMPLATES)
+EIV_HELPER_SPARSECORE_INSTANTIATIONS(extern, double)
+EIV_HELPER_SPARSECORE_INSTANTIATIONS(extern, float)
+#endif
+#endif
+
+#if defined(EIGEN_GEOMETRY_MODULE_H) && !defined(EIV_NO_UTILITY)
+#define EIV_HELPER_GEOMETRY_INSTANTIATIONS(Extern, NumericType) \
+	Extern template EiVAngleAxis<NumericType> FEiVHelper::QuatToAngleAxis<NumericType>(const FQuat&); \
+	Extern template EiVAngleAxis<NumericType> FEiVHelper::RotatorToAngleAxis<NumericType>(const FRotator&); \
+	Extern template EiVQuaternion<NumericType> FEiVHelper::QuatToQuaternion<NumericType>(const FQuat&); \
+	Extern template EiVTranslation<NumericType, 2> FEiVHelper::VectorToTranslation<NumericType>(const FVector2D&); \
+	Extern template EiVTranslation<NumericType, 3> FEiVHelper::VectorToTranslation<NumericType>(const FVector&); \
+	Extern template EiVAlignedBox<NumericType, 2> FEiVHelper::FBoxToAABox<NumericType>(const FBox2D&); \
+	Extern template EiVAlignedBox<NumericType, 3> FEiVHelper::FBoxToAABox<NumericType>(const FBox&); \
+	Extern template FQuat FEiVHelper::QuatFromAngleAxis<NumericType>(const EiVAngleAxis<NumericType>&); \
+	Extern template FRotator FEiVHelper::RotatorFromAngleAxis<NumericType>(const EiVAngleAxis<NumericType>&); \
+	Extern template FQuat FEiVHelper::QuatFromQuaternion<NumericType>(const EiVQuaternion<NumericType>&); \
+	Extern template FBox2D FEiVHelper::FBoxFromAABox<NumericType>(const EiVAlignedBox<NumericType, 2>&); \
+	Extern template FBox FEiVHelper::FBoxFromAABox<NumericType>(const EiVAlignedBox<NumericType, 3>&);
+#if !defined(EIV_NO_EXTERN_TEMPLATES)
+EIV_HELPER_GEOMETRY_INSTANTIATIONS(extern, double)
+EIV_HELPER_GEOMETRY_INSTANTIATIONS(extern, float)
+#endif
+#endif
+
 
 // Auto-undefinition of include macros
 // Toggle this with the EIV_UNDEFINE_INCLUDES
@@ -0,0 +1,505 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+//<><><><><><><><><><><><> EiVLibrary Import Block <><><><><><><><><><><><>
+//imports the specified headers by the macro definitions
+
+#define EIV_INCLUDE_DENSE_MATRIX_ARRAY    //includes most core and basic features
+#define EIV_INCLUDE_GEOMETRY              //includes geometric utilities
+#define EIV_UNDEFINE_INCLUDES             //ensures that these include macros above are local to this file
+
+#include "EiVLibrary.h"   //takes the EIV_INCLUDE macros as settings and retrieves
+                          //the specified Eigen modules, typedefs, and helper functions
+//<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>
+
+/*
+* Exponential and logarithm maps of the rotation group SO(3) and the rigid transform group SE(3), for integrating
+* angular velocities and twists and for interpolating rotations and rigid transforms.
+* A rotation vector (omega) is the rotation axis scaled by the angle in radians. A twist is a linear part (rho) and a
+* rotation vector, exp(rho, omega) is the rotation exp(omega) and the translation J(omega) * rho, where J is the left
+* Jacobian of SO(3). Near zero angles every coefficient switches to its Taylor series, so the maps stay accurate for
+* tiny and zero rotations.
+*
+* The batched functions work on packed buffers, each element is 3 (rotation vectors, translations) or 4 (quaternions,
+* x y z w, the layout of EiVQuaternion and FQuat) consecutive numbers. They process chunks of ChunkSize elements as
+* Eigen arrays, so the math is vectorized across the batch with select instead of branches, and split large batches
+* over the worker threads. Every temporary lives on the stack, so batches never allocate.
+* Quaternions must be normalized. Output buffers may alias the matching input buffers.
+* For this whole struct the <NumericType> is the datatype of the numbers in the buffers.
+*/
+struct EIV_API FEiVLieGroups
+{
+	// The number of elements processed together in stack arrays
+	static constexpr int32 ChunkSize = 256;
+	// The smallest number of elements worth a worker thread
+	static constexpr int32 MinItemsPerTask = 2048;
+
+	// This function computes the rotation of a rotation vector (SO(3) exp)
+	// @param Omega - the rotation axis scaled by the angle in radians
+	// @returns - the rotation as a unit quaternion
+	template<typename NumericType = double>
+	static EiVQuaternion<NumericType> SO3Exp(const EiVVector3<NumericType>& Omega)
+	{
+		EiVQuaternion<NumericType> Rotation;
+		FEiVLieGroups::SO3ExpChunk(Omega.data(), Rotation.coeffs().data(), 1);
+		return Rotation;
+	}
+	// This function computes the rotation vector of a rotation (SO(3) log), the angle is in [0, pi]
+	// @param Rotation - a unit quaternion
+	// @returns - the rotation axis scaled by the angle in radians
+	template<typename NumericType = double>
+	static EiVVector3<NumericType> SO3Log(const EiVQuaternion<NumericType>& Rotation)
+	{
+		EiVVector3<NumericType> Omega;
+		FEiVLieGroups::SO3LogChunk(Rotation.coeffs().data(), Omega.data(), 1);
+		return Omega;
+	}
+	// This function computes the rigid transform of a twist (SE(3) exp)
+	// @param Rho - the linear part of the twist
+	// @param Omega - the rotation vector of the twist
+	// @param OutRotation - the rotation of the transform
+	// @param OutTranslation - the translation of the transform
+	template<typename NumericType = double>
+	static void SE3Exp(const EiVVector3<NumericType>& Rho, const EiVVector3<NumericType>& Omega, EiVQuaternion<NumericType>& OutRotation, EiVVector3<NumericType>& OutTranslation)
+	{
+		FEiVLieGroups::SE3ExpChunk(Rho.data(), Omega.data(), OutRotation.coeffs().data(), OutTranslation.data(), 1);
+	}
+	// This function computes the twist of a rigid transform (SE(3) log)
+	// @param Rotation - the rotation of the transform, a unit quaternion
+	// @param Translation - the translation of the transform
+	// @param OutRho - the linear part of the twist
+	// @param OutOmega - the rotation vector of the twist
+	template<typename NumericType = double>
+	static void SE3Log(const EiVQuaternion<NumericType>& Rotation, const EiVVector3<NumericType>& Translation, EiVVector3<NumericType>& OutRho, EiVVector3<NumericType>& OutOmega)
+	{
+		FEiVLieGroups::SE3LogChunk(Rotation.coeffs().data(), Translation.data(), OutRho.data(), OutOmega.data(), 1);
+	}
+	// This function computes the left Jacobian of SO(3), which maps a change of the rotation vector to the matching
+	// angular change in the world frame. The right Jacobian is the left Jacobian of -Omega.
+	// @param Omega - the rotation vector
+	// @returns - the 3x3 left Jacobian
+	template<typename NumericType = double>
+	static EiVMatrix3<NumericType> SO3LeftJacobian(const EiVVector3<NumericType>& Omega)
+	{
+		const NumericType Theta2 = Omega.squaredNorm();
+		const NumericType Theta = std::sqrt(Theta2);
+		const NumericType K = FEiVLieGroups::HalfSinc(Theta2, Theta);
+		const EiVMatrix3<NumericType> Skew = FEiVLieGroups::SkewMatrix(Omega);
+		return EiVMatrix3<NumericType>::Identity() + (NumericType)2 * K * K * Skew + FEiVLieGroups::JacobianC(Theta2, Theta) * Skew * Skew;
+	}
+	// This function computes the inverse of the left Jacobian of SO(3)
+	// @param Omega - the rotation vector, its angle must be less than 2 pi
+	// @returns - the 3x3 inverse left Jacobian
+	template<typename NumericType = double>
+	static EiVMatrix3<NumericType> SO3LeftJacobianInverse(const EiVVector3<NumericType>& Omega)
+	{
+		const NumericType Theta2 = Omega.squaredNorm();
+		const NumericType Theta = std::sqrt(Theta2);
+		const EiVMatrix3<NumericType> Skew = FEiVLieGroups::SkewMatrix(Omega);
+		return EiVMatrix3<NumericType>::Identity() - (NumericType)0.5 * Skew + FEiVLieGroups::JacobianInverseD(Theta2, Theta) * Skew * Skew;
+	}
+	// This function interpolates two rotations along the shortest arc, A * exp(Alpha * log(A^-1 * B))
+	// @param A - the rotation at Alpha = 0
+	// @param B - the rotation at Alpha = 1
+	// @param Alpha - the interpolation parameter, values outside [0, 1] extrapolate
+	// @returns - the interpolated rotation
+	template<typename NumericType = double>
+	static EiVQuaternion<NumericType> SO3Interpolate(const EiVQuaternion<NumericType>& A, const EiVQuaternion<NumericType>& B, NumericType Alpha)
+	{
+		EiVQuaternion<NumericType> Rotation;
+		FEiVLieGroups::SO3InterpolateChunk(A.coeffs().data(), B.coeffs().data(), Alpha, Rotation.coeffs().data(), 1);
+		return Rotation;
+	}
+	// This function interpolates two rigid transforms along the screw motion between them, A * exp(Alpha * log(A^-1 * B)).
+	// Unlike interpolating the rotation and translation separately, a point fixed to the body moves on a helix.
+	// @param RotationA - the rotation at Alpha = 0
+	// @param TranslationA - the translation at Alpha = 0
+	// @param RotationB - the rotation at Alpha = 1
+	// @param TranslationB - the translation at Alpha = 1
+	// @param Alpha - the interpolation parameter, values outside [0, 1] extrapolate
+	// @param OutRotation - the interpolated rotation
+	// @param OutTranslation - the interpolated translation
+	template<typename NumericType = double>
+	static void SE3Interpolate(const EiVQuaternion<NumericType>& RotationA, const EiVVector3<NumericType>& TranslationA, const EiVQuaternion<NumericType>& RotationB, const EiVVector3<NumericType>& TranslationB, NumericType Alpha, EiVQuaternion<NumericType>& OutRotation, EiVVector3<NumericType>& OutTranslation)
+	{
+		FEiVLieGroups::SE3InterpolateChunk(RotationA.coeffs().data(), TranslationA.data(), RotationB.coeffs().data(), TranslationB.data(), Alpha, OutRotation.coeffs().data(), OutTranslation.data(), 1);
+	}
+
+	// This function computes SO(3) exp for a batch of rotation vectors
+	// @param Omegas - Count rotation vectors, 3 numbers each
+	// @param OutRotations - Count quaternions, 4 numbers each (x y z w)
+	// @param Count - the number of elements
+	template<typename NumericType = double>
+	static void SO3ExpBatch(const NumericType* Omegas, NumericType* OutRotations, int32 Count)
+	{
+		FEiVHelper::ForEachChunk(Count, ChunkSize, MinItemsPerTask, [=](int32 First, int32 Num)
+		{
+			FEiVLieGroups::SO3ExpChunk(Omegas + 3 * (int64)First, OutRotations + 4 * (int64)First, Num);
+		});
+	}
+	// This function computes SO(3) log for a batch of rotations
+	// @param Rotations - Count unit quaternions, 4 numbers each (x y z w)
+	// @param OutOmegas - Count rotation vectors, 3 numbers each
+	// @param Count - the number of elements
+	template<typename NumericType = double>
+	static void SO3LogBatch(const NumericType* Rotations, NumericType* OutOmegas, int32 Count)
+	{
+		FEiVHelper::ForEachChunk(Count, ChunkSize, MinItemsPerTask, [=](int32 First, int32 Num)
+		{
+			FEiVLieGroups::SO3LogChunk(Rotations + 4 * (int64)First, OutOmegas + 3 * (int64)First, Num);
+		});
+	}
+	// This function computes SE(3) exp for a batch of twists
+	// @param Rhos - Count linear parts, 3 numbers each
+	// @param Omegas - Count rotation vectors, 3 numbers each
+	// @param OutRotations - Count quaternions, 4 numbers each (x y z w)
+	// @param OutTranslations - Count translations, 3 numbers each
+	// @param Count - the number of elements
+	template<typename NumericType = double>
+	static void SE3ExpBatch(const NumericType* Rhos, const NumericType* Omegas, NumericType* OutRotations, NumericType* OutTranslations, int32 Count)
+	{
+		FEiVHelper::ForEachChunk(Count, ChunkSize, MinItemsPerTask, [=](int32 First, int32 Num)
+		{
+			FEiVLieGroups::SE3ExpChunk(Rhos + 3 * (int64)First, Omegas + 3 * (int64)First, OutRotations + 4 * (int64)First, OutTranslations + 3 * (int64)First, Num);
+		});
+	}
+	// This function computes SE(3) log for a batch of rigid transforms
+	// @param Rotations - Count unit quaternions, 4 numbers each (x y z w)
+	// @param Translations - Count translations, 3 numbers each
+	// @param OutRhos - Count linear parts, 3 numbers each
+	// @param OutOmegas - Count rotation vectors, 3 numbers each
+	// @param Count - the number of elements
+	template<typename NumericType = double>
+	static void SE3LogBatch(const NumericType* Rotations, const NumericType* Translations, NumericType* OutRhos, NumericType* OutOmegas, int32 Count)
+	{
+		FEiVHelper::ForEachChunk(Count, ChunkSize, MinItemsPerTask, [=](int32 First, int32 Num)
+		{
+			FEiVLieGroups::SE3LogChunk(Rotations + 4 * (int64)First, Translations + 3 * (int64)First, OutRhos + 3 * (int64)First, OutOmegas + 3 * (int64)First, Num);
+		});
+	}
+	// This function interpolates a batch of rotation pairs with the same Alpha, see SO3Interpolate
+	// @param RotationsA - Count unit quaternions at Alpha = 0, 4 numbers each (x y z w)
+	// @param RotationsB - Count unit quaternions at Alpha = 1, 4 numbers each (x y z w)
+	// @param Alpha - the interpolation parameter
+	// @param OutRotations - Count quaternions, 4 numbers each (x y z w)
+	// @param Count - the number of elements
+	template<typename NumericType = double>
+	static void SO3InterpolateBatch(const NumericType* RotationsA, const NumericType* RotationsB, NumericType Alpha, NumericType* OutRotations, int32 Count)
+	{
+		FEiVHelper::ForEachChunk(Count, ChunkSize, MinItemsPerTask, [=](int32 First, int32 Num)
+		{
+			FEiVLieGroups::SO3InterpolateChunk(RotationsA + 4 * (int64)First, RotationsB + 4 * (int64)First, Alpha, OutRotations + 4 * (int64)First, Num);
+		});
+	}
+	// This function interpolates a batch of rigid transform pairs with the same Alpha, see SE3Interpolate
+	// @param RotationsA - Count unit quaternions at Alpha = 0, 4 numbers each (x y z w)
+	// @param TranslationsA - Count translations at Alpha = 0, 3 numbers each
+	// @param RotationsB - Count unit quaternions at Alpha = 1, 4 numbers each (x y z w)
+	// @param TranslationsB - Count translations at Alpha = 1, 3 numbers each
+	// @param Alpha - the interpolation parameter
+	// @param OutRotations - Count quaternions, 4 numbers each (x y z w)
+	// @param OutTranslations - Count translations, 3 numbers each
+	// @param Count - the number of elements
+	template<typename NumericType = double>
+	static void SE3InterpolateBatch(const NumericType* RotationsA, const NumericType* TranslationsA, const NumericType* RotationsB, const NumericType* TranslationsB, NumericType Alpha, NumericType* OutRotations, NumericType* OutTranslations, int32 Count)
+	{
+		FEiVHelper::ForEachChunk(Count, ChunkSize, MinItemsPerTask, [=](int32 First, int32 Num)
+		{
+			FEiVLieGroups::SE3InterpolateChunk(RotationsA + 4 * (int64)First, TranslationsA + 3 * (int64)First, RotationsB + 4 * (int64)First, TranslationsB + 3 * (int64)First,
+				Alpha, OutRotations + 4 * (int64)First, OutTranslations + 3 * (int64)First, Num);
+		});
+	}
+	// This function computes the left Jacobian of SO(3) (or its inverse) for a batch of rotation vectors
+	// @param Omegas - Count rotation vectors, 3 numbers each
+	// @param OutJacobians - Count column-major 3x3 matrices, 9 numbers each
+	// @param Count - the number of elements
+	// @param bInverse - if true the inverse left Jacobians are computed
+	template<typename NumericType = double>
+	static void SO3LeftJacobianBatch(const NumericType* Omegas, NumericType* OutJacobians, int32 Count, bool bInverse = false)
+	{
+		FEiVHelper::ForEachChunk(Count, ChunkSize, MinItemsPerTask, [=](int32 First, int32 Num)
+		{
+			for (int32 i = First; i < First + Num; i++) {
+				const EiVMap<const EiVVector3<NumericType>> Omega(Omegas + 3 * (int64)i);
+				EiVMap<EiVMatrix3<NumericType>>(OutJacobians + 9 * (int64)i) = bInverse ? FEiVLieGroups::SO3LeftJacobianInverse<NumericType>(Omega) : FEiVLieGroups::SO3LeftJacobian<NumericType>(Omega);
+			}
+		});
+	}
+
+private:
+	// chunks are gathered into structure of arrays form (one row per component), so every operation runs over
+	// contiguous rows and vectorizes
+	template<typename NumericType> using TRow = EiVArray<NumericType, 1, EiVDynamic, Eigen::RowMajor, 1, ChunkSize>;
+	template<typename NumericType> using TRows3 = EiVArray<NumericType, 3, EiVDynamic, Eigen::RowMajor, 3, ChunkSize>;
+	template<typename NumericType> using TRows4 = EiVArray<NumericType, 4, EiVDynamic, Eigen::RowMajor, 4, ChunkSize>;
+	template<typename NumericType> using TConstMap3 = EiVMap<const EiVArray3X<NumericType>>;
+	template<typename NumericType> using TConstMap4 = EiVMap<const EiVArray4X<NumericType>>;
+	template<typename NumericType> using TMap3 = EiVMap<EiVArray3X<NumericType>>;
+	template<typename NumericType> using TMap4 = EiVMap<EiVArray4X<NumericType>>;
+
+	// squared angles below this use the Taylor series of the coefficients, the closed forms lose precision to cancellation
+	template<typename NumericType>
+	static constexpr NumericType SeriesThreshold()
+	{
+		return sizeof(NumericType) <= 4 ? (NumericType)0.5 : (NumericType)0.01;
+	}
+
+	// sin(theta/2) / theta
+	template<typename NumericType>
+	static NumericType HalfSinc(NumericType Theta2, NumericType Theta)
+	{
+		return Theta2 < SeriesThreshold<NumericType>() ? (NumericType)(0.5 - Theta2 * (1.0 / 48.0 - Theta2 * (1.0 / 3840.0 - Theta2 * (1.0 / 645120.0)))) : std::sin((NumericType)0.5 * Theta) / Theta;
+	}
+	// (theta - sin(theta)) / theta^3
+	template<typename NumericType>
+	static NumericType JacobianC(NumericType Theta2, NumericType Theta)
+	{
+		return Theta2 < SeriesThreshold<NumericType>() ? (NumericType)(1.0 / 6.0 - Theta2 * (1.0 / 120.0 - Theta2 * (1.0 / 5040.0 - Theta2 * (1.0 / 362880.0)))) : (Theta - std::sin(Theta)) / (Theta2 * Theta);
+	}
+	// (1 - (theta/2) * cot(theta/2)) / theta^2
+	template<typename NumericType>
+	static NumericType JacobianInverseD(NumericType Theta2, NumericType Theta)
+	{
+		const NumericType Half = (NumericType)0.5 * Theta;
+		return Theta2 < SeriesThreshold<NumericType>() ? (NumericType)(1.0 / 12.0 + Theta2 * (1.0 / 720.0 + Theta2 * (1.0 / 30240.0 + Theta2 * (1.0 / 1209600.0)))) : ((NumericType)1 - Half * std::cos(Half) / std::sin(Half)) / Theta2;
+	}
+	template<typename NumericType>
+	static EiVMatrix3<NumericType> SkewMatrix(const EiVVector3<NumericType>& V)
+	{
+		EiVMatrix3<NumericType> Skew;
+		Skew << 0, -V.z(), V.y(),
+			V.z(), 0, -V.x(),
+			-V.y(), V.x(), 0;
+		return Skew;
+	}
+	template<typename NumericType>
+	static TRow<NumericType> SquaredNorms(const TRows3<NumericType>& V)
+	{
+		return V.row(0).square() + V.row(1).square() + V.row(2).square();
+	}
+	// Eigen 3.4 evaluates select coefficient by coefficient, so both sides are evaluated into arrays first, which keeps
+	// the expensive math (sin, cos, division) vectorized
+	template<typename NumericType>
+	static TRow<NumericType> Select(const TRow<NumericType>& Condition, const TRow<NumericType>& Then, const TRow<NumericType>& Else)
+	{
+		return (Condition != (NumericType)0).select(Then, Else);
+	}
+	template<typename NumericType>
+	static TRow<NumericType> IsSeries(const TRow<NumericType>& Theta2)
+	{
+		return (Theta2 < SeriesThreshold<NumericType>()).template cast<NumericType>();
+	}
+	// atan2(Y, X) for Y >= 0 and X >= 0, not both zero. std::atan2 does not vectorize, so this is the Cephes atan
+	// (range reduction to |x| <= tan(pi/8) and a rational approximation), which is accurate to double precision
+	template<typename NumericType>
+	static TRow<NumericType> NonNegativeAtan2(const TRow<NumericType>& Y, const TRow<NumericType>& X)
+	{
+		const TRow<NumericType> bLarge = (Y > (NumericType)2.41421356237309504880 * X).template cast<NumericType>();
+		const TRow<NumericType> bMedium = (Y > (NumericType)0.66 * X).template cast<NumericType>() * ((NumericType)1 - bLarge);
+		const TRow<NumericType> LargeRatio = -X / Y;
+		const TRow<NumericType> MediumRatio = (Y - X) / (Y + X);
+		const TRow<NumericType> SmallRatio = Y / X;
+		const TRow<NumericType> Ratio = FEiVLieGroups::Select(bLarge, LargeRatio, FEiVLieGroups::Select(bMedium, MediumRatio, SmallRatio));
+		const TRow<NumericType> Offset = bLarge * (NumericType)(UE_DOUBLE_PI / 2.0) + bMedium * (NumericType)(UE_DOUBLE_PI / 4.0);
+		const TRow<NumericType> Z = Ratio.square();
+		const TRow<NumericType> P = (((((NumericType)-8.750608600031904122785E-1 * Z - (NumericType)1.615753718733365076637E1) * Z - (NumericType)7.500855792314704667340E1) * Z
+			- (NumericType)1.228866684490136173410E2) * Z - (NumericType)6.485021904942025371773E1);
+		const TRow<NumericType> Q = (((((Z + (NumericType)2.485846490142306297962E1) * Z + (NumericType)1.650270098316988542046E2) * Z + (NumericType)4.328810604912902668951E2) * Z
+			+ (NumericType)4.853903996359136964868E2) * Z + (NumericType)1.945506571482613964425E2);
+		return Offset + Ratio + Ratio * Z * P / Q;
+	}
+	// scales each column, row by row because the rowwise broadcast does not vectorize
+	template<typename NumericType, typename OutType>
+	static void ScaleColumns(const TRows3<NumericType>& In, const TRow<NumericType>& Scale, OutType& Out)
+	{
+		Out.row(0) = In.row(0) * Scale;
+		Out.row(1) = In.row(1) * Scale;
+		Out.row(2) = In.row(2) * Scale;
+	}
+	// column-wise cross products
+	template<typename NumericType>
+	static void CrossColumns(const TRows3<NumericType>& A, const TRows3<NumericType>& B, TRows3<NumericType>& Out)
+	{
+		Out.row(0) = A.row(1) * B.row(2) - A.row(2) * B.row(1);
+		Out.row(1) = A.row(2) * B.row(0) - A.row(0) * B.row(2);
+		Out.row(2) = A.row(0) * B.row(1) - A.row(1) * B.row(0);
+	}
+
+	template<typename NumericType>
+	static void SO3ExpSoA(const TRows3<NumericType>& Omega, TRows4<NumericType>& OutRotation)
+	{
+		const TRow<NumericType> Theta2 = FEiVLieGroups::SquaredNorms(Omega);
+		const TRow<NumericType> Theta = Theta2.sqrt();
+		const TRow<NumericType> Half = (NumericType)0.5 * Theta;
+		const TRow<NumericType> KSeries = (NumericType)0.5 - Theta2 * ((NumericType)(1.0 / 48.0) - Theta2 * ((NumericType)(1.0 / 3840.0) - Theta2 * (NumericType)(1.0 / 645120.0)));
+		// the closed form is NaN for zero angles but is never selected there
+		const TRow<NumericType> KClosed = Half.sin() / Theta;
+		const TRow<NumericType> K = FEiVLieGroups::Select(FEiVLieGroups::IsSeries(Theta2), KSeries, KClosed);
+		OutRotation.resize(4, Omega.cols());
+		FEiVLieGroups::ScaleColumns(Omega, K, OutRotation);
+		OutRotation.row(3) = Half.cos();
+	}
+
+	template<typename NumericType>
+	static void SO3LogSoA(const TRows4<NumericType>& Rotation, TRows3<NumericType>& OutOmega)
+	{
+		// q and -q are the same rotation, using the one with w >= 0 keeps the angle in [0, pi]
+		const TRow<NumericType> Sign = (NumericType)1 - (NumericType)2 * (Rotation.row(3) < (NumericType)0).template cast<NumericType>();
+		const TRow<NumericType> W = Rotation.row(3) * Sign;
+		const TRow<NumericType> VNorm2 = Rotation.row(0).square() + Rotation.row(1).square() + Rotation.row(2).square();
+		const TRow<NumericType> VNorm = VNorm2.sqrt();
+		const TRow<NumericType> Angle = (NumericType)2 * FEiVLieGroups::NonNegativeAtan2(VNorm, W);
+		// theta / |v| = 2 atan(|v| / w) / |v| ~ (2 / w) * (1 - |v|^2 / (3 w^2)) for tiny |v|
+		const TRow<NumericType> ScaleSeries = (NumericType)2 / W * ((NumericType)1 - VNorm2 / ((NumericType)3 * W.square()));
+		const TRow<NumericType> ScaleClosed = Angle / VNorm;
+		const TRow<NumericType> bSeries = (VNorm2 < Eigen::NumTraits<NumericType>::epsilon()).template cast<NumericType>();
+		const TRow<NumericType> Scale = Sign * FEiVLieGroups::Select(bSeries, ScaleSeries, ScaleClosed);
+		OutOmega.resize(3, Rotation.cols());
+		OutOmega.row(0) = Rotation.row(0) * Scale;
+		OutOmega.row(1) = Rotation.row(1) * Scale;
+		OutOmega.row(2) = Rotation.row(2) * Scale;
+	}
+
+	template<typename NumericType>
+	static void SE3ExpSoA(const TRows3<NumericType>& Rho, const TRows3<NumericType>& Omega, TRows4<NumericType>& OutRotation, TRows3<NumericType>& OutTranslation)
+	{
+		const TRow<NumericType> Theta2 = FEiVLieGroups::SquaredNorms(Omega);
+		const TRow<NumericType> Theta = Theta2.sqrt();
+		const TRow<NumericType> Half = (NumericType)0.5 * Theta;
+		const TRow<NumericType> bSeries = FEiVLieGroups::IsSeries(Theta2);
+		const TRow<NumericType> KSeries = (NumericType)0.5 - Theta2 * ((NumericType)(1.0 / 48.0) - Theta2 * ((NumericType)(1.0 / 3840.0) - Theta2 * (NumericType)(1.0 / 645120.0)));
+		const TRow<NumericType> KClosed = Half.sin() / Theta;
+		const TRow<NumericType> K = FEiVLieGroups::Select(bSeries, KSeries, KClosed);
+		// t = J * rho = rho + B * (omega x rho) + C * (omega x (omega x rho)),
+		// B = (1 - cos(theta)) / theta^2 = 2 K^2, C = (theta - sin(theta)) / theta^3
+		const TRow<NumericType> B = (NumericType)2 * K.square();
+		const TRow<NumericType> CSeries = (NumericType)(1.0 / 6.0) - Theta2 * ((NumericType)(1.0 / 120.0) - Theta2 * ((NumericType)(1.0 / 5040.0) - Theta2 * (NumericType)(1.0 / 362880.0)));
+		const TRow<NumericType> CClosed = (Theta - Theta.sin()) / (Theta2 * Theta);
+		const TRow<NumericType> C = FEiVLieGroups::Select(bSeries, CSeries, CClosed);
+		TRows3<NumericType> OmegaRho(3, Omega.cols()), OmegaOmegaRho(3, Omega.cols());
+		FEiVLieGroups::CrossColumns(Omega, Rho, OmegaRho);
+		FEiVLieGroups::CrossColumns(Omega, OmegaRho, OmegaOmegaRho);
+		OutTranslation.resize(3, Omega.cols());
+		for (int32 Row = 0; Row < 3; Row++) {
+			OutTranslation.row(Row) = Rho.row(Row) + OmegaRho.row(Row) * B + OmegaOmegaRho.row(Row) * C;
+		}
+		OutRotation.resize(4, Omega.cols());
+		FEiVLieGroups::ScaleColumns(Omega, K, OutRotation);
+		OutRotation.row(3) = Half.cos();
+	}
+
+	template<typename NumericType>
+	static void SE3LogSoA(const TRows4<NumericType>& Rotation, const TRows3<NumericType>& Translation, TRows3<NumericType>& OutRho, TRows3<NumericType>& OutOmega)
+	{
+		FEiVLieGroups::SO3LogSoA(Rotation, OutOmega);
+		// rho = J^-1 * t = t - (omega x t) / 2 + D * (omega x (omega x t)), D = (1 - (theta/2) * cot(theta/2)) / theta^2
+		const TRow<NumericType> Theta2 = FEiVLieGroups::SquaredNorms(OutOmega);
+		const TRow<NumericType> Half = (NumericType)0.5 * Theta2.sqrt();
+		const TRow<NumericType> DSeries = (NumericType)(1.0 / 12.0) + Theta2 * ((NumericType)(1.0 / 720.0) + Theta2 * ((NumericType)(1.0 / 30240.0) + Theta2 * (NumericType)(1.0 / 1209600.0)));
+		const TRow<NumericType> DClosed = ((NumericType)1 - Half * Half.cos() / Half.sin()) / Theta2;
+		const TRow<NumericType> D = FEiVLieGroups::Select(FEiVLieGroups::IsSeries(Theta2), DSeries, DClosed);
+		TRows3<NumericType> OmegaT(3, Translation.cols()), OmegaOmegaT(3, Translation.cols());
+		FEiVLieGroups::CrossColumns(OutOmega, Translation, OmegaT);
+		FEiVLieGroups::CrossColumns(OutOmega, OmegaT, OmegaOmegaT);
+		OutRho.resize(3, Translation.cols());
+		for (int32 Row = 0; Row < 3; Row++) {
+			OutRho.row(Row) = Translation.row(Row) - (NumericType)0.5 * OmegaT.row(Row) + OmegaOmegaT.row(Row) * D;
+		}
+	}
+
+	// the chunk functions gather the packed input into stack arrays before writing any output, so outputs may alias inputs
+	template<typename NumericType>
+	static void SO3ExpChunk(const NumericType* Omegas, NumericType* OutRotations, int32 Num)
+	{
+		const TRows3<NumericType> Omega = TConstMap3<NumericType>(Omegas, 3, Num);
+		TRows4<NumericType> Rotation;
+		FEiVLieGroups::SO3ExpSoA(Omega, Rotation);
+		TMap4<NumericType>(OutRotations, 4, Num) = Rotation;
+	}
+
+	template<typename NumericType>
+	static void SO3LogChunk(const NumericType* Rotations, NumericType* OutOmegas, int32 Num)
+	{
+		const TRows4<NumericType> Rotation = TConstMap4<NumericType>(Rotations, 4, Num);
+		TRows3<NumericType> Omega;
+		FEiVLieGroups::SO3LogSoA(Rotation, Omega);
+		TMap3<NumericType>(OutOmegas, 3, Num) = Omega;
+	}
+
+	template<typename NumericType>
+	static void SE3ExpChunk(const NumericType* Rhos, const NumericType* Omegas, NumericType* OutRotations, NumericType* OutTranslations, int32 Num)
+	{
+		const TRows3<NumericType> Rho = TConstMap3<NumericType>(Rhos, 3, Num);
+		const TRows3<NumericType> Omega = TConstMap3<NumericType>(Omegas, 3, Num);
+		TRows4<NumericType> Rotation;
+		TRows3<NumericType> Translation;
+		FEiVLieGroups::SE3ExpSoA(Rho, Omega, Rotation, Translation);
+		TMap4<NumericType>(OutRotations, 4, Num) = Rotation;
+		TMap3<NumericType>(OutTranslations, 3, Num) = Translation;
+	}
+
+	template<typename NumericType>
+	static void SE3LogChunk(const NumericType* Rotations, const NumericType* Translations, NumericType* OutRhos, NumericType* OutOmegas, int32 Num)
+	{
+		const TRows4<NumericType> Rotation = TConstMap4<NumericType>(Rotations, 4, Num);
+		const TRows3<NumericType> Translation = TConstMap3<NumericType>(Translations, 3, Num);
+		TRows3<NumericType> Rho, Omega;
+		FEiVLieGroups::SE3LogSoA(Rotation, Translation, Rho, Omega);
+		TMap3<NumericType>(OutRhos, 3, Num) = Rho;
+		TMap3<NumericType>(OutOmegas, 3, Num) = Omega;
+	}
+
+	template<typename NumericType>
+	static void SO3InterpolateChunk(const NumericType* RotationsA, const NumericType* RotationsB, NumericType Alpha, NumericType* OutRotations, int32 Num)
+	{
+		typedef EiVMap<const EiVQuaternion<NumericType>> ConstQuaternionMap;
+		TRows4<NumericType> Delta(4, Num);
+		for (int32 i = 0; i < Num; i++) {
+			Delta.col(i) = (ConstQuaternionMap(RotationsA + 4 * i).conjugate() * ConstQuaternionMap(RotationsB + 4 * i)).coeffs().array();
+		}
+		TRows3<NumericType> Omega;
+		FEiVLieGroups::SO3LogSoA(Delta, Omega);
+		Omega *= Alpha;
+		FEiVLieGroups::SO3ExpSoA(Omega, Delta);
+		for (int32 i = 0; i < Num; i++) {
+			const EiVQuaternion<NumericType> Step(Delta(3, i), Delta(0, i), Delta(1, i), Delta(2, i));
+			const EiVQuaternion<NumericType> Rotation = ConstQuaternionMap(RotationsA + 4 * i) * Step;
+			EiVMap<EiVQuaternion<NumericType>>(OutRotations + 4 * i) = Rotation;
+		}
+	}
+
+	template<typename NumericType>
+	static void SE3InterpolateChunk(const NumericType* RotationsA, const NumericType* TranslationsA, const NumericType* RotationsB, const NumericType* TranslationsB, NumericType Alpha, NumericType* OutRotations, NumericType* OutTranslations, int32 Num)
+	{
+		typedef EiVMap<const EiVQuaternion<NumericType>> ConstQuaternionMap;
+		typedef EiVMap<const EiVVector3<NumericType>> ConstVectorMap;
+		// A^-1 * B = (qa^-1 * qb, qa^-1 * (tb - ta))
+		TRows4<NumericType> DeltaRotation(4, Num);
+		TRows3<NumericType> DeltaTranslation(3, Num);
+		for (int32 i = 0; i < Num; i++) {
+			const EiVQuaternion<NumericType> InverseA = ConstQuaternionMap(RotationsA + 4 * i).conjugate();
+			DeltaRotation.col(i) = (InverseA * ConstQuaternionMap(RotationsB + 4 * i)).coeffs().array();
+			DeltaTranslation.col(i) = (InverseA * (ConstVectorMap(TranslationsB + 3 * i) - ConstVectorMap(TranslationsA + 3 * i))).array();
+		}
+		TRows3<NumericType> Rho, Omega;
+		FEiVLieGroups::SE3LogSoA(DeltaRotation, DeltaTranslation, Rho, Omega);
+		Rho *= Alpha;
+		Omega *= Alpha;
+		FEiVLieGroups::SE3ExpSoA(Rho, Omega, DeltaRotation, DeltaTranslation);
+		for (int32 i = 0; i < Num; i++) {
+			const EiVQuaternion<NumericType> RotationA = ConstQuaternionMap(RotationsA + 4 * i);
+			const EiVQuaternion<NumericType> Step(DeltaRotation(3, i), DeltaRotation(0, i), DeltaRotation(1, i), DeltaRotation(2, i));
+			const EiVVector3<NumericType> Translation = ConstVectorMap(TranslationsA + 3 * i) + RotationA * EiVVector3<NumericType>(DeltaTranslation(0, i), DeltaTranslation(1, i), DeltaTranslation(2, i));
+			const EiVQuaternion<NumericType> Rotation = RotationA * Step;
+			EiVMap<EiVQuaternion<NumericType>>(OutRotations + 4 * i) = Rotation;
+			EiVMap<EiVVector3<NumericType>>(OutTranslations + 3 * i) = Translation;
+		}
+	}
+};
@@ -0,0 +1,809 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+//<><><><><><><><><><><><> EiVLibrary Import Block <><><><><><><><><><><><>
+//imports the specified headers by the macro definitions
+
+#define EIV_INCLUDE_DENSE_MATRIX_ARRAY    //includes most core and basic features
+#define EIV_INCLUDE_SPARSECORE            //includes sparse matrix storage and products
+#define EIV_UNDEFINE_INCLUDES             //ensures that these include macros above are local to this file
+
+#include "EiVLibrary.h"   //takes the EIV_INCLUDE macros as settings and retrieves
+                          //the specified Eigen modules, typedefs, and helper functions
+//<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>
+#include "HAL/FileManager.h"
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+
+/*
+* Streaming text import and export of matrices. Dense matrices can be read and written as delimited text (CSV, TSV)
+* and dense or sparse matrices as Matrix Market (.mtx) files in the coordinate or array format. Files are read and
+* written in fixed size chunks, so a file never has to sit fully in memory, and the entries are parsed straight into
+* the matrix or a triplet buffer.
+*/
+
+// Reads a text file (or a block of memory) line by line, holding at most one chunk and the current line in memory
+class FEiVTextLineReader
+{
+public:
+	// The number of bytes read from the archive at once
+	static constexpr int64 ChunkSize = 1 << 20;
+
+	// @param InArchive - the archive to read, it must outlive this reader
+	explicit FEiVTextLineReader(FArchive& InArchive)
+		: Archive(&InArchive)
+	{
+		Remaining = InArchive.TotalSize() - InArchive.Tell();
+		Buffer.SetNumUninitialized(ChunkSize);
+		Data = Buffer.GetData();
+	}
+	// @param InData - the text to read, it must outlive this reader
+	// @param InSize - the number of bytes in InData
+	FEiVTextLineReader(const ANSICHAR* InData, int64 InSize)
+		: Data(InData), End(InSize)
+	{
+	}
+
+	// This function reads the next line
+	// @param OutBegin - the first character of the line
+	// @param OutEnd - one past the last character of the line, without the line break
+	// @returns - false at the end of the text or if the archive failed
+	bool ReadLine(const ANSICHAR*& OutBegin, const ANSICHAR*& OutEnd)
+	{
+		int64 Searched = Cursor;
+		for (;;) {
+			const ANSICHAR* LineBreak = End > Searched ? (const ANSICHAR*)std::memchr(Data + Searched, '\n', End - Searched) : nullptr;
+			if (LineBreak) {
+				OutBegin = Data + Cursor;
+				OutEnd = LineBreak;
+				Cursor = (LineBreak - Data) + 1;
+				break;
+			}
+			Searched = End;
+			if (!Refill(Searched)) {
+				if (Cursor == End || bError) {
+					return false;
+				}
+				OutBegin = Data + Cursor;
+				OutEnd = Data + End;
+				Cursor = End;
+				break;
+			}
+		}
+		if (OutEnd > OutBegin && OutEnd[-1] == '\r') {
+			OutEnd--;
+		}
+		LineNumber++;
+		return true;
+	}
+	// @returns - the number of the last line read, starting at 1
+	int64 GetLineNumber() const
+	{
+		return LineNumber;
+	}
+	// @returns - true if the archive failed while reading
+	bool IsError() const
+	{
+		return bError;
+	}
+
+private:
+	// moves the unread part of the buffer to the front and reads the next chunk behind it
+	bool Refill(int64& InOutSearched)
+	{
+		if (!Archive || Remaining <= 0 || bError) {
+			return false;
+		}
+		const int64 Unread = End - Cursor;
+		if (Cursor > 0) {
+			FMemory::Memmove(Buffer.GetData(), Buffer.GetData() + Cursor, Unread);
+			InOutSearched -= Cursor;
+			Cursor = 0;
+		}
+		if (Unread + ChunkSize > Buffer.Num()) {
+			// a single line longer than the buffer
+			Buffer.SetNumUninitialized(Unread + ChunkSize);
+		}
+		const int64 Count = FMath::Min<int64>(ChunkSize, Remaining);
+		Archive->Serialize(Buffer.GetData() + Unread, Count);
+		bError = Archive->IsError();
+		Remaining -= Count;
+		Data = Buffer.GetData();
+		End = Unread + Count;
+		return !bError;
+	}
+
+	FArchive* Archive = nullptr;
+	TArray<ANSICHAR> Buffer;
+	const ANSICHAR* Data = nullptr;
+	int64 Cursor = 0;
+	int64 End = 0;
+	int64 Remaining = 0;
+	int64 LineNumber = 0;
+	bool bError = false;
+};
+
+// Writes text to an archive through a fixed size buffer, or into memory if there is no archive
+class FEiVTextWriter
+{
+public:
+	// The number of bytes collected before they are written to the archive
+	static constexpr int32 ChunkSize = 1 << 20;
+
+	// Collects all the text in memory, see GetText
+	FEiVTextWriter()
+	{
+	}
+	// @param InArchive - the archive to write, it must outlive this writer
+	explicit FEiVTextWriter(FArchive& InArchive)
+		: Archive(&InArchive)
+	{
+		Buffer.Reserve(ChunkSize + 64);
+	}
+	~FEiVTextWriter()
+	{
+		Flush();
+	}
+
+	// This function appends characters
+	// @param InText - the characters to append
+	// @param Length - the number of characters to append
+	void Append(const ANSICHAR* InText, int32 Length)
+	{
+		Buffer.Append(InText, Length);
+		if (Archive && Buffer.Num() >= ChunkSize) {
+			Flush();
+		}
+	}
+	// This function appends a null terminated string
+	void Append(const ANSICHAR* InText)
+	{
+		Append(InText, FCStringAnsi::Strlen(InText));
+	}
+	// This function appends a single character
+	void Append(ANSICHAR Character)
+	{
+		Append(&Character, 1);
+	}
+	// This function appends a number, see FEiVMatrixIO::FormatNumber
+	void AppendNumber(double Value);
+	// This function appends an integer
+	void AppendInteger(int64 Value)
+	{
+		ANSICHAR Text[24];
+		const std::to_chars_result Result = std::to_chars(Text, Text + 24, Value);
+		Append(Text, (int32)(Result.ptr - Text));
+	}
+	// This function writes the buffered text to the archive
+	void Flush()
+	{
+		if (Archive && Buffer.Num() > 0) {
+			Archive->Serialize(Buffer.GetData(), Buffer.Num());
+			Buffer.Reset();
+		}
+	}
+	// @returns - true if the archive failed while writing
+	bool IsError() const
+	{
+		return Archive && Archive->IsError();
+	}
+	// @returns - the text written so far if there is no archive
+	const TArray<ANSICHAR>& GetText() const
+	{
+		return Buffer;
+	}
+
+private:
+	FArchive* Archive = nullptr;
+	TArray<ANSICHAR> Buffer;
+};
+
+// The banner and size line of a Matrix Market file
+struct FEiVMatrixMarketHeader
+{
+	int64 Rows = 0;
+	int64 Cols = 0;
+	// The number of entries listed in the file, for the array format this is the number of listed values
+	int64 Entries = 0;
+	// Coordinate (sparse) or array (dense) format
+	bool bCoordinate = true;
+	// A pattern matrix has no values, all its entries are 1
+	bool bPattern = false;
+	// Only the lower triangle is listed, the upper triangle is the same
+	bool bSymmetric = false;
+	// Only the strictly lower triangle is listed, the upper triangle is its negation
+	bool bSkewSymmetric = false;
+};
+
+/*
+* Reading and writing matrices as text.
+* For this whole struct the <NumericType> is the datatype of the numbers stored in the Eigen types.
+*/
+struct EIV_API FEiVMatrixIO
+{
+	// The largest number of characters FormatNumber writes, including the null terminator
+	static constexpr int32 MaxNumberLength = 32;
+
+	// This function parses a decimal number. Numbers with up to 15 significant digits and a small exponent are parsed
+	// exactly without calling the C library, everything else (long numbers, inf, nan) falls back to strtod.
+	// @param InOutCursor - the first character of the number, moved past the number on success
+	// @param End - one past the last character which may be read
+	// @param OutValue - the parsed number
+	// @returns - false if there is no number at the cursor
+	static bool ParseNumber(const ANSICHAR*& InOutCursor, const ANSICHAR* End, double& OutValue)
+	{
+		static const double PowersOfTen[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+			1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+		const ANSICHAR* Cursor = InOutCursor;
+		bool bNegative = false;
+		if (Cursor < End && (*Cursor == '-' || *Cursor == '+')) {
+			bNegative = *Cursor == '-';
+			Cursor++;
+		}
+		uint64 Mantissa = 0;
+		int32 Digits = 0;
+		int32 Exponent = 0;
+		bool bAnyDigit = false;
+		bool bTruncated = false;
+		for (; Cursor < End && *Cursor >= '0' && *Cursor <= '9'; Cursor++) {
+			bAnyDigit = true;
+			if (Digits < 19) {
+				Mantissa = Mantissa * 10 + (*Cursor - '0');
+				Digits += Mantissa != 0;
+			}
+			else {
+				Exponent++;
+				bTruncated = true;
+			}
+		}
+		if (Cursor < End && *Cursor == '.') {
+			for (Cursor++; Cursor < End && *Cursor >= '0' && *Cursor <= '9'; Cursor++) {
+				bAnyDigit = true;
+				if (Digits < 19) {
+					Mantissa = Mantissa * 10 + (*Cursor - '0');
+					Digits += Mantissa != 0;
+					Exponent--;
+				}
+				else {
+					bTruncated = true;
+				}
+			}
+		}
+		if (!bAnyDigit) {
+			return ParseNumberFallback(InOutCursor, End, OutValue);
+		}
+		if (Cursor < End && (*Cursor == 'e' || *Cursor == 'E')) {
+			const ANSICHAR* ExponentCursor = Cursor + 1;
+			bool bNegativeExponent = false;
+			if (ExponentCursor < End && (*ExponentCursor == '-' || *ExponentCursor == '+')) {
+				bNegativeExponent = *ExponentCursor == '-';
+				ExponentCursor++;
+			}
+			if (ExponentCursor < End && *ExponentCursor >= '0' && *ExponentCursor <= '9') {
+				int32 ExplicitExponent = 0;
+				for (; ExponentCursor < End && *ExponentCursor >= '0' && *ExponentCursor <= '9'; ExponentCursor++) {
+					ExplicitExponent = FMath::Min(ExplicitExponent * 10 + (*ExponentCursor - '0'), 100000);
+				}
+				Exponent += bNegativeExponent ? -ExplicitExponent : ExplicitExponent;
+				Cursor = ExponentCursor;
+			}
+		}
+		if (Mantissa == 0) {
+			OutValue = bNegative ? -0.0 : 0.0;
+		}
+		else if (!bTruncated && Digits <= 15 && Exponent >= -22 && Exponent <= 22) {
+			// both the mantissa and the power of ten are exact doubles, so a single rounding gives the correctly rounded result
+			OutValue = Exponent < 0 ? (double)Mantissa / PowersOfTen[-Exponent] : (double)Mantissa * PowersOfTen[Exponent];
+			OutValue = bNegative ? -OutValue : OutValue;
+		}
+		else {
+			return ParseNumberFallback(InOutCursor, End, OutValue);
+		}
+		InOutCursor = Cursor;
+		return true;
+	}
+	// This function parses a non-negative integer
+	// @param InOutCursor - the first character of the integer, moved past the integer on success
+	// @param End - one past the last character which may be read
+	// @param OutValue - the parsed integer
+	// @returns - false if there is no integer at the cursor
+	static bool ParseInteger(const ANSICHAR*& InOutCursor, const ANSICHAR* End, int64& OutValue)
+	{
+		const std::from_chars_result Result = std::from_chars(InOutCursor, End, OutValue);
+		if (Result.ec != std::errc()) {
+			return false;
+		}
+		InOutCursor = Result.ptr;
+		return true;
+	}
+	// This function formats a number with the fewest digits that read back to the same double where the standard
+	// library supports it, and with 17 significant digits otherwise
+	// @param Value - the number to format
+	// @param OutText - at least MaxNumberLength characters, the result is not null terminated
+	// @returns - the number of characters written
+	static int32 FormatNumber(double Value, ANSICHAR* OutText)
+	{
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+		const std::to_chars_result Result = std::to_chars(OutText, OutText + MaxNumberLength, Value);
+		return (int32)(Result.ptr - OutText);
+#else
+		return FMath::Clamp(FCStringAnsi::Snprintf(OutText, MaxNumberLength, "%.17g", Value), 0, MaxNumberLength - 1);
+#endif
+	}
+
+	//=================================== Delimited text ===================================//
+
+	// This function reads a dense matrix from delimited text (CSV, TSV). Every non-empty line is a row and every row
+	// must have the same number of values. Whitespace around the values is ignored.
+	// @param Reader - the text to read
+	// @param OutMatrix - the matrix read
+	// @param Delimiter - the character between the values of a row, for example ',' or '\t'
+	// @param bSkipHeader - if true the first non-empty line is skipped
+	// @returns - false if the text is not a valid matrix
+	template<typename NumericType = double>
+	static bool ReadDelimited(FEiVTextLineReader& Reader, EiVMatrixX<NumericType>& OutMatrix, const ANSICHAR Delimiter = ',', const bool bSkipHeader = false)
+	{
+		// the rows are parsed straight into a row-major matrix whose rows grow in doubling blocks, the first row is
+		// buffered on its own since it sets the number of columns
+		constexpr int64 FirstRowBlock = 256;
+		EiVRowMajorMatrixX<NumericType> Values;
+		TArray<NumericType> FirstRow;
+		int64 Rows = 0;
+		int64 Cols = -1;
+		bool bHeaderSkipped = !bSkipHeader;
+		const ANSICHAR* Line;
+		const ANSICHAR* LineEnd;
+		while (Reader.ReadLine(Line, LineEnd)) {
+			SkipBlanks(Line, LineEnd, Delimiter);
+			if (Line == LineEnd) {
+				continue;
+			}
+			if (!bHeaderSkipped) {
+				bHeaderSkipped = true;
+				continue;
+			}
+			if (Cols >= 0 && Rows == Values.rows()) {
+				Values.conservativeResize(2 * Rows, Cols);
+			}
+			int64 RowCols = 0;
+			for (;;) {
+				double Value;
+				if (!ParseNumber(Line, LineEnd, Value)) {
+					return false;
+				}
+				if (Cols < 0) {
+					FirstRow.Add((NumericType)Value);
+				}
+				else if (RowCols < Cols) {
+					Values(Rows, RowCols) = (NumericType)Value;
+				}
+				else {
+					return false;
+				}
+				RowCols++;
+				SkipBlanks(Line, LineEnd, Delimiter);
+				if (Line == LineEnd) {
+					break;
+				}
+				if (*Line != Delimiter) {
+					return false;
+				}
+				Line++;
+				SkipBlanks(Line, LineEnd, Delimiter);
+			}
+			if (Cols < 0) {
+				Cols = RowCols;
+				Values.resize(FirstRowBlock, Cols);
+				Values.row(0) = EiVMap<const EiVRowVectorX<NumericType>>(FirstRow.GetData(), Cols);
+			}
+			else if (RowCols != Cols) {
+				return false;
+			}
+			Rows++;
+		}
+		if (Reader.IsError()) {
+			return false;
+		}
+		OutMatrix = Values.topRows(Rows);
+		return true;
+	}
+	// This function reads a dense matrix from a delimited text file, see ReadDelimited above
+	template<typename NumericType = double>
+	static bool ReadDelimited(const FString& Path, EiVMatrixX<NumericType>& OutMatrix, const ANSICHAR Delimiter = ',', const bool bSkipHeader = false)
+	{
+		TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileReader(*Path));
+		if (!Archive) {
+			return false;
+		}
+		FEiVTextLineReader Reader(*Archive);
+		return FEiVMatrixIO::ReadDelimited(Reader, OutMatrix, Delimiter, bSkipHeader);
+	}
+	// This function writes a dense matrix as delimited text, one row per line
+	// @param Writer - where the text is written
+	// @param InMatrix - the matrix to write
+	// @param Delimiter - the character between the values of a row, for example ',' or '\t'
+	// @returns - false if the archive failed
+	template<typename Derived>
+	static bool WriteDelimited(FEiVTextWriter& Writer, const EiVMatrixBase<Derived>& InMatrix, const ANSICHAR Delimiter = ',')
+	{
+		for (int64 Row = 0; Row < InMatrix.rows(); Row++) {
+			for (int64 Col = 0; Col < InMatrix.cols(); Col++) {
+				if (Col > 0) {
+					Writer.Append(Delimiter);
+				}
+				Writer.AppendNumber((double)InMatrix.coeff(Row, Col));
+			}
+			Writer.Append('\n');
+		}
+		Writer.Flush();
+		return !Writer.IsError();
+	}
+	// This function writes a dense matrix to a delimited text file, see WriteDelimited above
+	template<typename Derived>
+	static bool WriteDelimited(const FString& Path, const EiVMatrixBase<Derived>& InMatrix, const ANSICHAR Delimiter = ',')
+	{
+		TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileWriter(*Path));
+		if (!Archive) {
+			return false;
+		}
+		{
+			FEiVTextWriter Writer(*Archive);
+			if (!FEiVMatrixIO::WriteDelimited(Writer, InMatrix, Delimiter)) {
+				return false;
+			}
+		}
+		return Archive->Close();
+	}
+
+	//==================================== Matrix Market ===================================//
+
+	// This function reads the banner and size line of a Matrix Market file. Real, integer and pattern matrices are supported.
+	// @param Reader - the text to read, left at the first entry
+	// @param OutHeader - the format and size of the matrix
+	// @returns - false if this is not a supported Matrix Market file
+	static bool ReadMatrixMarketHeader(FEiVTextLineReader& Reader, FEiVMatrixMarketHeader& OutHeader)
+	{
+		OutHeader = FEiVMatrixMarketHeader();
+		const ANSICHAR* Line;
+		const ANSICHAR* LineEnd;
+		if (!Reader.ReadLine(Line, LineEnd)) {
+			return false;
+		}
+		const ANSICHAR* Tokens[5][2];
+		int32 NumTokens = 0;
+		while (NumTokens < 5) {
+			SkipBlanks(Line, LineEnd, '\n');
+			if (Line == LineEnd) {
+				break;
+			}
+			Tokens[NumTokens][0] = Line;
+			while (Line < LineEnd && *Line != ' ' && *Line != '\t') {
+				Line++;
+			}
+			Tokens[NumTokens++][1] = Line;
+		}
+		if (NumTokens != 5 || !TokenEquals(Tokens[0], "%%matrixmarket") || !TokenEquals(Tokens[1], "matrix")) {
+			return false;
+		}
+		if (TokenEquals(Tokens[2], "coordinate")) {
+			OutHeader.bCoordinate = true;
+		}
+		else if (TokenEquals(Tokens[2], "array")) {
+			OutHeader.bCoordinate = false;
+		}
+		else {
+			return false;
+		}
+		if (TokenEquals(Tokens[3], "pattern")) {
+			OutHeader.bPattern = true;
+		}
+		else if (!TokenEquals(Tokens[3], "real") && !TokenEquals(Tokens[3], "double") && !TokenEquals(Tokens[3], "integer")) {
+			return false; //complex matrices are not supported
+		}
+		// a real hermitian matrix is symmetric
+		OutHeader.bSymmetric = TokenEquals(Tokens[4], "symmetric") || TokenEquals(Tokens[4], "hermitian");
+		OutHeader.bSkewSymmetric = TokenEquals(Tokens[4], "skew-symmetric");
+		if (!OutHeader.bSymmetric && !OutHeader.bSkewSymmetric && !TokenEquals(Tokens[4], "general")) {
+			return false;
+		}
+		if (OutHeader.bPattern && !OutHeader.bCoordinate) {
+			return false;
+		}
+		while (Reader.ReadLine(Line, LineEnd)) {
+			SkipBlanks(Line, LineEnd, '\n');
+			if (Line == LineEnd || *Line == '%') {
+				continue;
+			}
+			if (!ParseInteger(Line, LineEnd, OutHeader.Rows)) {
+				return false;
+			}
+			SkipBlanks(Line, LineEnd, '\n');
+			if (!ParseInteger(Line, LineEnd, OutHeader.Cols)) {
+				return false;
+			}
+			if (OutHeader.bCoordinate) {
+				SkipBlanks(Line, LineEnd, '\n');
+				if (!ParseInteger(Line, LineEnd, OutHeader.Entries)) {
+					return false;
+				}
+			}
+			else if (OutHeader.bSymmetric) {
+				OutHeader.Entries = OutHeader.Cols * (OutHeader.Cols + 1) / 2;
+			}
+			else if (OutHeader.bSkewSymmetric) {
+				OutHeader.Entries = OutHeader.Cols * (OutHeader.Cols - 1) / 2;
+			}
+			else {
+				OutHeader.Entries = OutHeader.Rows * OutHeader.Cols;
+			}
+			// Eigen sparse matrices use 32 bit indices
+			const bool bSquare = OutHeader.Rows == OutHeader.Cols || (!OutHeader.bSymmetric && !OutHeader.bSkewSymmetric);
+			return bSquare && OutHeader.Rows >= 0 && OutHeader.Cols >= 0 && OutHeader.Entries >= 0 && OutHeader.Rows <= MAX_int32 && OutHeader.Cols <= MAX_int32;
+		}
+		return false;
+	}
+	// This function reads the entries of a Matrix Market file and passes each of them to a function. The mirrored
+	// entries of symmetric matrices are passed as well, zeros listed in the array format are skipped.
+	// @param Reader - the text to read, after ReadMatrixMarketHeader
+	// @param InHeader - the header read by ReadMatrixMarketHeader
+	// @param OnEntry - called as OnEntry(int32 Row, int32 Col, double Value) with zero based indices
+	// @returns - false if an entry is malformed, out of range, or there are too few entries
+	template<typename EntryFunctionType>
+	static bool ReadMatrixMarketEntries(FEiVTextLineReader& Reader, const FEiVMatrixMarketHeader& InHeader, EntryFunctionType&& OnEntry)
+	{
+		int64 Read = 0;
+		int64 ArrayRow = InHeader.bSkewSymmetric ? 1 : 0;
+		int64 ArrayCol = 0;
+		const ANSICHAR* Line;
+		const ANSICHAR* LineEnd;
+		while (Read < InHeader.Entries && Reader.ReadLine(Line, LineEnd)) {
+			SkipBlanks(Line, LineEnd, '\n');
+			if (Line == LineEnd || *Line == '%') {
+				continue;
+			}
+			int64 Row;
+			int64 Col;
+			double Value = 1.0;
+			if (InHeader.bCoordinate) {
+				if (!ParseInteger(Line, LineEnd, Row)) {
+					return false;
+				}
+				SkipBlanks(Line, LineEnd, '\n');
+				if (!ParseInteger(Line, LineEnd, Col)) {
+					return false;
+				}
+				Row--;
+				Col--;
+				if (!InHeader.bPattern) {
+					SkipBlanks(Line, LineEnd, '\n');
+					if (!ParseNumber(Line, LineEnd, Value)) {
+						return false;
+					}
+				}
+				if (Row < 0 || Col < 0 || Row >= InHeader.Rows || Col >= InHeader.Cols) {
+					return false;
+				}
+			}
+			else {
+				// the array format lists the columns one after another, only the lower triangle for symmetric matrices
+				if (!ParseNumber(Line, LineEnd, Value)) {
+					return false;
+				}
+				Row = ArrayRow;
+				Col = ArrayCol;
+				if (++ArrayRow == InHeader.Rows) {
+					ArrayCol++;
+					ArrayRow = InHeader.bSymmetric ? ArrayCol : (InHeader.bSkewSymmetric ? ArrayCol + 1 : 0);
+				}
+				if (Value == 0.0) {
+					Read++;
+					continue;
+				}
+			}
+			OnEntry((int32)Row, (int32)Col, Value);
+			if (Row != Col && (InHeader.bSymmetric || InHeader.bSkewSymmetric)) {
+				OnEntry((int32)Col, (int32)Row, InHeader.bSkewSymmetric ? -Value : Value);
+			}
+			Read++;
+		}
+		return Read == InHeader.Entries && !Reader.IsError();
+	}
+	// This function reads the entries of a Matrix Market file into a triplet buffer
+	// @param Path - the .mtx file to read
+	// @param OutTriplets - the entries, with the mirrored entries of symmetric matrices
+	// @param OutRows - the rows of the matrix
+	// @param OutCols - the columns of the matrix
+	// @returns - false if the file could not be read or is not a supported Matrix Market file
+	template<typename NumericType = double>
+	static bool ReadMatrixMarket(const FString& Path, TArray<EiVTriplet<NumericType>>& OutTriplets, int32& OutRows, int32& OutCols)
+	{
+		TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileReader(*Path));
+		if (!Archive) {
+			return false;
+		}
+		FEiVTextLineReader Reader(*Archive);
+		FEiVMatrixMarketHeader Header;
+		if (!FEiVMatrixIO::ReadMatrixMarketHeader(Reader, Header)) {
+			return false;
+		}
+		OutTriplets.Reset();
+		OutTriplets.Reserve((int32)FMath::Min<int64>((Header.bSymmetric || Header.bSkewSymmetric) ? Header.Entries * 2 : Header.Entries, MAX_int32));
+		OutRows = (int32)Header.Rows;
+		OutCols = (int32)Header.Cols;
+		return FEiVMatrixIO::ReadMatrixMarketEntries(Reader, Header, [&OutTriplets](int32 Row, int32 Col, double Value)
+		{
+			OutTriplets.Add(EiVTriplet<NumericType>(Row, Col, (NumericType)Value));
+		});
+	}
+	// This function reads a Matrix Market file into a sparse matrix. Duplicate entries are summed.
+	// @param Path - the .mtx file to read
+	// @param OutMatrix - the compressed sparse matrix read
+	// @returns - false if the file could not be read or is not a supported Matrix Market file
+	template<typename NumericType = double>
+	static bool ReadMatrixMarket(const FString& Path, EiVSparseMatrix<NumericType>& OutMatrix)
+	{
+		TArray<EiVTriplet<NumericType>> Triplets;
+		int32 Rows;
+		int32 Cols;
+		if (!FEiVMatrixIO::ReadMatrixMarket(Path, Triplets, Rows, Cols)) {
+			return false;
+		}
+		OutMatrix.resize(Rows, Cols);
+		OutMatrix.setFromTriplets(Triplets.GetData(), Triplets.GetData() + Triplets.Num());
+		return true;
+	}
+	// This function reads Matrix Market text into a dense matrix, in the coordinate or array format
+	// @param Reader - the text to read
+	// @param OutMatrix - the dense matrix read, duplicate coordinate entries are summed
+	// @returns - false if the text is not a supported Matrix Market matrix
+	template<typename NumericType = double>
+	static bool ReadMatrixMarket(FEiVTextLineReader& Reader, EiVMatrixX<NumericType>& OutMatrix)
+	{
+		FEiVMatrixMarketHeader Header;
+		if (!FEiVMatrixIO::ReadMatrixMarketHeader(Reader, Header)) {
+			return false;
+		}
+		OutMatrix.setZero(Header.Rows, Header.Cols);
+		return FEiVMatrixIO::ReadMatrixMarketEntries(Reader, Header, [&OutMatrix](int32 Row, int32 Col, double Value)
+		{
+			OutMatrix.coeffRef(Row, Col) += (NumericType)Value;
+		});
+	}
+	// This function reads a Matrix Market file into a dense matrix, see ReadMatrixMarket above
+	template<typename NumericType = double>
+	static bool ReadMatrixMarket(const FString& Path, EiVMatrixX<NumericType>& OutMatrix)
+	{
+		TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileReader(*Path));
+		if (!Archive) {
+			return false;
+		}
+		FEiVTextLineReader Reader(*Archive);
+		return FEiVMatrixIO::ReadMatrixMarket(Reader, OutMatrix);
+	}
+	// This function writes a sparse matrix in the Matrix Market coordinate format
+	// @param Writer - where the text is written
+	// @param InMatrix - the sparse matrix to write, row or column-major
+	// @returns - false if the archive failed
+	template<typename Derived>
+	static bool WriteMatrixMarket(FEiVTextWriter& Writer, const EiVSparseMatrixBase<Derived>& InMatrix)
+	{
+		const Derived& Matrix = InMatrix.derived();
+		Writer.Append("%%MatrixMarket matrix coordinate real general\n");
+		Writer.AppendInteger(Matrix.rows());
+		Writer.Append(' ');
+		Writer.AppendInteger(Matrix.cols());
+		Writer.Append(' ');
+		Writer.AppendInteger(Matrix.nonZeros());
+		Writer.Append('\n');
+		for (int64 Outer = 0; Outer < Matrix.outerSize(); Outer++) {
+			for (typename Derived::InnerIterator It(Matrix, Outer); It; ++It) {
+				Writer.AppendInteger((int64)It.row() + 1);
+				Writer.Append(' ');
+				Writer.AppendInteger((int64)It.col() + 1);
+				Writer.Append(' ');
+				Writer.AppendNumber((double)It.value());
+				Writer.Append('\n');
+			}
+		}
+		Writer.Flush();
+		return !Writer.IsError();
+	}
+	// This function writes a dense matrix in the Matrix Market array format
+	// @param Writer - where the text is written
+	// @param InMatrix - the dense matrix to write
+	// @returns - false if the archive failed
+	template<typename Derived>
+	static bool WriteMatrixMarket(FEiVTextWriter& Writer, const EiVMatrixBase<Derived>& InMatrix)
+	{
+		Writer.Append("%%MatrixMarket matrix array real general\n");
+		Writer.AppendInteger(InMatrix.rows());
+		Writer.Append(' ');
+		Writer.AppendInteger(InMatrix.cols());
+		Writer.Append('\n');
+		for (int64 Col = 0; Col < InMatrix.cols(); Col++) {
+			for (int64 Row = 0; Row < InMatrix.rows(); Row++) {
+				Writer.AppendNumber((double)InMatrix.coeff(Row, Col));
+				Writer.Append('\n');
+			}
+		}
+		Writer.Flush();
+		return !Writer.IsError();
+	}
+	// This function writes a dense or sparse matrix to a Matrix Market file, see WriteMatrixMarket above
+	template<typename MatrixType>
+	static bool WriteMatrixMarket(const FString& Path, const MatrixType& InMatrix)
+	{
+		TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileWriter(*Path));
+		if (!Archive) {
+			return false;
+		}
+		{
+			FEiVTextWriter Writer(*Archive);
+			if (!FEiVMatrixIO::WriteMatrixMarket(Writer, InMatrix)) {
+				return false;
+			}
+		}
+		return Archive->Close();
+	}
+
+private:
+	// skips spaces, tabs and carriage returns unless they are the delimiter
+	static void SkipBlanks(const ANSICHAR*& InOutCursor, const ANSICHAR* End, const ANSICHAR Delimiter)
+	{
+		while (InOutCursor < End && (*InOutCursor == ' ' || *InOutCursor == '\t' || *InOutCursor == '\r') && *InOutCursor != Delimiter) {
+			InOutCursor++;
+		}
+	}
+	// case insensitive comparison of a token with a lower case string
+	static bool TokenEquals(const ANSICHAR* const InToken[2], const ANSICHAR* InLower)
+	{
+		const ANSICHAR* Cursor = InToken[0];
+		for (; Cursor < InToken[1] && *InLower; Cursor++, InLower++) {
+			const ANSICHAR Lower = (*Cursor >= 'A' && *Cursor <= 'Z') ? *Cursor - 'A' + 'a' : *Cursor;
+			if (Lower != *InLower) {
+				return false;
+			}
+		}
+		return Cursor == InToken[1] && !*InLower;
+	}
+	// parses with the C library, for the numbers the fast path can not parse exactly
+	static bool ParseNumberFallback(const ANSICHAR*& InOutCursor, const ANSICHAR* End, double& OutValue)
+	{
+		// strtod needs a null terminated copy of everything that may belong to the number
+		const ANSICHAR* NumberEnd = InOutCursor;
+		while (NumberEnd < End && ((*NumberEnd >= '0' && *NumberEnd <= '9') || (*NumberEnd >= 'a' && *NumberEnd <= 'z') || (*NumberEnd >= 'A' && *NumberEnd <= 'Z') || *NumberEnd == '.' || *NumberEnd == '+' || *NumberEnd == '-')) {
+			NumberEnd++;
+		}
+		const int64 Length = NumberEnd - InOutCursor;
+		ANSICHAR InlineText[128];
+		TArray<ANSICHAR> LongText;
+		ANSICHAR* Text = InlineText;
+		if (Length >= 128) {
+			LongText.SetNumUninitialized(Length + 1);
+			Text = LongText.GetData();
+		}
+		FMemory::Memcpy(Text, InOutCursor, Length);
+		Text[Length] = '\0';
+		ANSICHAR* ParsedEnd = nullptr;
+		OutValue = std::strtod(Text, &ParsedEnd);
+		if (ParsedEnd == Text) {
+			return false;
+		}
+		InOutCursor += ParsedEnd - Text;
+		return true;
+	}
+};
+
+inline void FEiVTextWriter::AppendNumber(double Value)
+{
+	ANSICHAR Text[FEiVMatrixIO::MaxNumberLength];
+	Append(Text, FEiVMatrixIO::FormatNumber(Value, Text));
+}
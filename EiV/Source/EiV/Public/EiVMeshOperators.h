@@ -0,0 +1,320 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+//<><><><><><><><><><><><> EiVLibrary Import Block <><><><><><><><><><><><>
+//imports the specified headers by the macro definitions
+
+#define EIV_INCLUDE_DENSE_MATRIX_ARRAY    //includes most core and basic features
+#define EIV_INCLUDE_SPARSE_LINEAR_ALGEBRA //includes sparse linear algebra utilities
+#define EIV_INCLUDE_GEOMETRY              //includes geometric utilities
+#define EIV_UNDEFINE_INCLUDES             //ensures that these include macros above are local to this file
+
+#include "EiVLibrary.h"   //takes the EIV_INCLUDE macros as settings and retrieves
+                          //the specified Eigen modules, typedefs, and helper functions
+//<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>
+#include "EiVSparseKernels.h"
+#include "EiVSparseDirectSolvers.h"
+#include "Async/ParallelFor.h"
+#include <algorithm>
+
+/*
+* Differential operators of triangle meshes given as a vertex buffer and a triangle index buffer (3 indices per
+* triangle). The Laplacian is assembled straight into the compressed column storage of the sparse matrix: the triangles
+* around every vertex are found with a counting sort, then the columns are built in parallel, each one sorting and
+* summing the contributions of its own triangles, which avoids the triplet list and its global sort.
+* The Laplacian L is symmetric positive semi-definite (L = D - W) with both triangles stored, so it can be multiplied
+* directly and factorized with the symmetric solvers, which read the lower triangle. The cotangent Laplacian is also the
+* system matrix of as-rigid-as-possible deformation.
+* For this whole struct the <NumericType> is the datatype of the numbers stored in the Eigen types.
+*/
+struct EIV_API FEiVMeshOperators
+{
+	// This function assembles the Laplacian of a triangle mesh
+	// @param Vertices - the vertex positions, one per column
+	// @param Indices - 3 vertex indices per triangle
+	// @param NumTriangles - the number of triangles
+	// @param bCotangent - if true the cotangent weights (cot(alpha) + cot(beta)) / 2 of every edge are used, which
+	// approximate the Laplace-Beltrami operator, otherwise every edge has weight 1 (the uniform or graph Laplacian)
+	// @param OutLaplacian - the vertices x vertices Laplacian, compressed
+	// @returns - false if an index is out of range
+	template<typename NumericType = double>
+	static bool Laplacian(const EiVMatrix3X<NumericType>& Vertices, const int32* Indices, int32 NumTriangles, bool bCotangent, EiVSparseMatrix<NumericType>& OutLaplacian)
+	{
+		typedef typename EiVSparseMatrix<NumericType>::StorageIndex StorageIndex;
+		const int32 NumVertices = (int32)Vertices.cols();
+		TArray<int32> VertexStarts, VertexCorners;
+		if (!FEiVMeshOperators::BuildVertexCorners(Indices, NumTriangles, NumVertices, VertexStarts, VertexCorners)) {
+			return false;
+		}
+		// the weight of the edge opposite each corner
+		TArray<NumericType> Weights;
+		Weights.SetNumUninitialized(3 * NumTriangles);
+		FEiVHelper::ForEachRange(NumTriangles, MinItemsPerTask, [&](int32 First, int32 Last)
+		{
+			for (int32 Triangle = First; Triangle < Last; Triangle++) {
+				for (int32 Corner = 0; Corner < 3; Corner++) {
+					Weights[3 * Triangle + Corner] = bCotangent ? (NumericType)0.5 * FEiVMeshOperators::CornerCotangent(Vertices, Indices + 3 * Triangle, Corner) : (NumericType)1;
+				}
+			}
+		});
+
+		// every column has at most two entries per incident triangle and its diagonal, so the columns are merged into
+		// scratch space with room for that, then copied together
+		TArray<StorageIndex> Rows;
+		TArray<NumericType> Values;
+		TArray<StorageIndex> Counts;
+		Rows.SetNumUninitialized(VertexCorners.Num() * 2 + NumVertices);
+		Values.SetNumUninitialized(VertexCorners.Num() * 2 + NumVertices);
+		Counts.SetNumUninitialized(NumVertices + 1);
+		FEiVMeshOperators::ForEachVertexRange(VertexStarts, [&](int32 First, int32 Last)
+		{
+			TArray<TPair<StorageIndex, NumericType>> Entries;
+			for (int32 Vertex = First; Vertex < Last; Vertex++) {
+				Entries.Reset();
+				for (int32 Item = VertexStarts[Vertex]; Item < VertexStarts[Vertex + 1]; Item++) {
+					const int32 Triangle = VertexCorners[Item] / 3;
+					const int32 Corner = VertexCorners[Item] % 3;
+					const int32 Next = (Corner + 1) % 3;
+					const int32 Previous = (Corner + 2) % 3;
+					// the edge to the next corner is opposite the previous corner and the other way around
+					Entries.Add(TPair<StorageIndex, NumericType>((StorageIndex)Indices[3 * Triangle + Next], Weights[3 * Triangle + Previous]));
+					Entries.Add(TPair<StorageIndex, NumericType>((StorageIndex)Indices[3 * Triangle + Previous], Weights[3 * Triangle + Next]));
+				}
+				Entries.Add(TPair<StorageIndex, NumericType>((StorageIndex)Vertex, (NumericType)0));
+				std::sort(Entries.GetData(), Entries.GetData() + Entries.Num(), [](const TPair<StorageIndex, NumericType>& A, const TPair<StorageIndex, NumericType>& B) { return A.Key < B.Key; });
+				StorageIndex* ColumnRows = Rows.GetData() + 2 * VertexStarts[Vertex] + Vertex;
+				NumericType* ColumnValues = Values.GetData() + 2 * VertexStarts[Vertex] + Vertex;
+				int32 Count = 0;
+				int32 DiagonalIndex = 0;
+				NumericType Diagonal = (NumericType)0;
+				for (int32 Entry = 0; Entry < Entries.Num(); Entry++) {
+					const StorageIndex Row = Entries[Entry].Key;
+					if (Count == 0 || ColumnRows[Count - 1] != Row) {
+						ColumnRows[Count] = Row;
+						ColumnValues[Count] = (NumericType)0;
+						Count++;
+					}
+					if (Row == (StorageIndex)Vertex) {
+						DiagonalIndex = Count - 1;
+						continue;
+					}
+					if (bCotangent) {
+						ColumnValues[Count - 1] -= Entries[Entry].Value;
+						Diagonal += Entries[Entry].Value;
+					}
+					else if (ColumnValues[Count - 1] == (NumericType)0) {
+						// an interior edge is shared by two triangles but still only has weight 1
+						ColumnValues[Count - 1] = (NumericType)-1;
+						Diagonal += (NumericType)1;
+					}
+				}
+				ColumnValues[DiagonalIndex] = Diagonal;
+				Counts[Vertex] = (StorageIndex)Count;
+			}
+		});
+
+		OutLaplacian.resize(NumVertices, NumVertices);
+		StorageIndex NonZeros = 0;
+		for (int32 Vertex = 0; Vertex < NumVertices; Vertex++) {
+			const StorageIndex Count = Counts[Vertex];
+			Counts[Vertex] = NonZeros;
+			NonZeros += Count;
+		}
+		Counts[NumVertices] = NonZeros;
+		OutLaplacian.resizeNonZeros(NonZeros);
+		FMemory::Memcpy(OutLaplacian.outerIndexPtr(), Counts.GetData(), (NumVertices + 1) * sizeof(StorageIndex));
+		FEiVMeshOperators::ForEachVertexRange(VertexStarts, [&](int32 First, int32 Last)
+		{
+			for (int32 Vertex = First; Vertex < Last; Vertex++) {
+				const int64 Scratch = 2 * (int64)VertexStarts[Vertex] + Vertex;
+				const int64 Count = Counts[Vertex + 1] - Counts[Vertex];
+				FMemory::Memcpy(OutLaplacian.innerIndexPtr() + Counts[Vertex], Rows.GetData() + Scratch, Count * sizeof(StorageIndex));
+				FMemory::Memcpy(OutLaplacian.valuePtr() + Counts[Vertex], Values.GetData() + Scratch, Count * sizeof(NumericType));
+			}
+		});
+		return true;
+	}
+	// This function computes the lumped (barycentric) mass matrix of a triangle mesh, a third of the area of every
+	// triangle goes to each of its vertices
+	// @param Vertices - the vertex positions, one per column
+	// @param Indices - 3 vertex indices per triangle
+	// @param NumTriangles - the number of triangles
+	// @param OutMass - the diagonal of the mass matrix, one area per vertex
+	// @returns - false if an index is out of range
+	template<typename NumericType = double>
+	static bool MassMatrix(const EiVMatrix3X<NumericType>& Vertices, const int32* Indices, int32 NumTriangles, EiVVectorX<NumericType>& OutMass)
+	{
+		const int32 NumVertices = (int32)Vertices.cols();
+		TArray<int32> VertexStarts, VertexCorners;
+		if (!FEiVMeshOperators::BuildVertexCorners(Indices, NumTriangles, NumVertices, VertexStarts, VertexCorners)) {
+			return false;
+		}
+		OutMass.resize(NumVertices);
+		FEiVMeshOperators::ForEachVertexRange(VertexStarts, [&](int32 First, int32 Last)
+		{
+			for (int32 Vertex = First; Vertex < Last; Vertex++) {
+				NumericType Area = (NumericType)0;
+				for (int32 Item = VertexStarts[Vertex]; Item < VertexStarts[Vertex + 1]; Item++) {
+					const int32* Triangle = Indices + 3 * (VertexCorners[Item] / 3);
+					Area += (Vertices.col(Triangle[1]) - Vertices.col(Triangle[0])).cross(Vertices.col(Triangle[2]) - Vertices.col(Triangle[0])).norm();
+				}
+				// each triangle's area is half its cross product, a third of that goes to this vertex
+				OutMass[Vertex] = Area / (NumericType)6;
+			}
+		});
+		return true;
+	}
+	// This function builds the implicit smoothing (backward Euler diffusion) system M + t L
+	// @param InLaplacian - the Laplacian L
+	// @param InMass - the diagonal of the mass matrix M, vertices without area should be given a positive mass
+	// @param TimeStep - the diffusion time t, larger values smooth more
+	// @returns - the system matrix, with the same sparsity pattern as the Laplacian
+	template<typename NumericType = double>
+	static EiVSparseMatrix<NumericType> SmoothingSystem(const EiVSparseMatrix<NumericType>& InLaplacian, const EiVVectorX<NumericType>& InMass, NumericType TimeStep)
+	{
+		EiVSparseMatrix<NumericType> System = InLaplacian * TimeStep;
+		for (int64 Col = 0; Col < System.outerSize(); Col++) {
+			for (typename EiVSparseMatrix<NumericType>::InnerIterator It(System, Col); It; ++It) {
+				if (It.row() == It.col()) {
+					It.valueRef() += InMass[Col];
+				}
+			}
+		}
+		return System;
+	}
+
+private:
+	// The smallest number of triangles or triangle corners worth a worker thread
+	static constexpr int32 MinItemsPerTask = 4096;
+
+	// groups the triangle corners (3 * triangle + corner) by vertex with a counting sort, the corners of vertex v are
+	// OutCorners[OutStarts[v] .. OutStarts[v + 1])
+	static bool BuildVertexCorners(const int32* Indices, int32 NumTriangles, int32 NumVertices, TArray<int32>& OutStarts, TArray<int32>& OutCorners)
+	{
+		OutStarts.SetNumZeroed(NumVertices + 1);
+		for (int32 Item = 0; Item < 3 * NumTriangles; Item++) {
+			if (Indices[Item] < 0 || Indices[Item] >= NumVertices) {
+				return false;
+			}
+			OutStarts[Indices[Item] + 1]++;
+		}
+		for (int32 Vertex = 0; Vertex < NumVertices; Vertex++) {
+			OutStarts[Vertex + 1] += OutStarts[Vertex];
+		}
+		TArray<int32> Cursors = OutStarts;
+		OutCorners.SetNumUninitialized(3 * NumTriangles);
+		for (int32 Item = 0; Item < 3 * NumTriangles; Item++) {
+			OutCorners[Cursors[Indices[Item]]++] = Item;
+		}
+		return true;
+	}
+	// cot of the angle at a corner of a triangle, 0 for degenerate triangles
+	template<typename NumericType>
+	static NumericType CornerCotangent(const EiVMatrix3X<NumericType>& Vertices, const int32* Triangle, int32 Corner)
+	{
+		const EiVVector3<NumericType> EdgeA = Vertices.col(Triangle[(Corner + 1) % 3]) - Vertices.col(Triangle[Corner]);
+		const EiVVector3<NumericType> EdgeB = Vertices.col(Triangle[(Corner + 2) % 3]) - Vertices.col(Triangle[Corner]);
+		const NumericType DoubleArea = EdgeA.cross(EdgeB).norm();
+		return DoubleArea > std::numeric_limits<NumericType>::min() ? EdgeA.dot(EdgeB) / DoubleArea : (NumericType)0;
+	}
+	// splits the vertices over the worker threads so that every task gets about the same number of triangle corners
+	template<typename KernelType>
+	static void ForEachVertexRange(const TArray<int32>& VertexStarts, const KernelType& Kernel)
+	{
+		const int32 NumVertices = VertexStarts.Num() - 1;
+		const int32 NumTasks = FMath::Max(FEiVHelper::GetParallelChunkCount(VertexStarts[NumVertices] + NumVertices, MinItemsPerTask), 1);
+		TArray<int32> Bounds;
+		FEiVSparseKernels::PartitionRows(VertexStarts.GetData(), NumVertices, NumTasks, Bounds);
+		ParallelFor(NumTasks, [&](int32 Task)
+		{
+			Kernel(Bounds[Task], Bounds[Task + 1]);
+		}, NumTasks == 1);
+	}
+};
+
+/*
+* Implicit Laplacian smoothing of a mesh with a fixed topology. Init assembles the Laplacian and mass matrix and
+* factorizes M + t L once with a sparse LDLT, every Smooth after that is only a back-substitution per iteration.
+* Changing the time step refactorizes numerically but keeps the cached ordering and symbolic analysis.
+* This object is not thread safe, use one smoother per thread.
+* For this whole class the <NumericType> is the datatype of the numbers stored in the Eigen types.
+*/
+template<typename NumericType = double>
+class TEiVMeshSmoother
+{
+public:
+	// This function builds the operators of a mesh and factorizes its smoothing system
+	// @param Vertices - the vertex positions the operators are built from, one per column
+	// @param Indices - 3 vertex indices per triangle
+	// @param NumTriangles - the number of triangles
+	// @param bCotangent - if true the cotangent Laplacian is used, which keeps the shape of irregular meshes better,
+	// otherwise the uniform Laplacian, which also evens out the triangle sizes
+	// @param TimeStep - the diffusion time t of one iteration
+	// @returns - false if an index is out of range or the factorization failed
+	bool Init(const EiVMatrix3X<NumericType>& Vertices, const int32* Indices, int32 NumTriangles, bool bCotangent, NumericType TimeStep)
+	{
+		if (!FEiVMeshOperators::Laplacian(Vertices, Indices, NumTriangles, bCotangent, Laplacian) || !FEiVMeshOperators::MassMatrix(Vertices, Indices, NumTriangles, Mass)) {
+			return false;
+		}
+		if (!bCotangent) {
+			// the uniform Laplacian is not scaled by area, so the mass is the identity to match it
+			Mass.setOnes();
+		}
+		else {
+			// vertices which belong to no (or only degenerate) triangles keep their position
+			for (int64 Vertex = 0; Vertex < Mass.size(); Vertex++) {
+				Mass[Vertex] = Mass[Vertex] > (NumericType)0 ? Mass[Vertex] : (NumericType)1;
+			}
+		}
+		return SetTimeStep(TimeStep);
+	}
+	// This function changes the time step, which refactorizes the system but reuses its symbolic analysis
+	// @param TimeStep - the diffusion time t of one iteration
+	// @returns - false if the factorization failed
+	bool SetTimeStep(NumericType TimeStep)
+	{
+		return Solver.SetMatrix(FEiVMeshOperators::SmoothingSystem(Laplacian, Mass, TimeStep));
+	}
+	// This function smooths per vertex values, usually positions, by solving (M + t L) X' = M X
+	// @param InValues - the values to smooth, one column per vertex
+	// @param OutValues - the smoothed values
+	// @param Iterations - the number of smoothing steps
+	// @returns - false if there is no factorization or the number of vertices does not match
+	bool Smooth(const EiVMatrix3X<NumericType>& InValues, EiVMatrix3X<NumericType>& OutValues, int32 Iterations = 1)
+	{
+		if (!Solver.IsFactorized() || InValues.cols() != Mass.size()) {
+			return false;
+		}
+		Solution = InValues.transpose();
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++) {
+			RightHandSide = Mass.asDiagonal() * Solution;
+			if (!Solver.Solve(RightHandSide, Solution)) {
+				return false;
+			}
+		}
+		OutValues = Solution.transpose();
+		return true;
+	}
+
+	// @returns - the Laplacian of the mesh
+	const EiVSparseMatrix<NumericType>& GetLaplacian() const { return Laplacian; }
+	// @returns - the diagonal of the mass matrix used by the smoothing system
+	const EiVVectorX<NumericType>& GetMass() const { return Mass; }
+	// @returns - the solver, with the fill-in statistics of the factorization
+	const TEiVCachedSimplicialLDLT<NumericType>& GetSolver() const { return Solver; }
+
+private:
+	EiVSparseMatrix<NumericType> Laplacian;
+	EiVVectorX<NumericType> Mass;
+	TEiVCachedSimplicialLDLT<NumericType> Solver;
+	// the per vertex values of the solve, one row per vertex, kept between calls so Smooth reuses their memory
+	EiVMatrixX<NumericType> RightHandSide;
+	EiVMatrixX<NumericType> Solution;
+};
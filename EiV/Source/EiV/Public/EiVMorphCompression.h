@@ -0,0 +1,205 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+//<><><><><><><><><><><><> EiVLibrary Import Block <><><><><><><><><><><><>
+//imports the specified headers by the macro definitions
+
+#define EIV_INCLUDE_DENSE_MATRIX_ARRAY    //includes most core and basic features
+#define EIV_INCLUDE_DENSE_LINEAR_PROBLEMS //includes solvers
+#define EIV_UNDEFINE_INCLUDES             //ensures that these include macros above are local to this file
+
+#include "EiVLibrary.h"   //takes the EIV_INCLUDE macros as settings and retrieves
+                          //the specified Eigen modules, typedefs, and helper functions
+//<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>
+#include "EiVSVD.h"
+
+/*
+* Compression of a morph target (blend shape) set into a PCA basis.
+* The deltas of the targets form a 3V x T matrix D, one column per target with the x, y and z delta of every vertex,
+* and the morphed deltas for the weights w are D * w. Build finds the truncated SVD D ~ U_k * S_k * V_k^T (in double,
+* with the randomized SVD of FEiVSVD) and stores the basis B = U_k and the projection P = S_k * V_k^T, so the
+* reconstruction is two dense products, the coefficients c = P * w (k x T, tiny) and the deltas B * c, a single GEMV
+* over the 3V x k basis which is split over the worker threads by vertex ranges. Its cost no longer depends on how many
+* targets are active or how many vertices each of them moves.
+* Build also measures the residual R = D - B * P of the stored (rounded) basis, so the error of every reconstruction is
+* bounded: the delta of every vertex is off by at most MaxVertexError * |w|, |w| being the Euclidean norm of the weights
+* (plus the rounding of the runtime products, which is far smaller for float buffers).
+* Build is meant for editor or cook time, Reconstruct for runtime. Reconstruct can be called from several threads at once.
+* For this whole class the <NumericType> is the datatype of the stored basis and of the runtime buffers.
+*/
+
+// The settings of building a morph basis
+struct FEiVMorphBasisSettings
+{
+	// The largest number of basis vectors kept
+	int32 MaxComponents = 64;
+	// The largest accepted relative error |D - B * P| / |D| (Frobenius norms), the basis keeps the fewest components
+	// reaching it, up to MaxComponents
+	double Tolerance = 1e-3;
+	// Extra random directions and power iterations of the randomized SVD, see FEiVSVD::ComputeRandomized
+	int32 Oversampling = 10;
+	int32 PowerIterations = 2;
+	// The seed of the randomized SVD, the same seed gives the same basis
+	int32 Seed = 0;
+};
+
+template<typename NumericType = float>
+class TEiVMorphBasis
+{
+public:
+	// The smallest number of multiply-adds of the reconstruction worth a worker thread
+	static constexpr int64 MinWorkPerTask = 1 << 16;
+
+	// This function gathers sparse per target deltas, such as the FMorphTargetDelta arrays of the LODs of UMorphTargets,
+	// into the dense delta matrix Build takes. The delta type needs a SourceIdx vertex index and a PositionDelta vector.
+	// @param Targets - the deltas of every target
+	// @param NumVertices - the number of vertices of the mesh
+	// @param OutDeltas - the 3V x T deltas
+	// @returns - false if a vertex index is out of range
+	template<typename DeltaType>
+	static bool GatherDeltas(const TArray<TConstArrayView<DeltaType>>& Targets, int32 NumVertices, EiVMatrixX<NumericType>& OutDeltas)
+	{
+		OutDeltas.setZero(3 * (int64)NumVertices, Targets.Num());
+		for (int32 Target = 0; Target < Targets.Num(); Target++) {
+			for (const DeltaType& Delta : Targets[Target]) {
+				if ((int64)Delta.SourceIdx >= (int64)NumVertices) {
+					OutDeltas.resize(0, 0);
+					return false;
+				}
+				OutDeltas(3 * (int64)Delta.SourceIdx, Target) += (NumericType)Delta.PositionDelta.X;
+				OutDeltas(3 * (int64)Delta.SourceIdx + 1, Target) += (NumericType)Delta.PositionDelta.Y;
+				OutDeltas(3 * (int64)Delta.SourceIdx + 2, Target) += (NumericType)Delta.PositionDelta.Z;
+			}
+		}
+		return true;
+	}
+	// This function compresses a morph target set
+	// @param Deltas - the 3V x T deltas, one column per target, rows 3v, 3v + 1 and 3v + 2 are the x, y and z delta of vertex v
+	// @param Settings - the size and accuracy of the basis
+	// @returns - false if Deltas is empty, its rows are not a multiple of 3, MaxComponents is not positive or the SVD failed
+	bool Build(const EiVMatrixX<NumericType>& Deltas, const FEiVMorphBasisSettings& Settings = FEiVMorphBasisSettings())
+	{
+		Reset();
+		if (Deltas.size() == 0 || Deltas.rows() % 3 != 0 || Settings.MaxComponents <= 0) {
+			return false;
+		}
+		const EiVMatrixXd DoubleDeltas = Deltas.template cast<double>();
+		EiVMatrixXd U, V;
+		EiVVectorXd S;
+		if (!FEiVSVD::ComputeRandomized<double>(DoubleDeltas, Settings.MaxComponents, Settings.Oversampling, Settings.PowerIterations, Settings.Seed, U, S, V)) {
+			return false;
+		}
+		// the energy the first k components leave out is |D|^2 minus the sum of their squared singular values
+		const double TotalEnergy = DoubleDeltas.squaredNorm();
+		const double AcceptedEnergy = Settings.Tolerance * Settings.Tolerance * TotalEnergy;
+		double CapturedEnergy = 0.0;
+		int32 NumComponents = 0;
+		while (NumComponents < S.size() && TotalEnergy - CapturedEnergy > AcceptedEnergy) {
+			CapturedEnergy += S[NumComponents] * S[NumComponents];
+			NumComponents++;
+		}
+		NumComponents = FMath::Max(NumComponents, 1);
+		Basis = U.leftCols(NumComponents).template cast<NumericType>();
+		Projection = (S.head(NumComponents).asDiagonal() * V.leftCols(NumComponents).transpose()).template cast<NumericType>();
+		SingularValues = S;
+		MeasureError(DoubleDeltas, TotalEnergy);
+		return true;
+	}
+	// This function reconstructs the morphed deltas, or positions, of a set of weights
+	// @param Weights - NumTargets weights, one per morph target
+	// @param BaseValues - 3 * NumVertices values added to the deltas (for example the reference positions), or null
+	// @param OutValues - 3 * NumVertices outputs, x, y and z per vertex like an FVector3f array, may be BaseValues
+	// @param bParallel - if true large meshes are split over the worker threads
+	// @returns - false if there is no basis
+	bool Reconstruct(const NumericType* Weights, const NumericType* BaseValues, NumericType* OutValues, bool bParallel = true) const
+	{
+		if (Basis.size() == 0) {
+			return false;
+		}
+		const EiVVectorX<NumericType> Coefficients = Projection * EiVMap<const EiVVectorX<NumericType>>(Weights, Projection.cols());
+		// split by vertex so the range count stays an int32, every vertex is 3 rows of Basis
+		FEiVHelper::ForEachRange(GetNumVertices(), MinWorkPerTask / FMath::Max<int64>(3 * Basis.cols(), 1), [&](int32 FirstVertex, int32 LastVertex)
+		{
+			const int64 First = 3 * (int64)FirstVertex;
+			const int64 Num = 3 * (int64)(LastVertex - FirstVertex);
+			EiVMap<EiVVectorX<NumericType>> Out(OutValues + First, Num);
+			if (BaseValues != nullptr) {
+				Out = EiVMap<const EiVVectorX<NumericType>>(BaseValues + First, Num) + Basis.middleRows(First, Num) * Coefficients;
+			}
+			else {
+				Out.noalias() = Basis.middleRows(First, Num) * Coefficients;
+			}
+		}, bParallel);
+		return true;
+	}
+	// This function bounds the error of a reconstruction
+	// @param Weights - NumTargets weights, one per morph target
+	// @returns - the largest possible distance between a reconstructed vertex delta and the uncompressed one
+	NumericType GetErrorBound(const NumericType* Weights) const
+	{
+		return MaxVertexError * EiVMap<const EiVVectorX<NumericType>>(Weights, Projection.cols()).norm();
+	}
+	// This function clears the basis
+	void Reset()
+	{
+		Basis.resize(0, 0);
+		Projection.resize(0, 0);
+		SingularValues.resize(0);
+		VertexErrors.resize(0);
+		RelativeError = (NumericType)0;
+		MaxVertexError = (NumericType)0;
+	}
+
+	// @returns - the number of basis vectors
+	int32 GetNumComponents() const { return (int32)Basis.cols(); }
+	// @returns - the number of morph targets
+	int32 GetNumTargets() const { return (int32)Projection.cols(); }
+	// @returns - the number of vertices
+	int32 GetNumVertices() const { return (int32)(Basis.rows() / 3); }
+	// @returns - the 3V x k orthonormal basis
+	const EiVMatrixX<NumericType>& GetBasis() const { return Basis; }
+	// @returns - the k x T projection from weights to basis coefficients
+	const EiVMatrixX<NumericType>& GetProjection() const { return Projection; }
+	// @returns - the singular values found while building, including the ones past the kept components
+	const EiVVectorXd& GetSingularValues() const { return SingularValues; }
+	// @returns - |D - B * P| / |D| of the stored basis
+	NumericType GetRelativeError() const { return RelativeError; }
+	// @returns - the largest error of a vertex delta per unit norm of the weights
+	NumericType GetMaxVertexError() const { return MaxVertexError; }
+	// @returns - per vertex, the Frobenius norm of its 3 rows of the residual, which bounds its error per unit norm of the weights
+	const EiVVectorX<NumericType>& GetVertexErrors() const { return VertexErrors; }
+
+private:
+	// computes the residual of the rounded basis by vertex ranges, in parallel and without storing all of it at once
+	void MeasureError(const EiVMatrixXd& Deltas, double TotalEnergy)
+	{
+		const EiVMatrixXd DoubleBasis = Basis.template cast<double>();
+		const EiVMatrixXd DoubleProjection = Projection.template cast<double>();
+		const int32 NumVertices = (int32)(Deltas.rows() / 3);
+		EiVVectorXd Errors(NumVertices);
+		FEiVHelper::ForEachRange(NumVertices, MinWorkPerTask / FMath::Max<int64>(3 * Deltas.cols() * Basis.cols(), 1), [&](int32 First, int32 Last)
+		{
+			const EiVMatrixXd Residual = Deltas.middleRows(3 * (int64)First, 3 * (int64)(Last - First)) - DoubleBasis.middleRows(3 * (int64)First, 3 * (int64)(Last - First)) * DoubleProjection;
+			for (int32 Vertex = First; Vertex < Last; Vertex++) {
+				Errors[Vertex] = Residual.middleRows(3 * (int64)(Vertex - First), 3).squaredNorm();
+			}
+		});
+		RelativeError = TotalEnergy > 0.0 ? (NumericType)FMath::Sqrt(Errors.sum() / TotalEnergy) : (NumericType)0;
+		VertexErrors = Errors.cwiseSqrt().template cast<NumericType>();
+		MaxVertexError = VertexErrors.maxCoeff();
+	}
+
+	EiVMatrixX<NumericType> Basis;
+	EiVMatrixX<NumericType> Projection;
+	EiVVectorXd SingularValues;
+	EiVVectorX<NumericType> VertexErrors;
+	NumericType RelativeError = (NumericType)0;
+	NumericType MaxVertexError = (NumericType)0;
+};
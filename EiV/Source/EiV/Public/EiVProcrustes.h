@@ -0,0 +1,398 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+//<><><><><><><><><><><><> EiVLibrary Import Block <><><><><><><><><><><><>
+//imports the specified headers by the macro definitions
+
+#define EIV_INCLUDE_DENSE_MATRIX_ARRAY    //includes most core and basic features
+#define EIV_INCLUDE_GEOMETRY              //includes geometric utilities
+#define EIV_INCLUDE_EIGENVALUES           //includes the eigenvalue solvers
+#define EIV_UNDEFINE_INCLUDES             //ensures that these include macros above are local to this file
+
+#include "EiVLibrary.h"   //takes the EIV_INCLUDE macros as settings and retrieves
+                          //the specified Eigen modules, typedefs, and helper functions
+//<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>
+
+/*
+* Optimal rotations between point sets (Kabsch, weighted Procrustes with optional scale) and the polar decomposition of
+* 3x3 matrices, for shape matching and motion capture alignment.
+* All of them reduce to the rotation R maximizing trace(R^T A) for a 3x3 matrix A, which is found with Horn's quaternion
+* method: the largest eigenvector of a symmetric 4x4 matrix built from A, computed with cyclic Jacobi sweeps. The result is
+* always a proper rotation, also when A is singular or a reflection. The batch functions run the sweeps in structure of
+* arrays form over chunks of ChunkSize problems, so they vectorize across the batch, and split the chunks over worker
+* threads. Matrices are passed as 9 numbers each in column-major order, quaternions as 4 numbers (x y z w).
+* For this whole struct the <NumericType> is the datatype of the numbers stored in the Eigen types.
+*/
+struct EIV_API FEiVProcrustes
+{
+	// The number of problems solved together in structure of arrays form
+	static constexpr int32 ChunkSize = 256;
+	// The smallest number of problems worth a worker thread
+	static constexpr int32 MinItemsPerTask = 1024;
+
+	// This function computes the rotation closest to a matrix, the R maximizing trace(R^T A)
+	// @param InMatrix - the matrix A
+	// @returns - the rotation as a unit quaternion
+	template<typename NumericType = double>
+	static EiVQuaternion<NumericType> ClosestRotation(const EiVMatrix3<NumericType>& InMatrix)
+	{
+		EiVQuaternion<NumericType> Rotation;
+		FEiVProcrustes::ClosestRotationBatch(InMatrix.data(), Rotation.coeffs().data(), 1);
+		return Rotation;
+	}
+	// This function computes the polar decomposition A = R S of a matrix into a rotation and a symmetric stretch.
+	// If det(A) < 0 the stretch has one negative eigenvalue instead of R being a reflection.
+	// @param InMatrix - the matrix A
+	// @param OutRotation - the rotation R
+	// @param OutStretch - the symmetric matrix S
+	template<typename NumericType = double>
+	static void PolarDecomposition(const EiVMatrix3<NumericType>& InMatrix, EiVMatrix3<NumericType>& OutRotation, EiVMatrix3<NumericType>& OutStretch)
+	{
+		FEiVProcrustes::PolarDecompositionBatch(InMatrix.data(), OutRotation.data(), OutStretch.data(), 1);
+	}
+	// This function computes the singular value decomposition A = U * diag(S) * V^T of a 3x3 matrix in closed form,
+	// from the polar decomposition and the direct eigen decomposition of the symmetric stretch
+	// @param InMatrix - the matrix A
+	// @param bSigned - if true U and V are both rotations and the smallest singular value is negative when det(A) < 0,
+	// which is what shape matching and deformation codes want; if false the singular values are all non-negative
+	// @param OutU - the left singular vectors, one per column
+	// @param OutSingularValues - the singular values in decreasing order
+	// @param OutV - the right singular vectors, one per column
+	template<typename NumericType = double>
+	static void SVD3(const EiVMatrix3<NumericType>& InMatrix, bool bSigned, EiVMatrix3<NumericType>& OutU, EiVVector3<NumericType>& OutSingularValues, EiVMatrix3<NumericType>& OutV)
+	{
+		EiVMatrix3<NumericType> Rotation, Stretch;
+		FEiVProcrustes::PolarDecomposition(InMatrix, Rotation, Stretch);
+		EiVSelfAdjointEigenSolver<EiVMatrix3<NumericType>> Eigen;
+		Eigen.computeDirect(Stretch);
+		// the eigenvalues are increasing, the singular values decreasing
+		OutSingularValues = Eigen.eigenvalues().reverse();
+		OutV = Eigen.eigenvectors().rowwise().reverse();
+		if (OutV.determinant() < (NumericType)0) {
+			OutV.col(2) = -OutV.col(2);
+		}
+		OutU.noalias() = Rotation * OutV;
+		if (!bSigned && OutSingularValues.z() < (NumericType)0) {
+			OutSingularValues.z() = -OutSingularValues.z();
+			OutU.col(2) = -OutU.col(2);
+		}
+	}
+	// This function computes the (weighted) similarity or rigid transform which best maps one point set onto another,
+	// minimizing the sum of w_i * |Scale * R * Source_i + T - Target_i|^2
+	// @param Source - the points to move, one per column
+	// @param Target - the points to move them onto, one per column
+	// @param Weights - one weight per point, or empty for equal weights
+	// @param bScale - if true a uniform scale is fitted as well (Umeyama), otherwise the scale is 1
+	// @param OutRotation - the rotation R
+	// @param OutTranslation - the translation T
+	// @param OutScale - the scale
+	// @returns - false if the point sets or the weights have different sizes
+	template<typename NumericType = double>
+	static bool Kabsch(const EiVMatrix3X<NumericType>& Source, const EiVMatrix3X<NumericType>& Target, const EiVVectorX<NumericType>& Weights, bool bScale, EiVQuaternion<NumericType>& OutRotation, EiVVector3<NumericType>& OutTranslation, NumericType& OutScale)
+	{
+		if (Weights.size() != 0 && Weights.size() != Source.cols()) {
+			return false;
+		}
+		const int32 Offsets[2] = { 0, (int32)Source.cols() };
+		return FEiVProcrustes::KabschBatch(Source, Target, Offsets, 1, Weights.size() != 0 ? Weights.data() : nullptr, bScale, OutRotation.coeffs().data(), OutTranslation.data(), &OutScale);
+	}
+
+	// This function computes ClosestRotation for a batch of matrices
+	// @param Matrices - Count matrices, 9 numbers each (column-major)
+	// @param OutRotations - Count unit quaternions, 4 numbers each (x y z w)
+	// @param Count - the number of matrices
+	template<typename NumericType = double>
+	static void ClosestRotationBatch(const NumericType* Matrices, NumericType* OutRotations, int32 Count)
+	{
+		FEiVHelper::ForEachChunk(Count, ChunkSize, MinItemsPerTask, [&](int32 Start, int32 Num)
+		{
+			TRows9<NumericType> Matrix = TConstMap9<NumericType>(Matrices + 9 * (int64)Start, 9, Num);
+			TRows4<NumericType> Rotation(4, Num);
+			FEiVProcrustes::ClosestRotationSoA(Matrix, Rotation);
+			TMap4<NumericType>(OutRotations + 4 * (int64)Start, 4, Num) = Rotation;
+		});
+	}
+	// This function computes PolarDecomposition for a batch of matrices
+	// @param Matrices - Count matrices, 9 numbers each (column-major)
+	// @param OutRotations - Count rotation matrices, 9 numbers each
+	// @param OutStretches - Count symmetric stretch matrices, 9 numbers each, or nullptr if they are not needed
+	// @param Count - the number of matrices
+	template<typename NumericType = double>
+	static void PolarDecompositionBatch(const NumericType* Matrices, NumericType* OutRotations, NumericType* OutStretches, int32 Count)
+	{
+		FEiVHelper::ForEachChunk(Count, ChunkSize, MinItemsPerTask, [&](int32 Start, int32 Num)
+		{
+			const TRows9<NumericType> Matrix = TConstMap9<NumericType>(Matrices + 9 * (int64)Start, 9, Num);
+			TRows4<NumericType> Quaternion(4, Num);
+			FEiVProcrustes::ClosestRotationSoA(Matrix, Quaternion);
+			TRows9<NumericType> Rotation(9, Num);
+			FEiVProcrustes::QuaternionToMatrixSoA(Quaternion, Rotation);
+			TMap9<NumericType>(OutRotations + 9 * (int64)Start, 9, Num) = Rotation;
+			if (OutStretches != nullptr) {
+				// S = R^T A
+				TRows9<NumericType> Stretch(9, Num);
+				for (int32 Row = 0; Row < 3; Row++) {
+					for (int32 Col = 0; Col < 3; Col++) {
+						Stretch.row(Row + 3 * Col) = Rotation.row(3 * Row) * Matrix.row(3 * Col) + Rotation.row(3 * Row + 1) * Matrix.row(3 * Col + 1) + Rotation.row(3 * Row + 2) * Matrix.row(3 * Col + 2);
+					}
+				}
+				TMap9<NumericType>(OutStretches + 9 * (int64)Start, 9, Num) = Stretch;
+			}
+		});
+	}
+	// This function computes Kabsch for a batch of point set pairs stored one after another
+	// @param Sources - the points of all problems, one per column
+	// @param Targets - the target points of all problems, one per column
+	// @param Offsets - Count + 1 increasing column indices, problem i owns the columns Offsets[i] to Offsets[i + 1] - 1
+	// @param Count - the number of problems
+	// @param Weights - one weight per column, or nullptr for equal weights
+	// @param bScale - if true a uniform scale is fitted as well
+	// @param OutRotations - Count unit quaternions, 4 numbers each (x y z w)
+	// @param OutTranslations - Count translations, 3 numbers each
+	// @param OutScales - Count scales, or nullptr if they are not needed
+	// @returns - false if the point sets have different sizes or the offsets are not increasing and within them
+	template<typename NumericType = double>
+	static bool KabschBatch(const EiVMatrix3X<NumericType>& Sources, const EiVMatrix3X<NumericType>& Targets, const int32* Offsets, int32 Count, const NumericType* Weights, bool bScale, NumericType* OutRotations, NumericType* OutTranslations, NumericType* OutScales)
+	{
+		if (Sources.cols() != Targets.cols() || Count < 0 || (Count > 0 && (Offsets[0] < 0 || Offsets[Count] > Sources.cols()))) {
+			return false;
+		}
+		for (int32 Index = 0; Index < Count; Index++) {
+			if (Offsets[Index + 1] < Offsets[Index]) {
+				return false;
+			}
+		}
+		FEiVHelper::ForEachChunk(Count, ChunkSize, MinItemsPerTask, [&](int32 Start, int32 Num)
+		{
+			TRows9<NumericType> Covariance(9, Num);
+			TRows3<NumericType> SourceCentroid(3, Num);
+			TRows3<NumericType> TargetCentroid(3, Num);
+			TRow<NumericType> SourceVariance(1, Num);
+			for (int32 Item = 0; Item < Num; Item++) {
+				EiVMatrix3<NumericType> Moments;
+				EiVVector3<NumericType> SourceMean, TargetMean;
+				NumericType Variance;
+				FEiVProcrustes::CentralMoments(Sources, Targets, Weights, Offsets[Start + Item], Offsets[Start + Item + 1], Moments, SourceMean, TargetMean, Variance);
+				for (int32 Entry = 0; Entry < 9; Entry++) {
+					Covariance(Entry, Item) = Moments.data()[Entry];
+				}
+				SourceCentroid.col(Item) = SourceMean;
+				TargetCentroid.col(Item) = TargetMean;
+				SourceVariance(Item) = Variance;
+			}
+			// Kabsch maximizes sum(q_i . R p_i) = trace(R H) with H = sum(p_i q_i^T), the closest rotation to H^T
+			TRows9<NumericType> Transposed(9, Num);
+			for (int32 Row = 0; Row < 3; Row++) {
+				for (int32 Col = 0; Col < 3; Col++) {
+					Transposed.row(Row + 3 * Col) = Covariance.row(Col + 3 * Row);
+				}
+			}
+			TRows4<NumericType> Quaternion(4, Num);
+			FEiVProcrustes::ClosestRotationSoA(Transposed, Quaternion);
+			for (int32 Item = 0; Item < Num; Item++) {
+				const EiVQuaternion<NumericType> Rotation(Quaternion(3, Item), Quaternion(0, Item), Quaternion(1, Item), Quaternion(2, Item));
+				NumericType Scale = (NumericType)1;
+				if (bScale && SourceVariance(Item) > (NumericType)0) {
+					// s = trace(R H) / sum(w |p - cp|^2)
+					EiVMatrix3<NumericType> Moments;
+					for (int32 Entry = 0; Entry < 9; Entry++) {
+						Moments.data()[Entry] = Covariance(Entry, Item);
+					}
+					Scale = Rotation.toRotationMatrix().transpose().cwiseProduct(Moments).sum() / SourceVariance(Item);
+				}
+				EiVMap<EiVVector4<NumericType>> OutRotation(OutRotations + 4 * (int64)(Start + Item));
+				EiVMap<EiVVector3<NumericType>> OutTranslation(OutTranslations + 3 * (int64)(Start + Item));
+				OutRotation = Rotation.coeffs();
+				OutTranslation = TargetCentroid.col(Item).matrix() - Scale * (Rotation * EiVVector3<NumericType>(SourceCentroid.col(Item).matrix()));
+				if (OutScales != nullptr) {
+					OutScales[Start + Item] = Scale;
+				}
+			}
+		});
+		return true;
+	}
+
+private:
+	// chunks are gathered into structure of arrays form (one row per component), so every operation runs over
+	// contiguous rows and vectorizes
+	template<typename NumericType> using TRow = EiVArray<NumericType, 1, EiVDynamic, Eigen::RowMajor, 1, ChunkSize>;
+	template<typename NumericType> using TRows3 = EiVArray<NumericType, 3, EiVDynamic, Eigen::RowMajor, 3, ChunkSize>;
+	template<typename NumericType> using TRows4 = EiVArray<NumericType, 4, EiVDynamic, Eigen::RowMajor, 4, ChunkSize>;
+	template<typename NumericType> using TRows9 = EiVArray<NumericType, 9, EiVDynamic, Eigen::RowMajor, 9, ChunkSize>;
+	template<typename NumericType> using TConstMap9 = EiVMap<const EiVArray<NumericType, 9, EiVDynamic>>;
+	template<typename NumericType> using TMap4 = EiVMap<EiVArray4X<NumericType>>;
+	template<typename NumericType> using TMap9 = EiVMap<EiVArray<NumericType, 9, EiVDynamic>>;
+
+	// Jacobi sweeps stop early once every off-diagonal entry of the chunk is this small relative to the diagonal
+	template<typename NumericType>
+	static constexpr NumericType SweepTolerance()
+	{
+		return sizeof(NumericType) <= 4 ? (NumericType)1e-6 : (NumericType)1e-15;
+	}
+	// The square root of the smallest normal number, off-diagonal entries below it are flushed to zero
+	template<typename NumericType>
+	static NumericType FlushThreshold()
+	{
+		return std::sqrt(std::numeric_limits<NumericType>::min());
+	}
+	// The most sweeps, cyclic Jacobi converges quadratically so a 4x4 matrix rarely needs more than four
+	static constexpr int32 MaxSweeps = 8;
+
+
+	// the weighted centroids, the central cross moments sum(w (p - cp)(q - cq)^T) and sum(w |p - cp|^2) of one problem
+	template<typename NumericType>
+	static void CentralMoments(const EiVMatrix3X<NumericType>& Sources, const EiVMatrix3X<NumericType>& Targets, const NumericType* Weights, int32 First, int32 Last,
+		EiVMatrix3<NumericType>& OutMoments, EiVVector3<NumericType>& OutSourceMean, EiVVector3<NumericType>& OutTargetMean, NumericType& OutVariance)
+	{
+		OutMoments.setZero();
+		OutSourceMean.setZero();
+		OutTargetMean.setZero();
+		OutVariance = (NumericType)0;
+		NumericType TotalWeight = (NumericType)0;
+		for (int32 Col = First; Col < Last; Col++) {
+			const NumericType Weight = Weights != nullptr ? Weights[Col] : (NumericType)1;
+			OutSourceMean += Weight * Sources.col(Col);
+			OutTargetMean += Weight * Targets.col(Col);
+			TotalWeight += Weight;
+		}
+		if (TotalWeight <= (NumericType)0) {
+			return;
+		}
+		OutSourceMean /= TotalWeight;
+		OutTargetMean /= TotalWeight;
+		// a second pass over the centered points, which does not lose precision to cancellation far from the origin
+		for (int32 Col = First; Col < Last; Col++) {
+			const NumericType Weight = Weights != nullptr ? Weights[Col] : (NumericType)1;
+			const EiVVector3<NumericType> Source = Sources.col(Col) - OutSourceMean;
+			OutMoments.noalias() += (Weight * Source) * (Targets.col(Col) - OutTargetMean).transpose();
+			OutVariance += Weight * Source.squaredNorm();
+		}
+	}
+
+	// Horn's method: the closest rotation to A (maximizing trace(R^T A)) is the unit quaternion q maximizing q^T N q, the
+	// largest eigenvector of the symmetric 4x4 matrix N built from the entries of A^T
+	template<typename NumericType>
+	static void ClosestRotationSoA(const TRows9<NumericType>& Matrix, TRows4<NumericType>& OutRotation)
+	{
+		const int64 Num = Matrix.cols();
+		// S(a, b) = A(b, a), where A(b, a) is row b + 3 a
+		auto S = [&Matrix](int32 A, int32 B) { return Matrix.row(B + 3 * A); };
+		// only the upper triangle (Row <= Col) of N is kept
+		TRow<NumericType> N[4][4];
+		N[0][0] = S(0, 0) + S(1, 1) + S(2, 2);
+		N[0][1] = S(1, 2) - S(2, 1);
+		N[0][2] = S(2, 0) - S(0, 2);
+		N[0][3] = S(0, 1) - S(1, 0);
+		N[1][1] = S(0, 0) - S(1, 1) - S(2, 2);
+		N[1][2] = S(0, 1) + S(1, 0);
+		N[1][3] = S(2, 0) + S(0, 2);
+		N[2][2] = S(1, 1) - S(0, 0) - S(2, 2);
+		N[2][3] = S(1, 2) + S(2, 1);
+		N[3][3] = S(2, 2) - S(0, 0) - S(1, 1);
+		TRow<NumericType> V[4][4];
+		for (int32 Row = 0; Row < 4; Row++) {
+			for (int32 Col = 0; Col < 4; Col++) {
+				V[Row][Col].setConstant(1, Num, Row == Col ? (NumericType)1 : (NumericType)0);
+			}
+		}
+		// N is scaled by its largest entry, which changes no eigenvector and keeps the squares below from overflowing
+		TRow<NumericType> Scale = N[0][0].abs();
+		for (int32 Row = 0; Row < 4; Row++) {
+			for (int32 Col = Row; Col < 4; Col++) {
+				Scale = Scale.max(N[Row][Col].abs());
+			}
+		}
+		Scale = (NumericType)1 / Scale.max(std::numeric_limits<NumericType>::min());
+		for (int32 Row = 0; Row < 4; Row++) {
+			for (int32 Col = Row; Col < 4; Col++) {
+				N[Row][Col] *= Scale;
+			}
+		}
+		TRow<NumericType> Difference, Sign, T, C, Sn, Rp, Rq;
+		for (int32 Sweep = 0; Sweep < MaxSweeps; Sweep++) {
+			for (int32 P = 0; P < 3; P++) {
+				for (int32 Q = P + 1; Q < 4; Q++) {
+					// the rotation in the (P, Q) plane which zeroes N(P, Q), t = tan(angle) with |angle| <= pi/4 as in
+					// Numerical Recipes, written as t = 2 Npq sign(d) / (|d| + sqrt(d^2 + 4 Npq^2)) with d = Nqq - Npp.
+					// sign(d) (+1 for d = 0) is built from a lane wise comparison, like the largest eigenvalue search below.
+					// pivots of lanes which already converged get so small that their squares are denormal, which is
+					// very slow on x86, so they are flushed to zero (N is scaled to 1, this is far below the precision)
+					TRow<NumericType>& Apq = N[P][Q];
+					Apq -= Apq.max(-FlushThreshold<NumericType>()).min(FlushThreshold<NumericType>());
+					Difference = N[Q][Q] - N[P][P];
+					Sign = (Difference < (NumericType)0).template cast<NumericType>() * (NumericType)-2 + (NumericType)1;
+					T = (NumericType)2 * Apq * Sign / (Difference.abs() + (Difference.square() + (NumericType)4 * Apq.square()).sqrt() + std::numeric_limits<NumericType>::min());
+					C = (NumericType)1 / (T.square() + (NumericType)1).sqrt();
+					Sn = T * C;
+					N[P][P] -= T * Apq;
+					N[Q][Q] += T * Apq;
+					N[P][Q].setZero();
+					for (int32 R = 0; R < 4; R++) {
+						if (R == P || R == Q) {
+							continue;
+						}
+						TRow<NumericType>& NRp = R < P ? N[R][P] : N[P][R];
+						TRow<NumericType>& NRq = R < Q ? N[R][Q] : N[Q][R];
+						Rp = NRp;
+						NRp = C * Rp - Sn * NRq;
+						NRq = Sn * Rp + C * NRq;
+					}
+					for (int32 R = 0; R < 4; R++) {
+						Rp = V[R][P];
+						Rq = V[R][Q];
+						V[R][P] = C * Rp - Sn * Rq;
+						V[R][Q] = Sn * Rp + C * Rq;
+					}
+				}
+			}
+			TRow<NumericType> OffDiagonal = N[0][1].square() + N[0][2].square() + N[0][3].square() + N[1][2].square() + N[1][3].square() + N[2][3].square();
+			TRow<NumericType> Diagonal = N[0][0].square() + N[1][1].square() + N[2][2].square() + N[3][3].square();
+			if ((OffDiagonal - Diagonal * (SweepTolerance<NumericType>() * SweepTolerance<NumericType>())).maxCoeff() <= (NumericType)0) {
+				break;
+			}
+		}
+		// the eigenvector of the largest eigenvalue, q = (w, x, y, z)
+		TRow<NumericType> Best = N[0][0];
+		for (int32 Row = 0; Row < 4; Row++) {
+			OutRotation.row(Row == 0 ? 3 : Row - 1) = V[Row][0];
+		}
+		for (int32 Col = 1; Col < 4; Col++) {
+			const TRow<NumericType> bLarger = (N[Col][Col] > Best).template cast<NumericType>();
+			Best = Best.max(N[Col][Col]);
+			for (int32 Row = 0; Row < 4; Row++) {
+				const int32 Out = Row == 0 ? 3 : Row - 1;
+				OutRotation.row(Out) += bLarger * (V[Row][Col] - OutRotation.row(Out));
+			}
+		}
+		// q and -q are the same rotation, a non-negative w keeps the output continuous
+		Sign = (OutRotation.row(3) < (NumericType)0).template cast<NumericType>() * (NumericType)-2 + (NumericType)1;
+		for (int32 Row = 0; Row < 4; Row++) {
+			OutRotation.row(Row) *= Sign;
+		}
+	}
+	// column-major rotation matrices of unit quaternions (x y z w)
+	template<typename NumericType>
+	static void QuaternionToMatrixSoA(const TRows4<NumericType>& Quaternion, TRows9<NumericType>& OutMatrix)
+	{
+		const auto X = Quaternion.row(0);
+		const auto Y = Quaternion.row(1);
+		const auto Z = Quaternion.row(2);
+		const auto W = Quaternion.row(3);
+		OutMatrix.row(0) = (NumericType)1 - (NumericType)2 * (Y.square() + Z.square());
+		OutMatrix.row(1) = (NumericType)2 * (X * Y + Z * W);
+		OutMatrix.row(2) = (NumericType)2 * (X * Z - Y * W);
+		OutMatrix.row(3) = (NumericType)2 * (X * Y - Z * W);
+		OutMatrix.row(4) = (NumericType)1 - (NumericType)2 * (X.square() + Z.square());
+		OutMatrix.row(5) = (NumericType)2 * (Y * Z + X * W);
+		OutMatrix.row(6) = (NumericType)2 * (X * Z + Y * W);
+		OutMatrix.row(7) = (NumericType)2 * (Y * Z - X * W);
+		OutMatrix.row(8) = (NumericType)1 - (NumericType)2 * (X.square() + Y.square());
+	}
+};
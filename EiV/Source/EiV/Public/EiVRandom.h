@@ -0,0 +1,280 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+//<><><><><><><><><><><><> EiVLibrary Import Block <><><><><><><><><><><><>
+//imports the specified headers by the macro definitions
+
+#define EIV_INCLUDE_DENSE_MATRIX_ARRAY    //includes most core and basic features
+#define EIV_INCLUDE_DENSE_LINEAR_PROBLEMS //includes solvers
+#define EIV_UNDEFINE_INCLUDES             //ensures that these include macros above are local to this file
+
+#include "EiVLibrary.h"   //takes the EIV_INCLUDE macros as settings and retrieves
+                          //the specified Eigen modules, typedefs, and helper functions
+//<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>
+#include "Math/RandomStream.h"
+
+/*
+* Random matrix generation with the Philox4x32-10 counter-based generator (Salmon et al., "Parallel random numbers:
+* as easy as 1, 2, 3"). Philox turns a 64 bit key and a 64 bit counter into 4 random 32 bit words with 10 rounds of
+* multiplies and xors, so the value at every position of the output only depends on the key and its position. Fills
+* are split over the worker threads at any boundary and still give the same values, a fill can start at any counter
+* (skip ahead is free) and different keys give independent streams, unlike std::rand behind Eigen's Random().
+* Counters are generated BlockSize at a time, each of the 4 words in its own array, so the rounds run as plain loops
+* the compiler vectorizes across the counters (32x32 to 64 bit multiplies), and the conversions to normals use Eigen's
+* vectorized log, sin and cos on the whole block.
+* Every counter gives ValuesPerCounter values, 2 doubles (53 random bits each) or 4 floats (24 random bits each),
+* so a fill of Count values uses GetNumCounters(Count) counters, and the next fill with the same key can continue
+* after them. Keys can come from an FRandomStream with MakeKey.
+* For this whole struct the <NumericType> is the datatype of the generated values, float or double.
+*/
+struct EIV_API FEiVRandom
+{
+	// The number of counters generated together
+	static constexpr int32 BlockSize = 64;
+	// The smallest number of values worth a worker thread
+	static constexpr int64 MinValuesPerTask = 1 << 16;
+
+	// This function makes a key from the next values of a random stream, advancing it
+	// @param Stream - the random stream
+	// @returns - the key
+	static uint64 MakeKey(const FRandomStream& Stream)
+	{
+		const uint64 Low = Stream.GetUnsignedInt();
+		const uint64 High = Stream.GetUnsignedInt();
+		return (High << 32) | Low;
+	}
+	// This function reserves counters of the process-wide key, for callers which need values without owning a key or
+	// a stream. The reservation is atomic, so different threads never get the same values.
+	// @param NumCounters - the number of counters to reserve
+	// @returns - the first reserved counter, use it with GlobalKey
+	static uint64 ReserveGlobalCounters(uint64 NumCounters);
+	// The process-wide key of ReserveGlobalCounters
+	static constexpr uint64 GlobalKey = 0x243F6A8885A308D3ull;
+
+	// @returns - the number of values one counter gives
+	template<typename NumericType>
+	static constexpr int32 ValuesPerCounter() { return sizeof(NumericType) == sizeof(double) ? 2 : 4; }
+	// @param Count - the number of values
+	// @returns - the number of counters a fill of Count values uses
+	template<typename NumericType>
+	static uint64 GetNumCounters(int64 Count) { return (uint64)((FMath::Max<int64>(Count, 0) + ValuesPerCounter<NumericType>() - 1) / ValuesPerCounter<NumericType>()); }
+
+	// This function generates the 4 Philox4x32-10 words of consecutive counters
+	// @param Key - the key
+	// @param FirstCounter - the first counter
+	// @param Count - the number of counters, at most BlockSize
+	// @param OutWords - the words, OutWords[Word][Counter - FirstCounter]
+	static void Philox(uint64 Key, uint64 FirstCounter, int32 Count, uint32 (&OutWords)[4][BlockSize])
+	{
+		uint32* RESTRICT C0 = OutWords[0];
+		uint32* RESTRICT C1 = OutWords[1];
+		uint32* RESTRICT C2 = OutWords[2];
+		uint32* RESTRICT C3 = OutWords[3];
+		for (int32 i = 0; i < Count; i++) {
+			C0[i] = (uint32)(FirstCounter + i);
+			C1[i] = (uint32)((FirstCounter + i) >> 32);
+			C2[i] = 0;
+			C3[i] = 0;
+		}
+		uint32 K0 = (uint32)Key;
+		uint32 K1 = (uint32)(Key >> 32);
+		for (int32 Round = 0; Round < 10; Round++) {
+			for (int32 i = 0; i < Count; i++) {
+				const uint64 P0 = (uint64)0xD2511F53u * C0[i];
+				const uint64 P1 = (uint64)0xCD9E8D57u * C2[i];
+				const uint32 N0 = (uint32)(P1 >> 32) ^ C1[i] ^ K0;
+				const uint32 N2 = (uint32)(P0 >> 32) ^ C3[i] ^ K1;
+				C1[i] = (uint32)P1;
+				C3[i] = (uint32)P0;
+				C0[i] = N0;
+				C2[i] = N2;
+			}
+			K0 += 0x9E3779B9u;
+			K1 += 0xBB67AE85u;
+		}
+	}
+	// This function fills an array with values uniformly distributed in [Min, Max)
+	// @param Key - the key
+	// @param FirstCounter - the first counter
+	// @param Min - the smallest value
+	// @param Max - the end of the range
+	// @param OutData - Count values
+	// @param Count - the number of values
+	// @param bParallel - if true large fills are split over the worker threads, the values are the same either way
+	template<typename NumericType = double>
+	static void FillUniform(uint64 Key, uint64 FirstCounter, NumericType Min, NumericType Max, NumericType* OutData, int64 Count, bool bParallel = true)
+	{
+		FEiVRandom::Fill<NumericType>(Key, FirstCounter, OutData, Count, bParallel, [Min, Max](TSlots<NumericType>& Values)
+		{
+			Values = Min + (Max - Min) * Values;
+		});
+	}
+	// This function fills an array with normally distributed values (Box-Muller)
+	// @param Key - the key
+	// @param FirstCounter - the first counter
+	// @param Mean - the mean of the values
+	// @param StandardDeviation - the standard deviation of the values
+	// @param OutData - Count values
+	// @param Count - the number of values
+	// @param bParallel - if true large fills are split over the worker threads, the values are the same either way
+	template<typename NumericType = double>
+	static void FillNormal(uint64 Key, uint64 FirstCounter, NumericType Mean, NumericType StandardDeviation, NumericType* OutData, int64 Count, bool bParallel = true)
+	{
+		FEiVRandom::Fill<NumericType>(Key, FirstCounter, OutData, Count, bParallel, [Mean, StandardDeviation](TSlots<NumericType>& Values)
+		{
+			// the slots pair up, the first of a pair gives the radius and the second the angle
+			for (int32 Pair = 0; Pair < ValuesPerCounter<NumericType>(); Pair += 2) {
+				// 1 - u is in (0, 1], so the log is finite
+				const EiVArray<NumericType, BlockSize, 1> Radius = StandardDeviation * (((NumericType)1 - Values.col(Pair)).log() * (NumericType)-2).sqrt();
+				const EiVArray<NumericType, BlockSize, 1> Angle = (NumericType)(2.0 * UE_DOUBLE_PI) * Values.col(Pair + 1);
+				Values.col(Pair) = Mean + Radius * Angle.cos();
+				Values.col(Pair + 1) = Mean + Radius * Angle.sin();
+			}
+		});
+	}
+
+private:
+	// the values of one block of counters, column v holds value v of every counter
+	template<typename NumericType> using TSlots = EiVArray<NumericType, BlockSize, sizeof(NumericType) == sizeof(double) ? 2 : 4>;
+
+	// fills Count values with the uniforms in [0, 1) of consecutive counters, transformed by Kernel(TSlots&)
+	template<typename NumericType, typename KernelType>
+	static void Fill(uint64 Key, uint64 FirstCounter, NumericType* OutData, int64 Count, bool bParallel, const KernelType& Kernel)
+	{
+		constexpr int32 PerCounter = ValuesPerCounter<NumericType>();
+		const int64 NumCounters = (int64)FEiVRandom::GetNumCounters<NumericType>(Count);
+		const int32 NumBlocks = (int32)((NumCounters + BlockSize - 1) / BlockSize);
+		FEiVHelper::ForEachRange(NumBlocks, MinValuesPerTask / (BlockSize * PerCounter), [&](int32 FirstBlock, int32 LastBlock)
+		{
+			alignas(64) uint32 Words[4][BlockSize];
+			TSlots<NumericType> Values;
+			EiVArray<NumericType, BlockSize, PerCounter, Eigen::RowMajor> Interleaved;
+			for (int32 Block = FirstBlock; Block < LastBlock; Block++) {
+				const int64 First = (int64)Block * BlockSize;
+				const int32 Counters = (int32)FMath::Min<int64>(BlockSize, NumCounters - First);
+				FEiVRandom::Philox(Key, FirstCounter + (uint64)First, Counters, Words);
+				FEiVRandom::ToUniforms(Words, Counters, Values);
+				if (Counters < BlockSize) {
+					// the rows past the last counter are not written, zero them so the kernel never reads garbage
+					Values.bottomRows(BlockSize - Counters).setZero();
+				}
+				Kernel(Values);
+				// value v of counter c is element c * PerCounter + v of the output
+				Interleaved = Values;
+				const int64 Written = FMath::Min<int64>((int64)Counters * PerCounter, Count - First * PerCounter);
+				FMemory::Memcpy(OutData + First * PerCounter, Interleaved.data(), Written * sizeof(NumericType));
+			}
+		}, bParallel);
+	}
+	// 53 bit doubles from word pairs
+	static void ToUniforms(const uint32 (&Words)[4][BlockSize], int32 Count, TSlots<double>& OutValues)
+	{
+		for (int32 Slot = 0; Slot < 2; Slot++) {
+			const uint32* RESTRICT High = Words[2 * Slot];
+			const uint32* RESTRICT Low = Words[2 * Slot + 1];
+			double* RESTRICT Out = OutValues.col(Slot).data();
+			for (int32 i = 0; i < Count; i++) {
+				Out[i] = (double)(((uint64)(High[i] >> 5) << 26) | (uint64)(Low[i] >> 6)) * (1.0 / 9007199254740992.0);
+			}
+		}
+	}
+	// 24 bit floats from single words
+	static void ToUniforms(const uint32 (&Words)[4][BlockSize], int32 Count, TSlots<float>& OutValues)
+	{
+		for (int32 Slot = 0; Slot < 4; Slot++) {
+			const uint32* RESTRICT In = Words[Slot];
+			float* RESTRICT Out = OutValues.col(Slot).data();
+			for (int32 i = 0; i < Count; i++) {
+				Out[i] = (float)(int32)(In[i] >> 8) * (1.0f / 16777216.0f);
+			}
+		}
+	}
+};
+
+/*
+* A multivariate normal distribution N(Mean, Covariance) to sample with FEiVRandom. The Cholesky factor L of the
+* covariance is computed once when the distribution is set, and every sample is Mean + L * z for a vector z of
+* standard normal values, so sampling is one normal fill and one triangular product.
+* For this whole class the <NumericType> is the datatype of the distribution and the samples, float or double.
+*/
+template<typename NumericType = double>
+class TEiVMultivariateNormal
+{
+public:
+	// This function sets the distribution
+	// @param InMean - the mean, a vector of Dimension values
+	// @param Covariance - the Dimension x Dimension symmetric positive definite covariance, only its lower triangle is read
+	// @returns - false if the sizes do not match or the covariance is not positive definite, the distribution is cleared then
+	bool SetDistribution(const EiVVectorX<NumericType>& InMean, const EiVMatrixX<NumericType>& Covariance)
+	{
+		Mean.resize(0);
+		Factor.resize(0, 0);
+		if (InMean.size() == 0 || Covariance.rows() != InMean.size() || Covariance.cols() != InMean.size()) {
+			return false;
+		}
+		const EiVLLT<EiVMatrixX<NumericType>> LLT(Covariance);
+		if (LLT.info() != EiVComputationInfo::Success) {
+			return false;
+		}
+		Mean = InMean;
+		Factor = LLT.matrixL();
+		return true;
+	}
+	// This function sets the distribution from a Cholesky factor computed before, such as a cached one
+	// @param InMean - the mean, a vector of Dimension values
+	// @param CholeskyFactor - the Dimension x Dimension lower triangular factor L of the covariance L * L^T, only its lower triangle is read
+	// @returns - false if the sizes do not match, the distribution is cleared then
+	bool SetCholeskyFactor(const EiVVectorX<NumericType>& InMean, const EiVMatrixX<NumericType>& CholeskyFactor)
+	{
+		Mean.resize(0);
+		Factor.resize(0, 0);
+		if (InMean.size() == 0 || CholeskyFactor.rows() != InMean.size() || CholeskyFactor.cols() != InMean.size()) {
+			return false;
+		}
+		Mean = InMean;
+		Factor = CholeskyFactor;
+		return true;
+	}
+	// This function draws samples
+	// @param Key - the key of FEiVRandom
+	// @param FirstCounter - the first counter of FEiVRandom, the samples use GetNumCounters(NumSamples) counters
+	// @param NumSamples - the number of samples
+	// @param OutSamples - a Dimension x NumSamples matrix, one sample per column
+	// @param bParallel - if true many samples are split over the worker threads, the samples are the same either way
+	// @returns - false if no distribution is set
+	bool Sample(uint64 Key, uint64 FirstCounter, int32 NumSamples, EiVMatrixX<NumericType>& OutSamples, bool bParallel = true) const
+	{
+		if (Mean.size() == 0) {
+			return false;
+		}
+		OutSamples.resize(Mean.size(), FMath::Max(NumSamples, 0));
+		FEiVRandom::FillNormal<NumericType>(Key, FirstCounter, (NumericType)0, (NumericType)1, OutSamples.data(), OutSamples.size(), bParallel);
+		// a sample costs about Dimension^2 multiply-adds
+		FEiVHelper::ForEachRange((int32)OutSamples.cols(), FEiVRandom::MinValuesPerTask / (Mean.size() * Mean.size()), [&](int32 First, int32 Last)
+		{
+			auto Block = OutSamples.middleCols(First, Last - First);
+			Block = (Factor.template triangularView<EiVUpLoType::Lower>() * Block).colwise() + Mean;
+		}, bParallel);
+		return true;
+	}
+	// @param NumSamples - the number of samples
+	// @returns - the number of FEiVRandom counters Sample uses for them
+	uint64 GetNumCounters(int32 NumSamples) const { return FEiVRandom::GetNumCounters<NumericType>((int64)Mean.size() * FMath::Max(NumSamples, 0)); }
+	// @returns - the dimension of the distribution, 0 if none is set
+	int32 GetDimension() const { return (int32)Mean.size(); }
+	// @returns - the mean
+	const EiVVectorX<NumericType>& GetMean() const { return Mean; }
+	// @returns - the lower triangular Cholesky factor of the covariance
+	const EiVMatrixX<NumericType>& GetCholeskyFactor() const { return Factor; }
+
+private:
+	EiVVectorX<NumericType> Mean;
+	EiVMatrixX<NumericType> Factor;
+};
@@ -0,0 +1,253 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+//<><><><><><><><><><><><> EiVLibrary Import Block <><><><><><><><><><><><>
+//imports the specified headers by the macro definitions
+
+#define EIV_INCLUDE_DENSE_MATRIX_ARRAY    //includes most core and basic features
+#define EIV_INCLUDE_GEOMETRY              //includes geometric utilities
+#define EIV_UNDEFINE_INCLUDES             //ensures that these include macros above are local to this file
+
+#include "EiVLibrary.h"   //takes the EIV_INCLUDE macros as settings and retrieves
+                          //the specified Eigen modules, typedefs, and helper functions
+//<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>
+
+/*
+* A batch of rays origin + t * direction in structure of arrays layout. Origins and Directions have one row per ray and
+* are column-major, so the x, y and z of all rays are three contiguous arrays the packet kernels stream through.
+* The inverse directions for the box tests are computed when the rays are set, axis parallel directions get a huge
+* finite inverse instead of an infinite one, so a ray starting on a box face never produces 0 * inf = NaN.
+* For this whole struct the <NumericType> is the datatype of the numbers stored in the Eigen types.
+*/
+template<typename NumericType = float>
+struct TEiVRayBuffer
+{
+	EiVArrayX3<NumericType> Origins;
+	EiVArrayX3<NumericType> Directions;
+	EiVArrayX3<NumericType> InverseDirections;
+
+	// @returns - the number of rays
+	int32 Num() const { return (int32)Origins.rows(); }
+	// This function sets the rays from Unreal Engine rays, normalizing their directions like FEiVHelper::RayToParameterizedLine
+	// @param Rays - the rays
+	void SetRays(TConstArrayView<FRay> Rays)
+	{
+		Origins.resize(Rays.Num(), 3);
+		Directions.resize(Rays.Num(), 3);
+		for (int32 Ray = 0; Ray < Rays.Num(); Ray++) {
+			const FVector Direction = Rays[Ray].Direction.GetSafeNormal();
+			Origins.row(Ray) << (NumericType)Rays[Ray].Origin.X, (NumericType)Rays[Ray].Origin.Y, (NumericType)Rays[Ray].Origin.Z;
+			Directions.row(Ray) << (NumericType)Direction.X, (NumericType)Direction.Y, (NumericType)Direction.Z;
+		}
+		UpdateInverseDirections();
+	}
+	// This function sets the rays from EiV parameterized lines
+	// @param Lines - the lines, the distances along them are in units of their direction vectors
+	void SetRays(TConstArrayView<EiVParameterizedLine<NumericType, 3>> Lines)
+	{
+		Origins.resize(Lines.Num(), 3);
+		Directions.resize(Lines.Num(), 3);
+		for (int32 Ray = 0; Ray < Lines.Num(); Ray++) {
+			Origins.row(Ray) = Lines[Ray].origin().transpose().array();
+			Directions.row(Ray) = Lines[Ray].direction().transpose().array();
+		}
+		UpdateInverseDirections();
+	}
+	// This function recomputes the inverse directions, call it after writing to Directions directly
+	void UpdateInverseDirections()
+	{
+		const NumericType Tiny = std::numeric_limits<NumericType>::min();
+		// keeps the sign of the direction, so a ray along +x still has a huge positive inverse
+		InverseDirections = (Directions.abs() < Tiny).select((Directions >= (NumericType)0).template cast<NumericType>() * (NumericType)2 * Tiny - Tiny, Directions).inverse();
+	}
+};
+
+/*
+* Packet ray intersection kernels against planes and axis-aligned boxes, for casting many rays per frame.
+* The rays are processed in chunks of ChunkSize rays. Every test is written as an Eigen array expression over the
+* contiguous coordinates of a chunk, so it runs SIMD-wide across the rays (4 floats per instruction with SSE, 8 with
+* AVX, whatever the build targets) without per-ray branches, and the chunks are split over the worker threads.
+* The nearest hit queries loop over the primitives inside each chunk, so a chunk stays in the L1 cache for all of them.
+* Merging the hits of a primitive into the nearest ones is a plain loop over the raw chunk arrays, Eigen 3.4 does not
+* vectorize comparisons and select(), while compilers vectorize such a loop into blends.
+* Rays hit between distance 0 and MaxDistance (in units of their direction vectors). Misses get the distance
+* MaxDistance, a 0 in the hit mask and the index INDEX_NONE.
+* For this whole struct the <NumericType> is the datatype of the numbers stored in the Eigen types.
+*/
+struct EIV_API FEiVRayPackets
+{
+	// The number of rays tested together
+	static constexpr int32 ChunkSize = 256;
+	// The smallest number of ray-primitive tests worth a worker thread
+	static constexpr int64 MinTestsPerTask = 1 << 15;
+
+	// This function intersects rays with a plane, from both sides
+	// @param Rays - the rays
+	// @param Plane - the plane n . x + d = 0
+	// @param MaxDistance - the largest distance of a hit
+	// @param OutDistances - Num() distances, where the rays cross the plane
+	// @param OutHits - Num() values, 1 for the rays crossing the plane and 0 for the others
+	template<typename NumericType = float>
+	static void IntersectPlane(const TEiVRayBuffer<NumericType>& Rays, const EiVHyperplane<NumericType, 3>& Plane, NumericType MaxDistance, NumericType* OutDistances, uint8* OutHits)
+	{
+		const EiVVector3<NumericType> Normal = Plane.normal();
+		const NumericType Offset = Plane.offset();
+		FEiVHelper::ForEachChunk(Rays.Num(), ChunkSize, MinRaysPerTask(1), [&](int32 First, int32 Count)
+		{
+			const TChunkArray<NumericType> Distance = FEiVRayPackets::PlaneDistances(Rays, First, Count, Normal, Offset);
+			// parallel rays divide by zero, their infinite or NaN distances fail the range test
+			const auto Hit = Distance >= (NumericType)0 && Distance <= MaxDistance;
+			EiVMap<EiVArrayX<NumericType>>(OutDistances + First, Count) = Hit.select(Distance, MaxDistance);
+			EiVMap<EiVArrayX<uint8>>(OutHits + First, Count) = Hit.template cast<uint8>();
+		});
+	}
+	// This function intersects rays with an axis-aligned box with the slab test
+	// @param Rays - the rays
+	// @param Box - the box
+	// @param MaxDistance - the largest distance of a hit
+	// @param OutDistances - Num() distances, where the rays enter the box (0 for rays starting inside it)
+	// @param OutHits - Num() values, 1 for the rays hitting the box and 0 for the others
+	template<typename NumericType = float>
+	static void IntersectBox(const TEiVRayBuffer<NumericType>& Rays, const EiVAlignedBox<NumericType, 3>& Box, NumericType MaxDistance, NumericType* OutDistances, uint8* OutHits)
+	{
+		FEiVHelper::ForEachChunk(Rays.Num(), ChunkSize, MinRaysPerTask(1), [&](int32 First, int32 Count)
+		{
+			TChunkArray<NumericType> Enter, Exit;
+			FEiVRayPackets::Slabs(Rays, First, Count, Box, MaxDistance, Enter, Exit);
+			const auto Hit = Enter <= Exit;
+			EiVMap<EiVArrayX<NumericType>>(OutDistances + First, Count) = Hit.select(Enter, MaxDistance);
+			EiVMap<EiVArrayX<uint8>>(OutHits + First, Count) = Hit.template cast<uint8>();
+		});
+	}
+	// This function finds the nearest of several planes every ray crosses
+	// @param Rays - the rays
+	// @param Planes - the planes n . x + d = 0
+	// @param NumPlanes - the number of planes
+	// @param MaxDistance - the largest distance of a hit
+	// @param OutDistances - Num() distances of the nearest crossings
+	// @param OutIndices - Num() indices of the nearest planes crossed, INDEX_NONE for the rays crossing none
+	template<typename NumericType = float>
+	static void IntersectPlanesNearest(const TEiVRayBuffer<NumericType>& Rays, const EiVHyperplane<NumericType, 3>* Planes, int32 NumPlanes, NumericType MaxDistance, NumericType* OutDistances, int32* OutIndices)
+	{
+		FEiVHelper::ForEachChunk(Rays.Num(), ChunkSize, MinRaysPerTask(NumPlanes), [&](int32 First, int32 Count)
+		{
+			TChunkArray<NumericType> Nearest = TChunkArray<NumericType>::Constant(Count, MaxDistance);
+			TChunkArray<int32> Index = TChunkArray<int32>::Constant(Count, INDEX_NONE);
+			for (int32 Plane = 0; Plane < NumPlanes; Plane++) {
+				const TChunkArray<NumericType> Distance = FEiVRayPackets::PlaneDistances<NumericType>(Rays, First, Count, Planes[Plane].normal(), Planes[Plane].offset());
+				const NumericType* DistanceData = Distance.data();
+				NumericType* NearestData = Nearest.data();
+				int32* IndexData = Index.data();
+				for (int32 Ray = 0; Ray < Count; Ray++) {
+					const bool bCloser = DistanceData[Ray] >= (NumericType)0 && DistanceData[Ray] < NearestData[Ray];
+					IndexData[Ray] = bCloser ? Plane : IndexData[Ray];
+					NearestData[Ray] = bCloser ? DistanceData[Ray] : NearestData[Ray];
+				}
+			}
+			EiVMap<EiVArrayX<NumericType>>(OutDistances + First, Count) = Nearest;
+			EiVMap<EiVArrayX<int32>>(OutIndices + First, Count) = Index;
+		});
+	}
+	// This function finds the nearest of several axis-aligned boxes every ray hits
+	// @param Rays - the rays
+	// @param Boxes - the boxes
+	// @param NumBoxes - the number of boxes
+	// @param MaxDistance - the largest distance of a hit
+	// @param OutDistances - Num() distances where the rays enter their nearest box (0 for rays starting inside it)
+	// @param OutIndices - Num() indices of the nearest boxes hit, INDEX_NONE for the rays hitting none
+	template<typename NumericType = float>
+	static void IntersectBoxesNearest(const TEiVRayBuffer<NumericType>& Rays, const EiVAlignedBox<NumericType, 3>* Boxes, int32 NumBoxes, NumericType MaxDistance, NumericType* OutDistances, int32* OutIndices)
+	{
+		FEiVHelper::ForEachChunk(Rays.Num(), ChunkSize, MinRaysPerTask(NumBoxes), [&](int32 First, int32 Count)
+		{
+			TChunkArray<NumericType> Nearest = TChunkArray<NumericType>::Constant(Count, MaxDistance);
+			TChunkArray<int32> Index = TChunkArray<int32>::Constant(Count, INDEX_NONE);
+			TChunkArray<NumericType> Enter, Exit;
+			for (int32 Box = 0; Box < NumBoxes; Box++) {
+				// the nearest hit so far is the far limit, so boxes behind it are rejected by the slab test itself
+				FEiVRayPackets::Slabs(Rays, First, Count, Boxes[Box], Nearest, Enter, Exit);
+				// Exit <= Nearest, so every hit is at least as near as the nearest so far
+				const NumericType* EnterData = Enter.data();
+				const NumericType* ExitData = Exit.data();
+				NumericType* NearestData = Nearest.data();
+				int32* IndexData = Index.data();
+				for (int32 Ray = 0; Ray < Count; Ray++) {
+					const bool bHit = EnterData[Ray] <= ExitData[Ray];
+					IndexData[Ray] = bHit ? Box : IndexData[Ray];
+					NearestData[Ray] = bHit ? EnterData[Ray] : NearestData[Ray];
+				}
+			}
+			EiVMap<EiVArrayX<NumericType>>(OutDistances + First, Count) = Nearest;
+			EiVMap<EiVArrayX<int32>>(OutIndices + First, Count) = Index;
+		});
+	}
+	// This function counts the axis-aligned boxes every ray passes through, for example the occluders between a sound
+	// and the listener
+	// @param Rays - the rays
+	// @param Boxes - the boxes
+	// @param NumBoxes - the number of boxes
+	// @param MaxDistance - the length of the rays
+	// @param OutCounts - Num() numbers of boxes hit within MaxDistance
+	template<typename NumericType = float>
+	static void CountBoxHits(const TEiVRayBuffer<NumericType>& Rays, const EiVAlignedBox<NumericType, 3>* Boxes, int32 NumBoxes, NumericType MaxDistance, int32* OutCounts)
+	{
+		FEiVHelper::ForEachChunk(Rays.Num(), ChunkSize, MinRaysPerTask(NumBoxes), [&](int32 First, int32 Count)
+		{
+			TChunkArray<int32> Hits = TChunkArray<int32>::Zero(Count);
+			TChunkArray<NumericType> Enter, Exit;
+			for (int32 Box = 0; Box < NumBoxes; Box++) {
+				FEiVRayPackets::Slabs(Rays, First, Count, Boxes[Box], MaxDistance, Enter, Exit);
+				const NumericType* EnterData = Enter.data();
+				const NumericType* ExitData = Exit.data();
+				int32* HitsData = Hits.data();
+				for (int32 Ray = 0; Ray < Count; Ray++) {
+					HitsData[Ray] += EnterData[Ray] <= ExitData[Ray] ? 1 : 0;
+				}
+			}
+			EiVMap<EiVArrayX<int32>>(OutCounts + First, Count) = Hits;
+		});
+	}
+
+private:
+	// the values of one chunk of rays, on the stack
+	template<typename Type> using TChunkArray = EiVArray<Type, EiVDynamic, 1, Eigen::ColMajor, ChunkSize, 1>;
+
+	// the smallest number of rays worth a worker thread when every ray runs TestsPerRay tests
+	static int64 MinRaysPerTask(int32 TestsPerRay)
+	{
+		return FMath::Max<int64>(MinTestsPerTask / FMath::Max(TestsPerRay, 1), 1);
+	}
+	// the distances at which the rays of a chunk cross the plane n . x + d = 0
+	template<typename NumericType>
+	static TChunkArray<NumericType> PlaneDistances(const TEiVRayBuffer<NumericType>& Rays, int32 First, int32 Count, const EiVVector3<NumericType>& Normal, NumericType Offset)
+	{
+		const auto Origins = Rays.Origins.middleRows(First, Count);
+		const auto Directions = Rays.Directions.middleRows(First, Count);
+		const TChunkArray<NumericType> Height = Origins.col(0) * Normal.x() + Origins.col(1) * Normal.y() + Origins.col(2) * Normal.z() + Offset;
+		const TChunkArray<NumericType> Speed = Directions.col(0) * Normal.x() + Directions.col(1) * Normal.y() + Directions.col(2) * Normal.z();
+		return -Height / Speed;
+	}
+	// the distances at which the rays of a chunk enter and leave a box, clipped to [0, Far]. Rays miss where Enter > Exit
+	template<typename NumericType, typename FarType>
+	static void Slabs(const TEiVRayBuffer<NumericType>& Rays, int32 First, int32 Count, const EiVAlignedBox<NumericType, 3>& Box, const FarType& Far, TChunkArray<NumericType>& OutEnter, TChunkArray<NumericType>& OutExit)
+	{
+		OutEnter.setZero(Count);
+		OutExit.resize(Count);
+		OutExit = Far;
+		for (int32 Axis = 0; Axis < 3; Axis++) {
+			const auto Origin = Rays.Origins.col(Axis).segment(First, Count);
+			const auto Inverse = Rays.InverseDirections.col(Axis).segment(First, Count);
+			const TChunkArray<NumericType> Near = (Box.min()[Axis] - Origin) * Inverse;
+			const TChunkArray<NumericType> Farther = (Box.max()[Axis] - Origin) * Inverse;
+			OutEnter = OutEnter.max(Near.min(Farther));
+			OutExit = OutExit.min(Near.max(Farther));
+		}
+	}
+};
@@ -0,0 +1,107 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+//<><><><><><><><><><><><> EiVLibrary Import Block <><><><><><><><><><><><>
+//imports the specified headers by the macro definitions
+
+#define EIV_INCLUDE_DENSE_MATRIX_ARRAY    //includes most core and basic features
+#define EIV_UNDEFINE_INCLUDES             //ensures that these include macros above are local to this file
+
+#include "EiVLibrary.h"   //takes the EIV_INCLUDE macros as settings and retrieves
+                          //the specified Eigen modules, typedefs, and helper functions
+//<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>
+#include <initializer_list>
+
+/*
+* A memoization cache for expensive pure computations on dense matrices, such as the decompositions, inverse, eigen
+* and rank Blueprint nodes. The Blueprint VM runs a pure node again for every node reading one of its outputs, every
+* time they run, so a decomposition read by three nodes is computed three times a frame although its input did not
+* change. With the cache enabled these calls find the result of the first one instead.
+* Entries are keyed by the operation, its scalar parameters and the content of its input matrices. The key is found
+* through a 64 bit hash of the sizes and bytes of the inputs, and a hit also compares the stored inputs bitwise with
+* the new ones, so a hash collision can never return a wrong result. Bitwise equal inputs give bitwise equal results,
+* so a hit is always exactly what the computation would have returned.
+* The cache holds at most MaxEntries entries and MaxBytes bytes of inputs and results, and evicts the least recently
+* used entries past these limits. It is disabled by default and is global to the process.
+* Only the game thread uses it. On any other thread, such as the Animation Blueprint worker threads the thread safe
+* nodes run on, FindOrCompute always computes, so those calls take no lock and never see results stored by another
+* thread. They return the same values either way.
+* Its hits, misses, entries and memory show in the "stat EiV" group.
+*/
+
+// The results of a cached computation, as many matrices, complex matrices and scalars as the operation returns
+struct FEiVCachedResult
+{
+	TArray<EiVMatrixXd> Matrices;
+	TArray<EiVMatrixXcd> ComplexMatrices;
+	TArray<double> Scalars;
+	bool bSuccess = true;
+};
+
+// The totals of the result cache since it was last cleared
+struct FEiVResultCacheStats
+{
+	int64 Hits = 0;
+	int64 Misses = 0;
+	int64 Evictions = 0;
+	int32 Entries = 0;
+	int64 Bytes = 0;
+};
+
+struct EIV_API FEiVResultCache
+{
+	// This function enables or disables the cache for the whole process, disabling it also clears it
+	// @param bEnabled - if true FindOrCompute stores and reuses results
+	static void SetEnabled(bool bEnabled);
+	// @returns - true if the cache is enabled
+	static bool IsEnabled();
+	// This function sets the limits of the cache, evicting the least recently used entries past them
+	// @param MaxEntries - the largest number of entries, at least 1
+	// @param MaxBytes - the largest memory of the stored inputs and results, results larger than this are never stored
+	static void SetLimits(int32 MaxEntries, int64 MaxBytes);
+	// This function removes all entries and resets the totals
+	static void Clear();
+	// @returns - the totals since the cache was last cleared
+	static FEiVResultCacheStats GetStats();
+	// This function hashes the size and content of a matrix
+	// @param Matrix - the matrix
+	// @param Seed - the hash to continue from
+	// @returns - the hash
+	static uint64 HashMatrix(const EiVMatrixXd& Matrix, uint64 Seed);
+
+	// This function returns the cached result of a computation, or computes and stores it
+	// @param Operation - the name of the computation, different computations must use different names
+	// @param InputList - the input matrices
+	// @param ParameterList - the scalar inputs which change the result (flags, sizes, seeds), converted to double
+	// @param OutResult - the result
+	// @param Compute - computes the result of the inputs into the FEiVCachedResult& it is called with, it only runs if
+	// the cache is disabled, is called off the game thread or does not hold the result
+	template<typename ComputeType>
+	static void FindOrCompute(FName Operation, std::initializer_list<const EiVMatrixXd*> InputList, std::initializer_list<double> ParameterList, FEiVCachedResult& OutResult, const ComputeType& Compute)
+	{
+		if (!IsInGameThread() || !FEiVResultCache::IsEnabled()) {
+			Compute(OutResult);
+			return;
+		}
+		const TConstArrayView<const EiVMatrixXd*> Inputs(InputList.begin(), (int32)InputList.size());
+		const TConstArrayView<double> Parameters(ParameterList.begin(), (int32)ParameterList.size());
+		const uint64 Hash = FEiVResultCache::HashKey(Operation, Inputs, Parameters);
+		if (FEiVResultCache::Find(Hash, Operation, Inputs, Parameters, OutResult)) {
+			return;
+		}
+		Compute(OutResult);
+		FEiVResultCache::Add(Hash, Operation, Inputs, Parameters, OutResult);
+	}
+
+private:
+	static uint64 HashKey(FName Operation, TConstArrayView<const EiVMatrixXd*> Inputs, TConstArrayView<double> Parameters);
+	static bool Find(uint64 Hash, FName Operation, TConstArrayView<const EiVMatrixXd*> Inputs, TConstArrayView<double> Parameters, FEiVCachedResult& OutResult);
+	static void Add(uint64 Hash, FName Operation, TConstArrayView<const EiVMatrixXd*> Inputs, TConstArrayView<double> Parameters, const FEiVCachedResult& Result);
+};
@@ -0,0 +1,136 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+//<><><><><><><><><><><><> EiVLibrary Import Block <><><><><><><><><><><><>
+//imports the specified headers by the macro definitions
+
+#define EIV_INCLUDE_DENSE_MATRIX_ARRAY    //includes most core and basic features
+#define EIV_INCLUDE_DENSE_LINEAR_PROBLEMS //includes solvers
+#define EIV_UNDEFINE_INCLUDES             //ensures that these include macros above are local to this file
+
+#include "EiVLibrary.h"   //takes the EIV_INCLUDE macros as settings and retrieves
+                          //the specified Eigen modules, typedefs, and helper functions
+//<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>
+#include "EiVRandom.h"
+
+/*
+* Singular value decompositions A = U * S * V^T of dense matrices. Small matrices use the two-sided Jacobi SVD, which
+* is the most accurate, larger ones the divide and conquer BDCSVD, which is much faster past a few dozen rows.
+* The randomized truncated SVD only finds the largest singular values. It projects A onto a few random directions,
+* sharpens that subspace with power iterations and decomposes the small projected matrix, so it costs
+* O(rows * cols * rank) instead of the O(rows * cols * min(rows, cols)) of a full SVD.
+* For this whole struct the <NumericType> is the datatype of the numbers stored in the Eigen types.
+*/
+struct EIV_API FEiVSVD
+{
+	// Matrices whose smaller dimension is at most this use JacobiSVD, larger ones BDCSVD
+	static constexpr int32 JacobiMaxSize = 32;
+
+	// This function computes the singular value decomposition of a matrix
+	// @param InMatrix - the matrix to decompose
+	// @param bThin - if true only the first min(rows, cols) columns of U and V are computed
+	// @param bComputeUV - if false only the singular values are computed, which is a lot cheaper
+	// @param OutU - the left singular vectors, one per column (empty if bComputeUV is false)
+	// @param OutSingularValues - the singular values in decreasing order
+	// @param OutV - the right singular vectors, one per column (empty if bComputeUV is false)
+	// @returns - false if the matrix is empty or the decomposition failed (for example on NaN or infinite values)
+	template<typename NumericType = double>
+	static bool Compute(const EiVMatrixX<NumericType>& InMatrix, bool bThin, bool bComputeUV, EiVMatrixX<NumericType>& OutU, EiVVectorX<NumericType>& OutSingularValues, EiVMatrixX<NumericType>& OutV)
+	{
+		if (InMatrix.size() == 0) {
+			return false;
+		}
+		const unsigned int Options = bComputeUV ? (bThin ? Eigen::ComputeThinU | Eigen::ComputeThinV : Eigen::ComputeFullU | Eigen::ComputeFullV) : 0;
+		if (FMath::Min(InMatrix.rows(), InMatrix.cols()) <= JacobiMaxSize) {
+			EiVJacobiSVD<EiVMatrixX<NumericType>, Eigen::ColPivHouseholderQRPreconditioner> SVD(InMatrix, Options);
+			return FEiVSVD::Extract(SVD, bComputeUV, OutU, OutSingularValues, OutV);
+		}
+		EiVBDCSVD<EiVMatrixX<NumericType>> SVD(InMatrix, Options);
+		return FEiVSVD::Extract(SVD, bComputeUV, OutU, OutSingularValues, OutV);
+	}
+	// This function computes the largest singular values and vectors of a matrix with a randomized range finder.
+	// @param InMatrix - the matrix to decompose
+	// @param Rank - the number of singular triplets to compute
+	// @param Oversampling - extra random directions beyond Rank, 5 to 10 makes the top Rank triplets accurate
+	// @param PowerIterations - rounds of multiplying by A * A^T, which sharpen the result when the singular values decay slowly
+	// @param Seed - the seed of the random directions, the same seed gives the same result
+	// @param OutU - the Rank left singular vectors, one per column
+	// @param OutSingularValues - the Rank largest singular values in decreasing order
+	// @param OutV - the Rank right singular vectors, one per column
+	// @returns - false if the matrix is empty, Rank is not positive or the decomposition failed
+	template<typename NumericType = double>
+	static bool ComputeRandomized(const EiVMatrixX<NumericType>& InMatrix, int32 Rank, int32 Oversampling, int32 PowerIterations, int32 Seed, EiVMatrixX<NumericType>& OutU, EiVVectorX<NumericType>& OutSingularValues, EiVMatrixX<NumericType>& OutV)
+	{
+		if (InMatrix.size() == 0 || Rank <= 0) {
+			return false;
+		}
+		const int64 MinSize = FMath::Min(InMatrix.rows(), InMatrix.cols());
+		const int64 TargetRank = FMath::Min<int64>(Rank, MinSize);
+		const int64 Samples = FMath::Min<int64>(TargetRank + FMath::Max(Oversampling, 0), MinSize);
+		if (Samples * 2 >= MinSize) {
+			// the projection would be about as large as the matrix, so the full decomposition is cheaper
+			EiVMatrixX<NumericType> U, V;
+			EiVVectorX<NumericType> S;
+			if (!FEiVSVD::Compute(InMatrix, true, true, U, S, V)) {
+				return false;
+			}
+			OutU = U.leftCols(TargetRank);
+			OutSingularValues = S.head(TargetRank);
+			OutV = V.leftCols(TargetRank);
+			return true;
+		}
+		// Y = A * Omega spans (approximately) the dominant column space of A
+		EiVMatrixX<NumericType> Omega(InMatrix.cols(), Samples);
+		FEiVRandom::FillNormal<NumericType>(FEiVRandom::MakeKey(FRandomStream(Seed)), 0, (NumericType)0, (NumericType)1, Omega.data(), Omega.size());
+		EiVMatrixX<NumericType> Q = FEiVSVD::Orthonormalize<NumericType>(InMatrix * Omega);
+		for (int32 Iteration = 0; Iteration < PowerIterations; Iteration++) {
+			// re-orthonormalizing after every product keeps the small singular directions from being lost to rounding
+			const EiVMatrixX<NumericType> W = FEiVSVD::Orthonormalize<NumericType>(InMatrix.transpose() * Q);
+			Q = FEiVSVD::Orthonormalize<NumericType>(InMatrix * W);
+		}
+		// A ~ Q * (Q^T * A), so the SVD of the small Samples x cols matrix B = Q^T * A gives the SVD of A
+		const EiVMatrixX<NumericType> B = Q.transpose() * InMatrix;
+		EiVMatrixX<NumericType> UB, V;
+		EiVVectorX<NumericType> S;
+		if (!FEiVSVD::Compute(B, true, true, UB, S, V)) {
+			return false;
+		}
+		OutU.noalias() = Q * UB.leftCols(TargetRank);
+		OutSingularValues = S.head(TargetRank);
+		OutV = V.leftCols(TargetRank);
+		return true;
+	}
+
+private:
+	template<typename SVDType, typename NumericType>
+	static bool Extract(const SVDType& SVD, bool bComputeUV, EiVMatrixX<NumericType>& OutU, EiVVectorX<NumericType>& OutSingularValues, EiVMatrixX<NumericType>& OutV)
+	{
+		if (SVD.info() != Eigen::Success) {
+			return false;
+		}
+		OutSingularValues = SVD.singularValues();
+		if (bComputeUV) {
+			OutU = SVD.matrixU();
+			OutV = SVD.matrixV();
+		}
+		else {
+			OutU.resize(0, 0);
+			OutV.resize(0, 0);
+		}
+		return true;
+	}
+	// the thin Q factor of a tall matrix, an orthonormal basis of its columns
+	template<typename NumericType>
+	static EiVMatrixX<NumericType> Orthonormalize(const EiVMatrixX<NumericType>& InMatrix)
+	{
+		const EiVHouseholderQR<EiVMatrixX<NumericType>> QR(InMatrix);
+		return QR.householderQ() * EiVMatrixX<NumericType>::Identity(InMatrix.rows(), InMatrix.cols());
+	}
+};
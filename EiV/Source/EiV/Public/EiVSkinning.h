@@ -0,0 +1,297 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+//<><><><><><><><><><><><> EiVLibrary Import Block <><><><><><><><><><><><>
+//imports the specified headers by the macro definitions
+
+#define EIV_INCLUDE_DENSE_MATRIX_ARRAY    //includes most core and basic features
+#define EIV_INCLUDE_GEOMETRY              //includes geometric utilities
+#define EIV_UNDEFINE_INCLUDES             //ensures that these include macros above are local to this file
+
+#include "EiVLibrary.h"   //takes the EIV_INCLUDE macros as settings and retrieves
+                          //the specified Eigen modules, typedefs, and helper functions
+//<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>
+
+/*
+* The vertex, normal and influence streams of a skinning call. Every stream is read through a stride, so structure of
+* arrays buffers (stride 1, one buffer per axis) and interleaved buffers such as FVector arrays (stride 3, the axis
+* pointers 1 number apart) both work without copies.
+* Influence k of vertex v is BoneIndices[v * VertexInfluenceStride + k * InfluenceStride] with the weight at the same
+* offset in Weights, so influence-major streams use (1, NumVertices) and vertex-major streams (InfluencesPerVertex, 1).
+* The weights of a vertex should sum to one. The normal streams are optional, leave them null to skip normals.
+* Outputs may alias the matching inputs if they use the same strides.
+*/
+template<typename NumericType>
+struct TEiVSkinningStreams
+{
+	int32 NumVertices = 0;
+	int32 InfluencesPerVertex = 0;
+
+	const int32* BoneIndices = nullptr;
+	const NumericType* Weights = nullptr;
+	int32 VertexInfluenceStride = 1;
+	int32 InfluenceStride = 0;
+
+	const NumericType* Positions[3] = { nullptr, nullptr, nullptr };
+	int32 PositionStride = 1;
+	const NumericType* Normals[3] = { nullptr, nullptr, nullptr };
+	int32 NormalStride = 1;
+
+	NumericType* OutPositions[3] = { nullptr, nullptr, nullptr };
+	int32 OutPositionStride = 1;
+	NumericType* OutNormals[3] = { nullptr, nullptr, nullptr };
+	int32 OutNormalStride = 1;
+};
+
+/*
+* CPU skinning with linear blend skinning (blending the bone matrices) and dual quaternion skinning (blending the bone
+* rigid transforms as dual quaternions, which keeps the volume at twisting joints but ignores bone scale).
+* The bones are converted once per frame into packed buffers, 12 numbers per bone for the column-major 3x4 matrices
+* [R * S | T] and 8 per bone for the dual quaternions (real x y z w, then dual x y z w).
+* The vertices are skinned in chunks of ChunkSize. The bones of a vertex are blended as small fixed size vectors, the
+* blends are stored in stack arrays with one row per coefficient and the positions and normals are transformed row by
+* row, vectorized across the vertices. Large meshes are split over the worker threads. Nothing is allocated while skinning.
+* For this whole struct the <NumericType> is the datatype of the numbers in the buffers.
+*/
+struct EIV_API FEiVSkinning
+{
+	// The number of vertices skinned together in stack arrays
+	static constexpr int32 ChunkSize = 256;
+	// The smallest number of vertices worth a worker thread
+	static constexpr int32 MinVerticesPerTask = 2048;
+
+	// This function converts Unreal Engine bone transforms into column-major 3x4 matrices for linear blend skinning
+	// @param Bones - NumBones bone transforms (component space times the inverse reference pose)
+	// @param NumBones - the number of bones
+	// @param OutMatrices - 12 * NumBones numbers, the matrix of bone b starts at 12 * b
+	template<typename NumericType = double>
+	static void BonesToMatrices(const FTransform* Bones, int32 NumBones, NumericType* OutMatrices)
+	{
+		for (int32 b = 0; b < NumBones; b++) {
+			const EiVMatrix3<double> Rotation = FEiVHelper::QuatToQuaternion<double>(Bones[b].GetRotation()).toRotationMatrix();
+			const EiVVector3<double> Scale = FEiVHelper::FVectorToVector<double>(Bones[b].GetScale3D());
+			EiVMap<EiVMatrix<NumericType, 3, 4>> Matrix(OutMatrices + 12 * (int64)b);
+			Matrix.template leftCols<3>() = (Rotation * Scale.asDiagonal()).template cast<NumericType>();
+			Matrix.col(3) = FEiVHelper::FVectorToVector<double>(Bones[b].GetTranslation()).template cast<NumericType>();
+		}
+	}
+	// This function converts Unreal Engine bone transforms into dual quaternions for dual quaternion skinning.
+	// The scale of the transforms is ignored.
+	// @param Bones - NumBones bone transforms (component space times the inverse reference pose)
+	// @param NumBones - the number of bones
+	// @param OutDualQuaternions - 8 * NumBones numbers, the dual quaternion of bone b starts at 8 * b
+	template<typename NumericType = double>
+	static void BonesToDualQuaternions(const FTransform* Bones, int32 NumBones, NumericType* OutDualQuaternions)
+	{
+		for (int32 b = 0; b < NumBones; b++) {
+			const EiVQuaternion<double> Rotation = FEiVHelper::QuatToQuaternion<double>(Bones[b].GetRotation()).normalized();
+			const EiVTranslation<double, 3> Translation(FEiVHelper::FVectorToVector<double>(Bones[b].GetTranslation()));
+			FEiVSkinning::MakeDualQuaternion<NumericType>(Rotation.template cast<NumericType>(), Translation.template cast<NumericType>(), OutDualQuaternions + 8 * (int64)b);
+		}
+	}
+	// This function writes the dual quaternion of a rigid transform, rotation first, then translation
+	// @param Rotation - the unit rotation quaternion
+	// @param Translation - the translation
+	// @param OutDualQuaternion - 8 numbers, real x y z w, then dual x y z w
+	template<typename NumericType = double>
+	static void MakeDualQuaternion(const EiVQuaternion<NumericType>& Rotation, const EiVTranslation<NumericType, 3>& Translation, NumericType* OutDualQuaternion)
+	{
+		// dual = (t / 2) * real, with t as a pure quaternion
+		const EiVQuaternion<NumericType> Pure((NumericType)0, Translation.x(), Translation.y(), Translation.z());
+		const EiVQuaternion<NumericType> Dual = Pure * Rotation;
+		EiVMap<EiVVector4<NumericType>> Real(OutDualQuaternion), DualPart(OutDualQuaternion + 4);
+		Real = Rotation.coeffs();
+		DualPart = (NumericType)0.5 * Dual.coeffs();
+	}
+	// This function skins vertices (and normals) with linear blend skinning.
+	// Normals are transformed by the blended 3x3 part and renormalized, which is exact for rotations and uniform scale.
+	// @param BoneMatrices - 12 * NumBones numbers from BonesToMatrices
+	// @param NumBones - the number of bones
+	// @param Streams - the vertex, influence and output streams
+	// @returns - false if a required stream is null or a bone index is out of range, nothing is written then
+	template<typename NumericType = double>
+	static bool SkinLinearBlend(const NumericType* BoneMatrices, int32 NumBones, const TEiVSkinningStreams<NumericType>& Streams)
+	{
+		if (!FEiVSkinning::Validate(BoneMatrices, NumBones, Streams)) {
+			return false;
+		}
+		FEiVHelper::ForEachChunk(Streams.NumVertices, ChunkSize, MinVerticesPerTask, [&](int32 First, int32 Num)
+		{
+			FEiVSkinning::SkinChunk<NumericType, 12, false>(BoneMatrices, Streams, First, Num);
+		});
+		return true;
+	}
+	// This function skins vertices (and normals) with dual quaternion skinning.
+	// The influences are blended in the hemisphere of the first influence of each vertex, so order the largest weight first.
+	// @param BoneDualQuaternions - 8 * NumBones numbers from BonesToDualQuaternions
+	// @param NumBones - the number of bones
+	// @param Streams - the vertex, influence and output streams
+	// @returns - false if a required stream is null or a bone index is out of range, nothing is written then
+	template<typename NumericType = double>
+	static bool SkinDualQuaternion(const NumericType* BoneDualQuaternions, int32 NumBones, const TEiVSkinningStreams<NumericType>& Streams)
+	{
+		if (!FEiVSkinning::Validate(BoneDualQuaternions, NumBones, Streams)) {
+			return false;
+		}
+		FEiVHelper::ForEachChunk(Streams.NumVertices, ChunkSize, MinVerticesPerTask, [&](int32 First, int32 Num)
+		{
+			FEiVSkinning::SkinChunk<NumericType, 8, true>(BoneDualQuaternions, Streams, First, Num);
+		});
+		return true;
+	}
+
+private:
+	template<typename NumericType, int Rows> using TRows = EiVArray<NumericType, Rows, EiVDynamic, Eigen::RowMajor, Rows, ChunkSize>;
+	template<typename NumericType> using TRow = TRows<NumericType, 1>;
+	template<typename NumericType> using TStridedRow = EiVMap<const EiVArray<NumericType, 1, EiVDynamic, Eigen::RowMajor>, 0, Eigen::InnerStride<>>;
+	template<typename NumericType> using TOutStridedRow = EiVMap<EiVArray<NumericType, 1, EiVDynamic, Eigen::RowMajor>, 0, Eigen::InnerStride<>>;
+
+	template<typename NumericType>
+	static bool Validate(const NumericType* Bones, int32 NumBones, const TEiVSkinningStreams<NumericType>& Streams)
+	{
+		if (Streams.NumVertices <= 0) {
+			return Streams.NumVertices == 0;
+		}
+		if (Bones == nullptr || NumBones <= 0 || Streams.InfluencesPerVertex <= 0 || Streams.BoneIndices == nullptr || Streams.Weights == nullptr) {
+			return false;
+		}
+		const bool bNormals = Streams.Normals[0] != nullptr;
+		for (int32 Axis = 0; Axis < 3; Axis++) {
+			if (Streams.Positions[Axis] == nullptr || Streams.OutPositions[Axis] == nullptr) {
+				return false;
+			}
+			if (bNormals && (Streams.Normals[Axis] == nullptr || Streams.OutNormals[Axis] == nullptr)) {
+				return false;
+			}
+		}
+		for (int32 v = 0; v < Streams.NumVertices; v++) {
+			for (int32 k = 0; k < Streams.InfluencesPerVertex; k++) {
+				const int32 Bone = Streams.BoneIndices[(int64)v * Streams.VertexInfluenceStride + (int64)k * Streams.InfluenceStride];
+				if (Bone < 0 || Bone >= NumBones) {
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	// r x v for rows (x, y, z) of r and v
+	template<typename NumericType>
+	static void Cross(const TRows<NumericType, 3>& R, const TRows<NumericType, 3>& V, TRows<NumericType, 3>& Out)
+	{
+		Out.row(0) = R.row(1) * V.row(2) - R.row(2) * V.row(1);
+		Out.row(1) = R.row(2) * V.row(0) - R.row(0) * V.row(2);
+		Out.row(2) = R.row(0) * V.row(1) - R.row(1) * V.row(0);
+	}
+	// v + 2 r x (r x v + w v), the rotation of v by the unit quaternion (r, w)
+	template<typename NumericType>
+	static void Rotate(const TRows<NumericType, 3>& R, const TRow<NumericType>& W, const TRows<NumericType, 3>& V, TRows<NumericType, 3>& Out)
+	{
+		TRows<NumericType, 3> Inner(3, V.cols()), Outer(3, V.cols());
+		FEiVSkinning::Cross(R, V, Inner);
+		for (int32 Axis = 0; Axis < 3; Axis++) {
+			Inner.row(Axis) += W * V.row(Axis);
+		}
+		FEiVSkinning::Cross(R, Inner, Outer);
+		Out = V + (NumericType)2 * Outer;
+	}
+
+	template<typename NumericType>
+	static void Gather(const NumericType* const* Streams, int32 Stride, int32 First, int32 Num, TRows<NumericType, 3>& Out)
+	{
+		Out.resize(3, Num);
+		for (int32 Axis = 0; Axis < 3; Axis++) {
+			Out.row(Axis) = TStridedRow<NumericType>(Streams[Axis] + (int64)First * Stride, Num, Eigen::InnerStride<>(Stride));
+		}
+	}
+	template<typename NumericType>
+	static void Scatter(const TRows<NumericType, 3>& In, NumericType* const* Streams, int32 Stride, int32 First)
+	{
+		for (int32 Axis = 0; Axis < 3; Axis++) {
+			TOutStridedRow<NumericType>(Streams[Axis] + (int64)First * Stride, In.cols(), Eigen::InnerStride<>(Stride)) = In.row(Axis);
+		}
+	}
+
+	template<typename NumericType, int BoneSize, bool bDualQuaternion>
+	static void SkinChunk(const NumericType* Bones, const TEiVSkinningStreams<NumericType>& Streams, int32 First, int32 Num)
+	{
+		// blend the bones of each vertex with the coefficients of a bone as one small vector, then store the blend as one
+		// row per coefficient for the transforms
+		typedef EiVVector<NumericType, BoneSize> BoneVector;
+		TRows<NumericType, BoneSize> Blend(BoneSize, Num);
+		for (int32 i = 0; i < Num; i++) {
+			const int64 Offset = (int64)(First + i) * Streams.VertexInfluenceStride;
+			const EiVMap<const BoneVector> Pivot(Bones + (int64)BoneSize * Streams.BoneIndices[Offset]);
+			BoneVector Sum = Streams.Weights[Offset] * Pivot;
+			for (int32 k = 1; k < Streams.InfluencesPerVertex; k++) {
+				const int64 InfluenceOffset = Offset + (int64)k * Streams.InfluenceStride;
+				const EiVMap<const BoneVector> Bone(Bones + (int64)BoneSize * Streams.BoneIndices[InfluenceOffset]);
+				NumericType Weight = Streams.Weights[InfluenceOffset];
+				if (bDualQuaternion) {
+					// q and -q are the same rotation, flip the bones into the hemisphere of the first influence
+					Weight = Pivot.template head<4>().dot(Bone.template head<4>()) < (NumericType)0 ? -Weight : Weight;
+				}
+				Sum += Weight * Bone;
+			}
+			Blend.col(i) = Sum.array();
+		}
+
+		TRows<NumericType, 3> Position, Normal, Result;
+		FEiVSkinning::Gather(Streams.Positions, Streams.PositionStride, First, Num, Position);
+		const bool bNormals = Streams.Normals[0] != nullptr;
+		if (bNormals) {
+			FEiVSkinning::Gather(Streams.Normals, Streams.NormalStride, First, Num, Normal);
+		}
+		Result.resize(3, Num);
+		if (bDualQuaternion) {
+			// normalize by the length of the real part, vertices without weight keep their position
+			const TRow<NumericType> Norm2 = Blend.row(0).square() + Blend.row(1).square() + Blend.row(2).square() + Blend.row(3).square();
+			const TRow<NumericType> InverseNorm = Norm2.max(std::numeric_limits<NumericType>::min()).rsqrt();
+			for (int32 c = 0; c < 8; c++) {
+				Blend.row(c) *= InverseNorm;
+			}
+			const TRows<NumericType, 3> Real = Blend.template topRows<3>();
+			const TRow<NumericType> RealW = Blend.row(3);
+			const TRows<NumericType, 3> Dual = Blend.template middleRows<3>(4);
+			const TRow<NumericType> DualW = Blend.row(7);
+			// translation = 2 (w_real * dual - w_dual * real + real x dual)
+			TRows<NumericType, 3> Translation(3, Num);
+			FEiVSkinning::Cross(Real, Dual, Translation);
+			for (int32 Axis = 0; Axis < 3; Axis++) {
+				Translation.row(Axis) = (NumericType)2 * (Translation.row(Axis) + RealW * Dual.row(Axis) - DualW * Real.row(Axis));
+			}
+			FEiVSkinning::Rotate(Real, RealW, Position, Result);
+			Result += Translation;
+			FEiVSkinning::Scatter(Result, Streams.OutPositions, Streams.OutPositionStride, First);
+			if (bNormals) {
+				FEiVSkinning::Rotate(Real, RealW, Normal, Result);
+				FEiVSkinning::Scatter(Result, Streams.OutNormals, Streams.OutNormalStride, First);
+			}
+		}
+		else {
+			// column-major 3x4, coefficient (r, c) is row c * 3 + r of the blend
+			for (int32 r = 0; r < 3; r++) {
+				Result.row(r) = Blend.row(r) * Position.row(0) + Blend.row(3 + r) * Position.row(1) + Blend.row(6 + r) * Position.row(2) + Blend.row(9 + r);
+			}
+			FEiVSkinning::Scatter(Result, Streams.OutPositions, Streams.OutPositionStride, First);
+			if (bNormals) {
+				for (int32 r = 0; r < 3; r++) {
+					Result.row(r) = Blend.row(r) * Normal.row(0) + Blend.row(3 + r) * Normal.row(1) + Blend.row(6 + r) * Normal.row(2);
+				}
+				const TRow<NumericType> Length2 = Result.row(0).square() + Result.row(1).square() + Result.row(2).square();
+				const TRow<NumericType> InverseLength = Length2.max(std::numeric_limits<NumericType>::min()).rsqrt();
+				for (int32 r = 0; r < 3; r++) {
+					Result.row(r) *= InverseLength;
+				}
+				FEiVSkinning::Scatter(Result, Streams.OutNormals, Streams.OutNormalStride, First);
+			}
+		}
+	}
+};
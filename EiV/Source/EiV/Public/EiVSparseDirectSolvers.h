@@ -0,0 +1,223 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+//<><><><><><><><><><><><> EiVLibrary Import Block <><><><><><><><><><><><>
+//imports the specified headers by the macro definitions
+
+#define EIV_INCLUDE_DENSE_MATRIX_ARRAY    //includes most core and basic features
+#define EIV_INCLUDE_SPARSE_LINEAR_ALGEBRA //includes sparse linear algebra utilities
+#define EIV_UNDEFINE_INCLUDES             //ensures that these include macros above are local to this file
+
+#include "EiVLibrary.h"   //takes the EIV_INCLUDE macros as settings and retrieves
+                          //the specified Eigen modules, typedefs, and helper functions
+//<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>
+#include "EiVSparseKernels.h"
+
+/*
+* Sparse direct solvers with a cached symbolic analysis. Computing a sparse factorization has two steps, the fill
+* reducing ordering and symbolic analysis (analyzePattern), which only depends on where the nonzeros are, and the
+* numerical factorization (factorize). Systems with a fixed topology, such as cloth or mesh deformation, only change
+* their values from frame to frame, so the solvers here hash the sparsity pattern of every new matrix and only rerun
+* the analysis when that hash changes.
+* These objects are not thread safe, use one solver per thread.
+*/
+
+// The fill-in and work statistics of a sparse direct solver
+struct FEiVSparseDirectSolverStats
+{
+	// The number of nonzeros of the factorized matrix (only the used triangle for the symmetric solvers)
+	int64 MatrixNonZeros = 0;
+	// The number of nonzeros of the factors (L and D for LDLT, L for LLT, L and U for LU)
+	int64 FactorNonZeros = 0;
+	// FactorNonZeros / MatrixNonZeros, 1 means the ordering avoided all fill-in
+	double FillRatio = 0.0;
+	// The number of times the ordering and symbolic analysis ran
+	int32 AnalyzeCount = 0;
+	// The number of numerical factorizations
+	int32 FactorizeCount = 0;
+	// If the last matrix needed a new symbolic analysis
+	bool bLastMatrixAnalyzed = false;
+};
+
+// The type erased interface of a sparse direct solver, so that solvers of different types can be stored together
+template<typename NumericType = double>
+class IEiVSparseDirectSolver
+{
+public:
+	virtual ~IEiVSparseDirectSolver() {}
+	// This function factorizes a new matrix. The symbolic analysis is only redone if the sparsity pattern changed.
+	// @param InMatrix - the system matrix A of AX = B
+	// @param bForceAnalyze - if true the symbolic analysis is redone even if the sparsity pattern did not change
+	// @returns - false if the factorization failed, for example because the matrix is singular
+	virtual bool SetMatrix(const EiVSparseMatrix<NumericType>& InMatrix, bool bForceAnalyze = false) = 0;
+	// This function solves AX = B with the current factorization
+	// @param InB - the right hand side, its rows must match the rows of the system matrix
+	// @param OutX - the solution
+	// @returns - false if there is no valid factorization or the sizes do not match
+	virtual bool Solve(const EiVMatrixX<NumericType>& InB, EiVMatrixX<NumericType>& OutX) const = 0;
+	// This function forgets the cached analysis, so the next matrix is always analyzed
+	virtual void Reset() = 0;
+	// @returns - true if the last matrix was factorized successfully
+	virtual bool IsFactorized() const = 0;
+	// @returns - the fill-in and work statistics of this solver
+	virtual const FEiVSparseDirectSolverStats& GetStats() const = 0;
+};
+
+/*
+* A sparse direct solver wrapping an Eigen sparse solver over a column-major sparse matrix, caching its symbolic
+* analysis per sparsity pattern, for example TEiVSparseDirectSolver<EiVSparseLU<EiVSparseMatrix<double>>>
+*/
+template<typename SolverType>
+class TEiVSparseDirectSolver : public IEiVSparseDirectSolver<typename SolverType::Scalar>
+{
+public:
+	typedef typename SolverType::Scalar NumericType;
+	typedef typename EiVSparseMatrix<NumericType>::StorageIndex StorageIndex;
+
+	TEiVSparseDirectSolver() {}
+	TEiVSparseDirectSolver(const TEiVSparseDirectSolver&) = delete;
+	TEiVSparseDirectSolver& operator=(const TEiVSparseDirectSolver&) = delete;
+
+	virtual bool SetMatrix(const EiVSparseMatrix<NumericType>& InMatrix, bool bForceAnalyze = false) override
+	{
+		if (!InMatrix.isCompressed()) {
+			// the column orderings need a compressed matrix
+			EiVSparseMatrix<NumericType> Compressed = InMatrix;
+			Compressed.makeCompressed();
+			return SetMatrix(Compressed, bForceAnalyze);
+		}
+		const uint64 NewPatternHash = FEiVSparseKernels::HashSparsityPattern(InMatrix);
+		// the hash only rules out changes, a match is confirmed against the stored pattern so a collision reanalyzes
+		Stats.bLastMatrixAnalyzed = bForceAnalyze || !bAnalyzed || NewPatternHash != PatternHash
+			|| !FEiVSparseKernels::MatchesSparsityPattern(InMatrix, PatternRows, PatternCols, PatternOuter.GetData(), PatternInner.GetData());
+		if (Stats.bLastMatrixAnalyzed) {
+			Solver.analyzePattern(InMatrix);
+			PatternHash = NewPatternHash;
+			PatternRows = InMatrix.rows();
+			PatternCols = InMatrix.cols();
+			PatternOuter = TArray<StorageIndex>(InMatrix.outerIndexPtr(), (int32)InMatrix.outerSize() + 1);
+			PatternInner = TArray<StorageIndex>(InMatrix.innerIndexPtr(), (int32)InMatrix.nonZeros());
+			bAnalyzed = true;
+			Stats.AnalyzeCount++;
+			Stats.MatrixNonZeros = CountMatrixNonZeros(Solver, InMatrix);
+		}
+		Solver.factorize(InMatrix);
+		Stats.FactorizeCount++;
+		bFactorized = Solver.info() == Eigen::Success;
+		if (bFactorized) {
+			Stats.FactorNonZeros = CountFactorNonZeros(Solver);
+			Stats.FillRatio = Stats.MatrixNonZeros > 0 ? (double)Stats.FactorNonZeros / (double)Stats.MatrixNonZeros : 0.0;
+		}
+		return bFactorized;
+	}
+
+	virtual bool Solve(const EiVMatrixX<NumericType>& InB, EiVMatrixX<NumericType>& OutX) const override
+	{
+		if (!bFactorized || InB.rows() != Solver.rows()) {
+			return false;
+		}
+		OutX = Solver.solve(InB);
+		return Solver.info() == Eigen::Success;
+	}
+
+	virtual void Reset() override
+	{
+		PatternHash = 0;
+		PatternRows = 0;
+		PatternCols = 0;
+		PatternOuter.Empty();
+		PatternInner.Empty();
+		bAnalyzed = false;
+		bFactorized = false;
+		Stats = FEiVSparseDirectSolverStats();
+	}
+
+	virtual bool IsFactorized() const override
+	{
+		return bFactorized;
+	}
+
+	virtual const FEiVSparseDirectSolverStats& GetStats() const override
+	{
+		return Stats;
+	}
+
+	// @returns - the wrapped Eigen solver
+	const SolverType& GetSolver() const
+	{
+		return Solver;
+	}
+
+private:
+	// the symmetric solvers only read one triangle of the matrix
+	template<typename MatrixType, int UpLo, typename Ordering>
+	static int64 CountMatrixNonZeros(const EiVSimplicialLDLT<MatrixType, UpLo, Ordering>&, const EiVSparseMatrix<NumericType>& InMatrix)
+	{
+		return CountTriangleNonZeros(InMatrix, UpLo);
+	}
+	template<typename MatrixType, int UpLo, typename Ordering>
+	static int64 CountMatrixNonZeros(const EiVSimplicialLLT<MatrixType, UpLo, Ordering>&, const EiVSparseMatrix<NumericType>& InMatrix)
+	{
+		return CountTriangleNonZeros(InMatrix, UpLo);
+	}
+	template<typename OtherSolverType>
+	static int64 CountMatrixNonZeros(const OtherSolverType&, const EiVSparseMatrix<NumericType>& InMatrix)
+	{
+		return InMatrix.nonZeros();
+	}
+	static int64 CountTriangleNonZeros(const EiVSparseMatrix<NumericType>& InMatrix, int UpLo)
+	{
+		int64 Count = 0;
+		for (int64 Col = 0; Col < InMatrix.outerSize(); Col++) {
+			for (typename EiVSparseMatrix<NumericType>::InnerIterator It(InMatrix, Col); It; ++It) {
+				Count += (UpLo & Eigen::Lower) ? It.row() >= It.col() : It.row() <= It.col();
+			}
+		}
+		return Count;
+	}
+
+	// the LDLT factor stores the unit diagonal of L implicitly and D separately
+	template<typename MatrixType, int UpLo, typename Ordering>
+	static int64 CountFactorNonZeros(const EiVSimplicialLDLT<MatrixType, UpLo, Ordering>& InSolver)
+	{
+		return InSolver.matrixL().nestedExpression().nonZeros() + InSolver.rows();
+	}
+	template<typename MatrixType, int UpLo, typename Ordering>
+	static int64 CountFactorNonZeros(const EiVSimplicialLLT<MatrixType, UpLo, Ordering>& InSolver)
+	{
+		return InSolver.matrixL().nestedExpression().nonZeros();
+	}
+	template<typename MatrixType, typename Ordering>
+	static int64 CountFactorNonZeros(const EiVSparseLU<MatrixType, Ordering>& InSolver)
+	{
+		return InSolver.nnzL() + InSolver.nnzU();
+	}
+
+	SolverType Solver;
+	FEiVSparseDirectSolverStats Stats;
+	uint64 PatternHash = 0;
+	// the compressed pattern of the last analyzed matrix
+	int64 PatternRows = 0;
+	int64 PatternCols = 0;
+	TArray<StorageIndex> PatternOuter;
+	TArray<StorageIndex> PatternInner;
+	bool bAnalyzed = false;
+	bool bFactorized = false;
+};
+
+// Sparse LDLT (symmetric, positive or negative semi-definite) with a cached analysis. Only the lower triangle is used.
+template<typename NumericType = double, typename Ordering = EiVAMDOrdering<int>>
+using TEiVCachedSimplicialLDLT = TEiVSparseDirectSolver<EiVSimplicialLDLT<EiVSparseMatrix<NumericType>, Eigen::Lower, Ordering>>;
+// Sparse Cholesky LLT (symmetric positive definite) with a cached analysis. Only the lower triangle is used.
+template<typename NumericType = double, typename Ordering = EiVAMDOrdering<int>>
+using TEiVCachedSimplicialLLT = TEiVSparseDirectSolver<EiVSimplicialLLT<EiVSparseMatrix<NumericType>, Eigen::Lower, Ordering>>;
+// Sparse LU (general square matrices) with a cached analysis
+template<typename NumericType = double, typename Ordering = EiVCOLAMDOrdering<int>>
+using TEiVCachedSparseLU = TEiVSparseDirectSolver<EiVSparseLU<EiVSparseMatrix<NumericType>, Ordering>>;
@@ -0,0 +1,263 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+//<><><><><><><><><><><><> EiVLibrary Import Block <><><><><><><><><><><><>
+//imports the specified headers by the macro definitions
+
+#define EIV_INCLUDE_DENSE_MATRIX_ARRAY    //includes most core and basic features
+#define EIV_INCLUDE_SPARSECORE            //includes sparse matrix storage and products
+#define EIV_UNDEFINE_INCLUDES             //ensures that these include macros above are local to this file
+
+#include "EiVLibrary.h"   //takes the EIV_INCLUDE macros as settings and retrieves
+                          //the specified Eigen modules, typedefs, and helper functions
+//<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>
+#include "Async/ParallelFor.h"
+#include "Hash/CityHash.h"
+#include <algorithm>
+
+/*
+* Parallel sparse matrix kernels. Eigen only multi-threads its sparse products through OpenMP, which Unreal Engine
+* builds do not enable, so these kernels split the rows of a row-major (CSR) sparse matrix into chunks of roughly
+* equal work and run the chunks on the Unreal Engine worker threads. Each chunk writes a disjoint set of output rows,
+* so the results are identical to the single threaded Eigen products.
+* For this whole struct the <NumericType> is the datatype of the numbers stored in the Eigen types.
+*/
+struct EIV_API FEiVSparseKernels
+{
+	// The smallest number of nonzeros (or multiply-adds for sparse-sparse products) worth a worker thread
+	static constexpr int64 MinWorkPerChunk = 16384;
+
+	// This function converts a column-major sparse matrix into a compressed row-major (CSR) sparse matrix
+	// @param InMatrix - the column-major sparse matrix to convert
+	// @returns - the row-major version of this matrix
+	template<typename NumericType = double>
+	static EiVRowMajorSparseMatrix<NumericType> ToRowMajor(const EiVSparseMatrix<NumericType>& InMatrix)
+	{
+		EiVRowMajorSparseMatrix<NumericType> Mtx = InMatrix;
+		Mtx.makeCompressed();
+		return Mtx;
+	}
+	// This function converts a row-major (CSR) sparse matrix into a compressed column-major sparse matrix
+	// @param InMatrix - the row-major sparse matrix to convert
+	// @returns - the column-major version of this matrix
+	template<typename NumericType = double>
+	static EiVSparseMatrix<NumericType> ToColumnMajor(const EiVRowMajorSparseMatrix<NumericType>& InMatrix)
+	{
+		EiVSparseMatrix<NumericType> Mtx = InMatrix;
+		Mtx.makeCompressed();
+		return Mtx;
+	}
+	// This function hashes the sparsity pattern (size and positions of the stored elements, not their values) of a
+	// sparse matrix. Solvers use it to find out if a new matrix can reuse work that only depends on the pattern.
+	// @param InMatrix - the sparse matrix to hash, it may be compressed or uncompressed
+	// @returns - the hash of the sparsity pattern
+	template<typename SparseMatrixType>
+	static uint64 HashSparsityPattern(const SparseMatrixType& InMatrix)
+	{
+		typedef typename SparseMatrixType::StorageIndex StorageIndex;
+		const int64 Sizes[3] = { (int64)InMatrix.rows(), (int64)InMatrix.cols(), (int64)SparseMatrixType::IsRowMajor };
+		uint64 Hash = CityHash64((const char*)Sizes, sizeof(Sizes));
+		const StorageIndex* Outer = InMatrix.outerIndexPtr();
+		const StorageIndex* Inner = InMatrix.innerIndexPtr();
+		const StorageIndex* InnerNonZeros = InMatrix.innerNonZeroPtr();
+		for (int64 Outer0 = 0; Outer0 < InMatrix.outerSize(); Outer0++) {
+			const int64 Count = InnerNonZeros ? (int64)InnerNonZeros[Outer0] : (int64)(Outer[Outer0 + 1] - Outer[Outer0]);
+			const StorageIndex* Segment = Inner + Outer[Outer0];
+			Hash = CityHash64WithSeed((const char*)&Count, sizeof(Count), Hash);
+			// hash in blocks so that very long columns never overflow the 32 bit length
+			for (int64 First = 0; First < Count; First += (1 << 20)) {
+				const int64 BlockCount = FMath::Min<int64>(Count - First, 1 << 20);
+				Hash = CityHash64WithSeed((const char*)(Segment + First), (uint32)(BlockCount * sizeof(StorageIndex)), Hash);
+			}
+		}
+		return Hash;
+	}
+	// This function checks if a sparse matrix has exactly the given compressed sparsity pattern, so the values of a
+	// matrix with a matching hash can be trusted to fit the stored pattern
+	// @param InMatrix - the sparse matrix to check, it may be compressed or uncompressed
+	// @param Rows - the rows of the stored pattern
+	// @param Cols - the columns of the stored pattern
+	// @param Outer - the outer index of the stored pattern (outer size + 1 entries)
+	// @param Inner - the inner indices of the stored pattern
+	// @returns - true if the sizes, the number of elements of every outer segment and their inner indices all match
+	template<typename SparseMatrixType>
+	static bool MatchesSparsityPattern(const SparseMatrixType& InMatrix, int64 Rows, int64 Cols, const typename SparseMatrixType::StorageIndex* Outer, const typename SparseMatrixType::StorageIndex* Inner)
+	{
+		typedef typename SparseMatrixType::StorageIndex StorageIndex;
+		if ((int64)InMatrix.rows() != Rows || (int64)InMatrix.cols() != Cols) {
+			return false;
+		}
+		const StorageIndex* InOuter = InMatrix.outerIndexPtr();
+		const StorageIndex* InInner = InMatrix.innerIndexPtr();
+		const StorageIndex* InInnerNonZeros = InMatrix.innerNonZeroPtr();
+		for (int64 Outer0 = 0; Outer0 < InMatrix.outerSize(); Outer0++) {
+			const int64 Count = InInnerNonZeros ? (int64)InInnerNonZeros[Outer0] : (int64)(InOuter[Outer0 + 1] - InOuter[Outer0]);
+			if (Count != (int64)(Outer[Outer0 + 1] - Outer[Outer0])
+				|| (Count > 0 && FMemory::Memcmp(InInner + InOuter[Outer0], Inner + Outer[Outer0], Count * sizeof(StorageIndex)) != 0)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	// This function splits a range of rows into chunks holding roughly the same amount of work
+	// @param InPrefixWork - the running total of work at the start of every row (Rows + 1 entries, like a CSR outer index)
+	// @param Rows - the number of rows to split
+	// @param NumChunks - the number of chunks to split the rows into
+	// @param OutRowBounds - the first row of every chunk followed by the row count (NumChunks + 1 entries)
+	template<typename IndexType>
+	static void PartitionRows(const IndexType* InPrefixWork, const int32 Rows, const int32 NumChunks, TArray<int32>& OutRowBounds)
+	{
+		OutRowBounds.SetNumUninitialized(NumChunks + 1);
+		OutRowBounds[0] = 0;
+		const int64 TotalWork = (int64)InPrefixWork[Rows] - (int64)InPrefixWork[0];
+		for (int32 Chunk = 1; Chunk < NumChunks; Chunk++) {
+			const int64 Target = (int64)InPrefixWork[0] + (TotalWork * Chunk) / NumChunks;
+			const IndexType* Bound = std::lower_bound(InPrefixWork, InPrefixWork + Rows + 1, (IndexType)Target);
+			OutRowBounds[Chunk] = FMath::Max(OutRowBounds[Chunk - 1], (int32)FMath::Min<int64>(Bound - InPrefixWork, Rows));
+		}
+		OutRowBounds[NumChunks] = Rows;
+	}
+	// This function multiplies a row-major sparse matrix with a dense matrix (SpMM) using the worker threads.
+	// The rows of the sparse matrix are split into chunks with roughly the same number of nonzeros.
+	// @param InSparse - the compressed row-major sparse matrix (left hand side)
+	// @param InDense - the dense matrix (right hand side), its rows must match the columns of InSparse
+	// @param OutDense - the product, resized to the rows of InSparse by the columns of InDense
+	// @returns - false if the sizes of the matrices do not match
+	template<typename NumericType = double>
+	static bool ParallelSparseDenseProduct(const EiVRowMajorSparseMatrix<NumericType>& InSparse, const EiVMatrixX<NumericType>& InDense, EiVMatrixX<NumericType>& OutDense)
+	{
+		if (InSparse.cols() != InDense.rows() || !InSparse.isCompressed()) {
+			return false;
+		}
+		const int32 Rows = InSparse.rows();
+		OutDense.resize(Rows, InDense.cols());
+		const int32 NumChunks = FEiVHelper::GetParallelChunkCount((int64)InSparse.nonZeros() * FMath::Max<int64>(InDense.cols(), 1), MinWorkPerChunk);
+		if (NumChunks == 1) {
+			OutDense.noalias() = InSparse * InDense;
+			return true;
+		}
+		TArray<int32> RowBounds;
+		FEiVSparseKernels::PartitionRows(InSparse.outerIndexPtr(), Rows, NumChunks, RowBounds);
+		ParallelFor(NumChunks, [&](int32 Chunk)
+		{
+			const int32 First = RowBounds[Chunk];
+			const int32 Count = RowBounds[Chunk + 1] - First;
+			if (Count > 0) {
+				OutDense.middleRows(First, Count).noalias() = InSparse.middleRows(First, Count) * InDense;
+			}
+		});
+		return true;
+	}
+	// This function multiplies a row-major sparse matrix with a dense vector (SpMV) using the worker threads
+	// @param InSparse - the compressed row-major sparse matrix (left hand side)
+	// @param InVector - the dense vector (right hand side), its size must match the columns of InSparse
+	// @param OutVector - the product, resized to the rows of InSparse
+	// @returns - false if the sizes of the matrix and vector do not match
+	template<typename NumericType = double>
+	static bool ParallelSparseVectorProduct(const EiVRowMajorSparseMatrix<NumericType>& InSparse, const EiVVectorX<NumericType>& InVector, EiVVectorX<NumericType>& OutVector)
+	{
+		if (InSparse.cols() != InVector.rows() || !InSparse.isCompressed()) {
+			return false;
+		}
+		const int32 Rows = InSparse.rows();
+		OutVector.resize(Rows);
+		const int32 NumChunks = FEiVHelper::GetParallelChunkCount(InSparse.nonZeros(), MinWorkPerChunk);
+		if (NumChunks == 1) {
+			OutVector.noalias() = InSparse * InVector;
+			return true;
+		}
+		TArray<int32> RowBounds;
+		FEiVSparseKernels::PartitionRows(InSparse.outerIndexPtr(), Rows, NumChunks, RowBounds);
+		ParallelFor(NumChunks, [&](int32 Chunk)
+		{
+			const int32 First = RowBounds[Chunk];
+			const int32 Count = RowBounds[Chunk + 1] - First;
+			if (Count > 0) {
+				OutVector.segment(First, Count).noalias() = InSparse.middleRows(First, Count) * InVector;
+			}
+		});
+		return true;
+	}
+	// This function multiplies two row-major sparse matrices (SpGEMM) using the worker threads. The rows of the
+	// left hand side are split by their number of multiply-adds, each chunk is multiplied by Eigen on its own and
+	// the chunks are then stitched together into one compressed row-major matrix.
+	// @param InA - the compressed row-major sparse matrix on the left hand side
+	// @param InB - the compressed row-major sparse matrix on the right hand side, its rows must match the columns of InA
+	// @param OutProduct - the compressed row-major product of the two matrices
+	// @returns - false if the sizes of the matrices do not match
+	template<typename NumericType = double>
+	static bool ParallelSparseSparseProduct(const EiVRowMajorSparseMatrix<NumericType>& InA, const EiVRowMajorSparseMatrix<NumericType>& InB, EiVRowMajorSparseMatrix<NumericType>& OutProduct)
+	{
+		typedef typename EiVRowMajorSparseMatrix<NumericType>::StorageIndex StorageIndex;
+		if (InA.cols() != InB.rows() || !InA.isCompressed() || !InB.isCompressed()) {
+			return false;
+		}
+		const int32 Rows = InA.rows();
+		// the work of a row is the number of multiply-adds it needs: the nonzeros of every row of B it touches
+		TArray<int64> PrefixWork;
+		PrefixWork.SetNumUninitialized(Rows + 1);
+		PrefixWork[0] = 0;
+		const StorageIndex* AOuter = InA.outerIndexPtr();
+		const StorageIndex* AInner = InA.innerIndexPtr();
+		const StorageIndex* BOuter = InB.outerIndexPtr();
+		for (int32 Row = 0; Row < Rows; Row++) {
+			int64 Work = 1;
+			for (StorageIndex k = AOuter[Row]; k < AOuter[Row + 1]; k++) {
+				Work += BOuter[AInner[k] + 1] - BOuter[AInner[k]];
+			}
+			PrefixWork[Row + 1] = PrefixWork[Row] + Work;
+		}
+		const int32 NumChunks = FEiVHelper::GetParallelChunkCount(PrefixWork[Rows], MinWorkPerChunk);
+		if (NumChunks == 1) {
+			OutProduct = InA * InB;
+			OutProduct.makeCompressed();
+			return true;
+		}
+		TArray<int32> RowBounds;
+		FEiVSparseKernels::PartitionRows(PrefixWork.GetData(), Rows, NumChunks, RowBounds);
+		TArray<EiVRowMajorSparseMatrix<NumericType>> Parts;
+		Parts.SetNum(NumChunks);
+		ParallelFor(NumChunks, [&](int32 Chunk)
+		{
+			const int32 First = RowBounds[Chunk];
+			const int32 Count = RowBounds[Chunk + 1] - First;
+			if (Count > 0) {
+				Parts[Chunk] = InA.middleRows(First, Count) * InB;
+				Parts[Chunk].makeCompressed();
+			}
+		});
+		// stitch the chunks together, every chunk owns a contiguous range of rows and nonzeros
+		TArray<int64> Offsets;
+		Offsets.SetNumUninitialized(NumChunks + 1);
+		Offsets[0] = 0;
+		for (int32 Chunk = 0; Chunk < NumChunks; Chunk++) {
+			Offsets[Chunk + 1] = Offsets[Chunk] + Parts[Chunk].nonZeros();
+		}
+		OutProduct.resize(Rows, InB.cols());
+		OutProduct.resizeNonZeros(Offsets[NumChunks]);
+		StorageIndex* OutOuter = OutProduct.outerIndexPtr();
+		ParallelFor(NumChunks, [&](int32 Chunk)
+		{
+			const EiVRowMajorSparseMatrix<NumericType>& Part = Parts[Chunk];
+			const int32 First = RowBounds[Chunk];
+			const int32 Count = RowBounds[Chunk + 1] - First;
+			const int64 Offset = Offsets[Chunk];
+			for (int32 Row = 0; Row < Count; Row++) {
+				OutOuter[First + Row] = (StorageIndex)(Part.outerIndexPtr()[Row] + Offset);
+			}
+			if (Part.nonZeros() > 0) {
+				FMemory::Memcpy(OutProduct.innerIndexPtr() + Offset, Part.innerIndexPtr(), Part.nonZeros() * sizeof(StorageIndex));
+				FMemory::Memcpy(OutProduct.valuePtr() + Offset, Part.valuePtr(), Part.nonZeros() * sizeof(NumericType));
+			}
+		});
+		OutOuter[Rows] = (StorageIndex)Offsets[NumChunks];
+		return true;
+	}
+};
@@ -0,0 +1,29 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+using UnrealBuildTool;
+
+public class EiVDeterministic : ModuleRules
+{
+	public EiVDeterministic(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		// every product and sum must be rounded on its own and in the written order, so this module is compiled on its
+		// own: no unity files that could pull in code built before these settings, and precise floating point semantics
+		// (-ffp-contract=off, /fp:precise) so the compiler may neither fuse them into FMAs nor reassociate them
+		bUseUnity = false;
+		FPSemantics = FPSemanticsMode.Precise;
+
+		// only Core and Eigen, so EiV can depend on this module without a cycle
+		PublicDependencyModuleNames.AddRange(new string[] { "Core", "Eigen" });
+
+		AddEngineThirdPartyPrivateStaticDependencies(Target, "Eigen");
+		PublicDefinitions.Add("EIGEN_IGNORE_UNREACHABLE_CODE_WARNING=1");
+	}
+}
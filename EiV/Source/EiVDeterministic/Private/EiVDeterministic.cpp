@@ -0,0 +1,197 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#include "EiVDeterministic.h"
+#include "Async/ParallelFor.h"
+#include <atomic>
+
+namespace EiVDeterministicPrivate
+{
+	static std::atomic<bool> bGlobalEnabled(false);
+
+	// the leaves handled by one task, the split over tasks does not change the result
+	static constexpr int64 MinLeavesPerTask = 4;
+	// the rows of one tile of a matrix product and the columns updated together, so a tile of A is read once for
+	// ColumnBlock columns of the product while it is in the L1 cache
+	static constexpr int64 RowTile = 512;
+	static constexpr int64 ColumnBlock = 4;
+
+	template<typename NumericType>
+	using TLanes = Eigen::Array<NumericType, FEiVDeterministic::Lanes, 1>;
+
+	// the number of tasks for WorkItems items, at most 4 per core and never less than MinItemsPerTask items each
+	static int32 GetTaskCount(int64 WorkItems, int64 MinItemsPerTask)
+	{
+		const int64 MaxTasks = (int64)FMath::Max(FPlatformMisc::NumberOfCoresIncludingHyperthreads(), 1) * 4;
+		return (int32)FMath::Clamp<int64>(WorkItems / FMath::Max<int64>(MinItemsPerTask, 1), 1, MaxTasks);
+	}
+
+	// runs Kernel(First, Last) on NumTasks ranges of about the same size covering 0 to Count - 1
+	template<typename KernelType>
+	static void ForEachRange(int64 Count, int32 NumTasks, const KernelType& Kernel)
+	{
+		ParallelFor(NumTasks, [&](int32 Task)
+		{
+			Kernel(Count * Task / NumTasks, Count * (Task + 1) / NumTasks);
+		}, NumTasks == 1);
+	}
+
+	// adds the lanes in a fixed pairwise tree, ((0 + 1) + (2 + 3)) + ...
+	template<typename NumericType>
+	static NumericType CombineLanes(TLanes<NumericType>& Accumulators)
+	{
+		for (int32 Width = 1; Width < FEiVDeterministic::Lanes; Width *= 2) {
+			for (int32 Lane = 0; Lane + Width < FEiVDeterministic::Lanes; Lane += 2 * Width) {
+				Accumulators[Lane] += Accumulators[Lane + Width];
+			}
+		}
+		return Accumulators[0];
+	}
+
+	template<typename NumericType>
+	static NumericType SumLeaf(const NumericType* Data, int64 Count)
+	{
+		TLanes<NumericType> Accumulators = TLanes<NumericType>::Zero();
+		const int64 Vectorized = Count - Count % FEiVDeterministic::Lanes;
+		for (int64 Index = 0; Index < Vectorized; Index += FEiVDeterministic::Lanes) {
+			Accumulators += Eigen::Map<const TLanes<NumericType>>(Data + Index);
+		}
+		for (int64 Index = Vectorized; Index < Count; Index++) {
+			Accumulators[Index - Vectorized] += Data[Index];
+		}
+		return CombineLanes(Accumulators);
+	}
+
+	template<typename NumericType>
+	static NumericType DotLeaf(const NumericType* A, const NumericType* B, int64 Count)
+	{
+		TLanes<NumericType> Accumulators = TLanes<NumericType>::Zero();
+		const int64 Vectorized = Count - Count % FEiVDeterministic::Lanes;
+		for (int64 Index = 0; Index < Vectorized; Index += FEiVDeterministic::Lanes) {
+			Accumulators += Eigen::Map<const TLanes<NumericType>>(A + Index) * Eigen::Map<const TLanes<NumericType>>(B + Index);
+		}
+		for (int64 Index = Vectorized; Index < Count; Index++) {
+			const NumericType Product = A[Index] * B[Index];
+			Accumulators[Index - Vectorized] += Product;
+		}
+		return CombineLanes(Accumulators);
+	}
+
+	// splits Count elements into leaves, reduces the leaves in parallel with LeafKernel(First, Count) and adds the
+	// leaf results in a fixed pairwise tree
+	template<typename NumericType, typename LeafKernelType>
+	static NumericType Reduce(int64 Count, const LeafKernelType& LeafKernel)
+	{
+		if (Count <= 0) {
+			return (NumericType)0;
+		}
+		const int64 NumLeaves = (Count + FEiVDeterministic::LeafSize - 1) / FEiVDeterministic::LeafSize;
+		if (NumLeaves == 1) {
+			return LeafKernel(0, Count);
+		}
+		TArray<NumericType> LeafSums;
+		LeafSums.SetNumUninitialized(NumLeaves);
+		ForEachRange(NumLeaves, GetTaskCount(NumLeaves, MinLeavesPerTask), [&](int64 FirstLeaf, int64 LastLeaf)
+		{
+			for (int64 Leaf = FirstLeaf; Leaf < LastLeaf; Leaf++) {
+				const int64 First = Leaf * FEiVDeterministic::LeafSize;
+				LeafSums[Leaf] = LeafKernel(First, FMath::Min(Count - First, FEiVDeterministic::LeafSize));
+			}
+		});
+		for (int64 Width = 1; Width < NumLeaves; Width *= 2) {
+			for (int64 Leaf = 0; Leaf + Width < NumLeaves; Leaf += 2 * Width) {
+				LeafSums[Leaf] += LeafSums[Leaf + Width];
+			}
+		}
+		return LeafSums[0];
+	}
+
+	template<typename NumericType>
+	static bool Multiply(const FEiVDeterministic::TMatrix<NumericType>& A, const FEiVDeterministic::TMatrix<NumericType>& B, FEiVDeterministic::TMatrix<NumericType>& OutProduct)
+	{
+		if (A.cols() != B.rows()) {
+			return false;
+		}
+		const int64 Rows = A.rows();
+		const int64 Inner = A.cols();
+		const int64 Columns = B.cols();
+		OutProduct.setZero(Rows, Columns);
+		const int64 NumBlocks = (Columns + ColumnBlock - 1) / ColumnBlock;
+		if (Rows == 0 || NumBlocks == 0) {
+			return true;
+		}
+		// every entry adds its terms in order of the inner index, vectorized over the rows of a tile
+		const int32 NumTasks = (int32)FMath::Min<int64>(GetTaskCount(Rows * Inner * Columns, 1 << 16), NumBlocks);
+		ForEachRange(NumBlocks, NumTasks, [&](int64 FirstBlock, int64 LastBlock)
+		{
+			for (int64 Column = FirstBlock * ColumnBlock; Column < FMath::Min(LastBlock * ColumnBlock, Columns); Column += ColumnBlock) {
+				const int64 BlockColumns = FMath::Min(ColumnBlock, Columns - Column);
+				for (int64 Row = 0; Row < Rows; Row += RowTile) {
+					const int64 TileRows = FMath::Min(RowTile, Rows - Row);
+					for (int64 Index = 0; Index < Inner; Index++) {
+						const auto Tile = A.col(Index).segment(Row, TileRows);
+						for (int64 Offset = 0; Offset < BlockColumns; Offset++) {
+							OutProduct.col(Column + Offset).segment(Row, TileRows) += B(Index, Column + Offset) * Tile;
+						}
+					}
+				}
+			}
+		});
+		return true;
+	}
+}
+
+void FEiVDeterministic::SetGlobalEnabled(bool bEnabled)
+{
+	EiVDeterministicPrivate::bGlobalEnabled.store(bEnabled, std::memory_order_relaxed);
+}
+
+bool FEiVDeterministic::IsGlobalEnabled()
+{
+	return EiVDeterministicPrivate::bGlobalEnabled.load(std::memory_order_relaxed);
+}
+
+double FEiVDeterministic::Sum(const double* Data, int64 Count)
+{
+	return EiVDeterministicPrivate::Reduce<double>(Count, [Data](int64 First, int64 LeafCount) { return EiVDeterministicPrivate::SumLeaf(Data + First, LeafCount); });
+}
+
+float FEiVDeterministic::Sum(const float* Data, int64 Count)
+{
+	return EiVDeterministicPrivate::Reduce<float>(Count, [Data](int64 First, int64 LeafCount) { return EiVDeterministicPrivate::SumLeaf(Data + First, LeafCount); });
+}
+
+double FEiVDeterministic::Dot(const double* A, const double* B, int64 Count)
+{
+	return EiVDeterministicPrivate::Reduce<double>(Count, [A, B](int64 First, int64 LeafCount) { return EiVDeterministicPrivate::DotLeaf(A + First, B + First, LeafCount); });
+}
+
+float FEiVDeterministic::Dot(const float* A, const float* B, int64 Count)
+{
+	return EiVDeterministicPrivate::Reduce<float>(Count, [A, B](int64 First, int64 LeafCount) { return EiVDeterministicPrivate::DotLeaf(A + First, B + First, LeafCount); });
+}
+
+double FEiVDeterministic::SquaredNorm(const double* Data, int64 Count)
+{
+	return EiVDeterministicPrivate::Reduce<double>(Count, [Data](int64 First, int64 LeafCount) { return EiVDeterministicPrivate::DotLeaf(Data + First, Data + First, LeafCount); });
+}
+
+float FEiVDeterministic::SquaredNorm(const float* Data, int64 Count)
+{
+	return EiVDeterministicPrivate::Reduce<float>(Count, [Data](int64 First, int64 LeafCount) { return EiVDeterministicPrivate::DotLeaf(Data + First, Data + First, LeafCount); });
+}
+
+bool FEiVDeterministic::Multiply(const TMatrix<double>& A, const TMatrix<double>& B, TMatrix<double>& OutProduct)
+{
+	return EiVDeterministicPrivate::Multiply(A, B, OutProduct);
+}
+
+bool FEiVDeterministic::Multiply(const TMatrix<float>& A, const TMatrix<float>& B, TMatrix<float>& OutProduct)
+{
+	return EiVDeterministicPrivate::Multiply(A, B, OutProduct);
+}
@@ -0,0 +1,129 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#if defined(_WIN64) || defined(_WIN32)
+#include <Windows/WindowsPlatformCompilerPreSetup.h>
+#endif
+#if defined(__APPLE__) && defined(TARGET_OS_MAC)
+#include <Apple/ApplePlatformCompilerPreSetup.h>
+#endif
+#ifdef __linux__
+#include <Unix/UnixPlatformCompilerPreSetup.h>
+#endif
+
+PRAGMA_DEFAULT_VISIBILITY_START
+THIRD_PARTY_INCLUDES_START
+#include <Eigen/Core>
+THIRD_PARTY_INCLUDES_END
+PRAGMA_DEFAULT_VISIBILITY_END
+
+/*
+* Reductions and matrix products whose results are bitwise identical on every machine, for lockstep simulations.
+* Eigen sums in an order that depends on the SIMD width of the build (SSE, AVX and AVX-512 use 2, 4 and 8 lanes for
+* doubles), its matrix product splits the inner sums into blocks sized from the cache sizes of the machine, and the
+* compiler may fuse multiplies and adds into FMAs. The functions here fix the order of every operation instead:
+* - sums are split into leaves of LeafSize elements, each leaf is summed into Lanes interleaved accumulators which are
+*   added in a fixed pairwise tree, and the leaf sums are added in a fixed pairwise tree. The lanes are wider than any
+*   SIMD register, so every instruction set runs the same operations, only in fewer or more instructions, and the
+*   leaves are computed in parallel without the split over threads changing anything
+* - every entry of a matrix product sums its terms in order of the inner index, the rows are vectorized and the
+*   column blocks run in parallel
+* They live in their own EiVDeterministic module, which is built without unity files and with precise floating point
+* semantics (no contraction into FMAs, no reassociation), so no other code shares their translation unit or settings.
+* The module only depends on Core and Eigen, the matrices are plain Eigen matrices, which EiVMatrixX names as well.
+* The results are the same across thread counts and x86-64 instruction set levels, as long as the platform rounds to
+* nearest with IEEE doubles and floats (no flush to zero differences between the machines).
+* The Blueprint sum, mean, dot product, norm and matrix multiplication nodes use these functions while the global
+* deterministic mode is enabled, C++ code can call them directly per call.
+*/
+struct EIVDETERMINISTIC_API FEiVDeterministic
+{
+	// the number of elements of one leaf of the summation tree
+	static constexpr int64 LeafSize = 4096;
+	// the number of interleaved accumulators of one leaf
+	static constexpr int32 Lanes = 16;
+
+	template<typename NumericType> using TMatrix = Eigen::Matrix<NumericType, Eigen::Dynamic, Eigen::Dynamic>;
+	template<typename NumericType> using TVector = Eigen::Matrix<NumericType, Eigen::Dynamic, 1>;
+
+	// This function enables or disables the deterministic mode of the Blueprint math nodes for the whole process
+	// @param bEnabled - if true the nodes use the deterministic functions
+	static void SetGlobalEnabled(bool bEnabled);
+	// @returns - true if the Blueprint math nodes use the deterministic functions
+	static bool IsGlobalEnabled();
+
+	// This function sums an array in a fixed order
+	// @param Data - the array
+	// @param Count - the number of elements
+	// @returns - the sum, zero for an empty array
+	static double Sum(const double* Data, int64 Count);
+	static float Sum(const float* Data, int64 Count);
+	// This function computes the dot product of two arrays in a fixed order
+	// @param A - the first array
+	// @param B - the second array, of the same length
+	// @param Count - the number of elements
+	// @returns - the sum of A[i] * B[i]
+	static double Dot(const double* A, const double* B, int64 Count);
+	static float Dot(const float* A, const float* B, int64 Count);
+	// This function sums the squares of an array in a fixed order
+	// @param Data - the array
+	// @param Count - the number of elements
+	// @returns - the sum of Data[i] * Data[i]
+	static double SquaredNorm(const double* Data, int64 Count);
+	static float SquaredNorm(const float* Data, int64 Count);
+	// This function multiplies two matrices, every entry sums its terms in order of the inner index
+	// @param A - the left matrix
+	// @param B - the right matrix, its rows must match the columns of A
+	// @param OutProduct - A * B, it must not be A or B
+	// @returns - false if the sizes do not match
+	static bool Multiply(const TMatrix<double>& A, const TMatrix<double>& B, TMatrix<double>& OutProduct);
+	static bool Multiply(const TMatrix<float>& A, const TMatrix<float>& B, TMatrix<float>& OutProduct);
+
+	// This function sums the entries of a matrix in a fixed order
+	// @param A - the matrix
+	// @returns - the sum of the entries
+	template<typename NumericType = double>
+	static NumericType MatrixSum(const TMatrix<NumericType>& A)
+	{
+		return FEiVDeterministic::Sum(A.data(), (int64)A.size());
+	}
+	// This function averages the entries of a matrix in a fixed order
+	// @param A - the matrix
+	// @returns - the mean of the entries, zero for an empty matrix
+	template<typename NumericType = double>
+	static NumericType MatrixMean(const TMatrix<NumericType>& A)
+	{
+		return A.size() > 0 ? FEiVDeterministic::Sum(A.data(), (int64)A.size()) / (NumericType)A.size() : (NumericType)0;
+	}
+	// This function computes the Frobenius norm of a matrix in a fixed order
+	// @param A - the matrix
+	// @returns - the square root of the sum of the squared entries
+	template<typename NumericType = double>
+	static NumericType MatrixNorm(const TMatrix<NumericType>& A)
+	{
+		// the square root is correctly rounded by IEEE 754, so it is the same everywhere
+		return std::sqrt(FEiVDeterministic::SquaredNorm(A.data(), (int64)A.size()));
+	}
+	// This function computes the dot product of two vectors in a fixed order
+	// @param A - the first vector
+	// @param B - the second vector
+	// @param OutDot - the dot product
+	// @returns - false if the sizes do not match
+	template<typename NumericType = double>
+	static bool VectorDot(const TVector<NumericType>& A, const TVector<NumericType>& B, NumericType& OutDot)
+	{
+		if (A.size() != B.size()) {
+			return false;
+		}
+		OutDot = FEiVDeterministic::Dot(A.data(), B.data(), (int64)A.size());
+		return true;
+	}
+};
@@ -0,0 +1,23 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+using UnrealBuildTool;
+
+public class EiVMass : ModuleRules
+{
+	public EiVMass(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "MassEntity", "EiV", "Eigen" });
+
+		PrivateDependencyModuleNames.AddRange(new string[] { "Engine" });
+
+		AddEngineThirdPartyPrivateStaticDependencies(Target, "Eigen");
+	}
+}
@@ -0,0 +1,25 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#include "EiVMass.h"
+
+#define LOCTEXT_NAMESPACE "FEiVMassModule"
+
+void FEiVMassModule::StartupModule()
+{
+	// ...
+}
+
+void FEiVMassModule::ShutdownModule()
+{
+	// ...
+}
+
+#undef LOCTEXT_NAMESPACE
+	
+IMPLEMENT_MODULE(FEiVMassModule, EiVMass)
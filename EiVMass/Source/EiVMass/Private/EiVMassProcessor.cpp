@@ -0,0 +1,27 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#include "EiVMassProcessor.h"
+
+UEiVMassProcessor::UEiVMassProcessor()
+{
+	EntityQuery.RegisterWithProcessor(*this);
+}
+
+void UEiVMassProcessor::ConfigureQueries()
+{
+	ConfigureEiVQuery(EntityQuery);
+}
+
+void UEiVMassProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	EntityQuery.ForEachEntityChunk(EntityManager, Context, [this](FMassExecutionContext& ChunkContext)
+	{
+		ExecuteChunk(ChunkContext);
+	});
+}
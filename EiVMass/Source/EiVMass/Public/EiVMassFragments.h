@@ -0,0 +1,217 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+//<><><><><><><><><><><><> EiVLibrary Import Block <><><><><><><><><><><><>
+//imports the specified headers by the macro definitions
+
+#define EIV_INCLUDE_DENSE_MATRIX_ARRAY    //includes most core and basic features
+#define EIV_INCLUDE_GEOMETRY              //includes geometric utilities
+#define EIV_UNDEFINE_INCLUDES             //ensures that these include macros above are local to this file
+
+#include "EiVLibrary.h"   //takes the EIV_INCLUDE macros as settings and retrieves
+                          //the specified Eigen modules, typedefs, and helper functions
+//<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>
+#include "MassEntityTypes.h"
+#include "MassExecutionContext.h"
+#include "EiVMassFragments.generated.h"
+
+/*
+* Mass fragments holding fixed-size EiV types, and views of the fragment arrays of a chunk as Eigen matrices.
+* Mass stores the fragments of a chunk in one array per fragment type, so the values of a fragment with a fixed-size
+* Eigen member lie at a fixed stride in memory. FEiVMassHelper maps that array as one matrix with a column per entity
+* (Rows x NumEntities, with the fragment size as outer stride), so a processor can update a whole chunk with one
+* vectorized Eigen expression instead of a loop over the entities, for example
+*     FEiVMassHelper::MapFragments<FEiVVector3Fragment>(Context) += DeltaTime * FEiVMassHelper::MapConstFragments<FEiVVelocity3Fragment>(Context);
+* Any fragment can be mapped this way as long as its only member is a fixed-size Eigen matrix, quaternion or transform
+* named Value, so projects can declare their own fragment types next to these.
+*/
+
+// A 3D vector per entity, for example a position
+USTRUCT()
+struct EIVMASS_API FEiVVector3Fragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	EiVVector3d Value = EiVVector3d::Zero();
+};
+
+// A 3D velocity per entity, separate from FEiVVector3Fragment so both can be on the same entity
+USTRUCT()
+struct EIVMASS_API FEiVVelocity3Fragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	EiVVector3d Value = EiVVector3d::Zero();
+};
+
+// A 4D vector per entity
+USTRUCT()
+struct EIVMASS_API FEiVVector4Fragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	EiVVector4d Value = EiVVector4d::Zero();
+};
+
+// A 6D state vector per entity, for example a position and a velocity for a Kalman filter
+USTRUCT()
+struct EIVMASS_API FEiVStateVector6Fragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	EiVVector<double, 6> Value = EiVVector<double, 6>::Zero();
+};
+
+// A 3x3 matrix per entity, for example the covariance of a position
+USTRUCT()
+struct EIVMASS_API FEiVMatrix3Fragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	EiVMatrix3d Value = EiVMatrix3d::Identity();
+};
+
+// A 6x6 covariance per entity, matching FEiVStateVector6Fragment
+USTRUCT()
+struct EIVMASS_API FEiVCovariance6Fragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	EiVMatrix<double, 6, 6> Value = EiVMatrix<double, 6, 6>::Identity();
+};
+
+// A rotation per entity, mapped as 4 rows x, y, z, w
+USTRUCT()
+struct EIVMASS_API FEiVQuaternionFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	EiVQuaterniond Value = EiVQuaterniond::Identity();
+};
+
+// An affine transform per entity, mapped as its 4x4 homogeneous matrix
+USTRUCT()
+struct EIVMASS_API FEiVTransformFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	EiVAffine3d Value = EiVAffine3d::Identity();
+};
+
+// The scalar type, size and storage of the value types a fragment can hold
+template<typename ValueType>
+struct TEiVMassValueTraits
+{
+	typedef typename ValueType::Scalar Scalar;
+	static constexpr int32 Rows = ValueType::RowsAtCompileTime;
+	static constexpr int32 Cols = ValueType::ColsAtCompileTime;
+	static_assert(Rows > 0 && Cols > 0, "Mass fragments can only hold fixed-size Eigen types");
+	static_assert(!(ValueType::Flags & Eigen::RowMajorBit) || Cols == 1, "Mass fragment matrices must be column-major");
+	static const Scalar* Data(const ValueType& Value) { return Value.data(); }
+};
+
+template<typename NumericType, int Options>
+struct TEiVMassValueTraits<EiVQuaternion<NumericType, Options>>
+{
+	typedef NumericType Scalar;
+	static constexpr int32 Rows = 4;
+	static constexpr int32 Cols = 1;
+	static const Scalar* Data(const EiVQuaternion<NumericType, Options>& Value) { return Value.coeffs().data(); }
+};
+
+template<typename NumericType, int Dim, int Mode, int Options>
+struct TEiVMassValueTraits<Eigen::Transform<NumericType, Dim, Mode, Options>>
+{
+	typedef NumericType Scalar;
+	static constexpr int32 Rows = Eigen::Transform<NumericType, Dim, Mode, Options>::MatrixType::RowsAtCompileTime;
+	static constexpr int32 Cols = Eigen::Transform<NumericType, Dim, Mode, Options>::MatrixType::ColsAtCompileTime;
+	static const Scalar* Data(const Eigen::Transform<NumericType, Dim, Mode, Options>& Value) { return Value.data(); }
+};
+
+// The Eigen types a chunk of fragments is mapped as
+template<typename FragmentType>
+struct TEiVMassFragmentMap
+{
+	typedef decltype(FragmentType::Value) ValueType;
+	typedef TEiVMassValueTraits<ValueType> Traits;
+	typedef typename Traits::Scalar Scalar;
+	static_assert(sizeof(FragmentType) % sizeof(Scalar) == 0, "the fragment size must be a whole number of scalars");
+	// the distance between the values of two entities, in scalars
+	static constexpr int32 Stride = (int32)(sizeof(FragmentType) / sizeof(Scalar));
+	static constexpr int32 Size = Traits::Rows * Traits::Cols;
+
+	// one column per entity, every value flattened in column-major order
+	typedef EiVMap<EiVMatrix<Scalar, Size, Eigen::Dynamic>, Eigen::Unaligned, Eigen::OuterStride<Stride>> Columns;
+	typedef EiVMap<const EiVMatrix<Scalar, Size, Eigen::Dynamic>, Eigen::Unaligned, Eigen::OuterStride<Stride>> ConstColumns;
+	// the matrices of the entities side by side, Rows x (Cols * NumEntities)
+	typedef EiVMap<EiVMatrix<Scalar, Traits::Rows, Eigen::Dynamic>> Blocks;
+	typedef EiVMap<const EiVMatrix<Scalar, Traits::Rows, Eigen::Dynamic>> ConstBlocks;
+};
+
+/*
+* Views of the fragment arrays of the chunk a FMassExecutionContext is processing.
+* The fragment must be a requirement of the query with the matching access (read-write for the mutable views).
+* The views are only valid inside the chunk callback of the query.
+*/
+struct EIVMASS_API FEiVMassHelper
+{
+	// This function maps the fragments of the current chunk as one column per entity
+	// @param Context - the execution context of the chunk
+	// @returns - a Size x NumEntities map of the values, writing to it writes the fragments
+	template<typename FragmentType>
+	static typename TEiVMassFragmentMap<FragmentType>::Columns MapFragments(FMassExecutionContext& Context)
+	{
+		typedef TEiVMassFragmentMap<FragmentType> MapType;
+		const TArrayView<FragmentType> View = Context.GetMutableFragmentView<FragmentType>();
+		return typename MapType::Columns(const_cast<typename MapType::Scalar*>(FEiVMassHelper::ValueData(View)), MapType::Size, View.Num());
+	}
+	// This function maps the fragments of the current chunk as one column per entity, read only
+	// @param Context - the execution context of the chunk
+	// @returns - a Size x NumEntities map of the values
+	template<typename FragmentType>
+	static typename TEiVMassFragmentMap<FragmentType>::ConstColumns MapConstFragments(FMassExecutionContext& Context)
+	{
+		typedef TEiVMassFragmentMap<FragmentType> MapType;
+		const TConstArrayView<FragmentType> View = Context.GetFragmentView<FragmentType>();
+		return typename MapType::ConstColumns(FEiVMassHelper::ValueData(View), MapType::Size, View.Num());
+	}
+	// This function maps the matrix fragments of the current chunk side by side, so for example the covariances of a
+	// chunk can be multiplied by one shared matrix in a single product. Only for fragments without padding.
+	// @param Context - the execution context of the chunk
+	// @returns - a Rows x (Cols * NumEntities) map of the values, writing to it writes the fragments
+	template<typename FragmentType>
+	static typename TEiVMassFragmentMap<FragmentType>::Blocks MapFragmentBlocks(FMassExecutionContext& Context)
+	{
+		typedef TEiVMassFragmentMap<FragmentType> MapType;
+		static_assert(MapType::Stride == MapType::Size, "the fragment has padding, so its matrices are not side by side");
+		const TArrayView<FragmentType> View = Context.GetMutableFragmentView<FragmentType>();
+		return typename MapType::Blocks(const_cast<typename MapType::Scalar*>(FEiVMassHelper::ValueData(View)), MapType::Traits::Rows, MapType::Traits::Cols * View.Num());
+	}
+	// This function maps the matrix fragments of the current chunk side by side, read only. Only for fragments without padding.
+	// @param Context - the execution context of the chunk
+	// @returns - a Rows x (Cols * NumEntities) map of the values
+	template<typename FragmentType>
+	static typename TEiVMassFragmentMap<FragmentType>::ConstBlocks MapConstFragmentBlocks(FMassExecutionContext& Context)
+	{
+		typedef TEiVMassFragmentMap<FragmentType> MapType;
+		static_assert(MapType::Stride == MapType::Size, "the fragment has padding, so its matrices are not side by side");
+		const TConstArrayView<FragmentType> View = Context.GetFragmentView<FragmentType>();
+		return typename MapType::ConstBlocks(FEiVMassHelper::ValueData(View), MapType::Traits::Rows, MapType::Traits::Cols * View.Num());
+	}
+
+private:
+	// the value of the first fragment, null for an empty chunk
+	template<typename ViewType>
+	static const auto* ValueData(const ViewType& View)
+	{
+		typedef typename TDecay<decltype(View[0])>::Type FragmentType;
+		return View.Num() > 0 ? TEiVMassFragmentMap<FragmentType>::Traits::Data(View[0].Value) : nullptr;
+	}
+};
@@ -0,0 +1,50 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+#include "EiVMassFragments.h"
+#include "MassProcessor.h"
+#include "MassEntityQuery.h"
+#include "EiVMassProcessor.generated.h"
+
+/*
+* A base for Mass processors which update whole chunks with EiV expressions.
+* Subclasses add their fragment requirements in ConfigureEiVQuery and write one chunk at a time in ExecuteChunk, where
+* FEiVMassHelper maps the fragment arrays of the chunk as Eigen matrices, for example
+*     void UMyProcessor::ConfigureEiVQuery(FMassEntityQuery& Query)
+*     {
+*         Query.AddRequirement<FEiVVector3Fragment>(EMassFragmentAccess::ReadWrite);
+*         Query.AddRequirement<FEiVVelocity3Fragment>(EMassFragmentAccess::ReadOnly);
+*     }
+*     void UMyProcessor::ExecuteChunk(FMassExecutionContext& Context)
+*     {
+*         FEiVMassHelper::MapFragments<FEiVVector3Fragment>(Context) += Context.GetDeltaTimeSeconds() * FEiVMassHelper::MapConstFragments<FEiVVelocity3Fragment>(Context);
+*     }
+*/
+UCLASS(Abstract)
+class EIVMASS_API UEiVMassProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UEiVMassProcessor();
+
+protected:
+	// This function adds the fragment, tag and subsystem requirements of the processor to its query
+	// @param Query - the query whose chunks are passed to ExecuteChunk
+	virtual void ConfigureEiVQuery(FMassEntityQuery& Query) {}
+	// This function processes one chunk of the entities matching the query
+	// @param Context - the execution context of the chunk, pass it to FEiVMassHelper to map the fragments
+	virtual void ExecuteChunk(FMassExecutionContext& Context) {}
+
+	virtual void ConfigureQueries() override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+	FMassEntityQuery EntityQuery;
+};
@@ -0,0 +1,21 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+using UnrealBuildTool;
+
+public class EiVNiagara : ModuleRules
+{
+	public EiVNiagara(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "Niagara", "NiagaraCore", "VectorVM", "EiV", "Eigen" });
+
+		AddEngineThirdPartyPrivateStaticDependencies(Target, "Eigen");
+	}
+}
@@ -0,0 +1,25 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#include "EiVNiagara.h"
+
+#define LOCTEXT_NAMESPACE "FEiVNiagaraModule"
+
+void FEiVNiagaraModule::StartupModule()
+{
+	// ...
+}
+
+void FEiVNiagaraModule::ShutdownModule()
+{
+	// ...
+}
+
+#undef LOCTEXT_NAMESPACE
+	
+IMPLEMENT_MODULE(FEiVNiagaraModule, EiVNiagara)
@@ -0,0 +1,487 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+//<><><><><><><><><><><><> EiVLibrary Import Block <><><><><><><><><><><><>
+//imports the specified headers by the macro definitions
+
+#define EIV_INCLUDE_DENSE_MATRIX_ARRAY    //includes most core and basic features
+#define EIV_INCLUDE_EIGENVALUES           //includes the eigenvalue solvers
+#define EIV_INCLUDE_GEOMETRY              //includes geometric utilities
+#define EIV_UNDEFINE_INCLUDES             //ensures that these include macros above are local to this file
+
+#include "EiVLibrary.h"   //takes the EIV_INCLUDE macros as settings and retrieves
+                          //the specified Eigen modules, typedefs, and helper functions
+//<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>
+#include "EiVNiagaraDataInterface.h"
+#include "NiagaraTypes.h"
+
+#define LOCTEXT_NAMESPACE "EiVNiagaraDataInterface"
+
+namespace EiVNiagaraDataInterfacePrivate
+{
+	static const FName GetNumMatricesName(TEXT("GetNumMatrices"));
+	static const FName GetMatrixName(TEXT("GetMatrix"));
+	static const FName TransformPositionName(TEXT("TransformPosition"));
+	static const FName TransformVectorName(TEXT("TransformVector"));
+	static const FName Inverse3x3Name(TEXT("Inverse3x3"));
+	static const FName Solve3x3Name(TEXT("Solve3x3"));
+	static const FName MultiplyQuaternionsName(TEXT("MultiplyQuaternions"));
+	static const FName RotateVectorName(TEXT("RotateVector"));
+	static const FName CovarianceOrientationName(TEXT("CovarianceOrientation"));
+
+	// one value per particle of a block, stored on the stack
+	typedef EiVArray<float, Eigen::Dynamic, 1, Eigen::ColMajor, UEiVNiagaraDataInterface::BlockSize, 1> FLanes;
+
+	// calls Kernel(Count) once for every block of up to BlockSize particles, the parameters advance through the block
+	template<typename KernelType>
+	static void ForEachBlock(FVectorVMExternalFunctionContext& Context, const KernelType& Kernel)
+	{
+		const int32 NumInstances = Context.GetNumInstances();
+		for (int32 First = 0; First < NumInstances; First += UEiVNiagaraDataInterface::BlockSize) {
+			Kernel(FMath::Min(UEiVNiagaraDataInterface::BlockSize, NumInstances - First));
+		}
+	}
+
+	// reads the upper left 3x3 block of a Matrix4 parameter, Out[3 * Row + Col] holds M[Row][Col]
+	static void ReadMatrix3(FNDIInputParam<FMatrix44f>& Param, int32 Count, FLanes (&Out)[9])
+	{
+		for (FLanes& Lanes : Out) {
+			Lanes.resize(Count);
+		}
+		for (int32 Index = 0; Index < Count; Index++) {
+			const FMatrix44f Matrix = Param.GetAndAdvance();
+			for (int32 Row = 0; Row < 3; Row++) {
+				for (int32 Col = 0; Col < 3; Col++) {
+					Out[3 * Row + Col][Index] = Matrix.M[Row][Col];
+				}
+			}
+		}
+	}
+
+	static void ReadVector3(FNDIInputParam<FVector3f>& Param, int32 Count, FLanes (&Out)[3])
+	{
+		for (FLanes& Lanes : Out) {
+			Lanes.resize(Count);
+		}
+		for (int32 Index = 0; Index < Count; Index++) {
+			const FVector3f Vector = Param.GetAndAdvance();
+			Out[0][Index] = Vector.X;
+			Out[1][Index] = Vector.Y;
+			Out[2][Index] = Vector.Z;
+		}
+	}
+
+	// Out holds X, Y, Z and W
+	static void ReadQuaternion(FNDIInputParam<FQuat4f>& Param, int32 Count, FLanes (&Out)[4])
+	{
+		for (FLanes& Lanes : Out) {
+			Lanes.resize(Count);
+		}
+		for (int32 Index = 0; Index < Count; Index++) {
+			const FQuat4f Quaternion = Param.GetAndAdvance();
+			Out[0][Index] = Quaternion.X;
+			Out[1][Index] = Quaternion.Y;
+			Out[2][Index] = Quaternion.Z;
+			Out[3][Index] = Quaternion.W;
+		}
+	}
+
+	static void WriteVector3(FNDIOutputParam<FVector3f>& Param, int32 Count, const FLanes (&In)[3])
+	{
+		for (int32 Index = 0; Index < Count; Index++) {
+			Param.SetAndAdvance(FVector3f(In[0][Index], In[1][Index], In[2][Index]));
+		}
+	}
+
+	static void WriteQuaternion(FNDIOutputParam<FQuat4f>& Param, int32 Count, const FLanes (&In)[4])
+	{
+		for (int32 Index = 0; Index < Count; Index++) {
+			Param.SetAndAdvance(FQuat4f(In[0][Index], In[1][Index], In[2][Index], In[3][Index]));
+		}
+	}
+
+	static void WriteSuccess(FNDIOutputParam<bool>& Param, int32 Count, const FLanes& Success)
+	{
+		for (int32 Index = 0; Index < Count; Index++) {
+			Param.SetAndAdvance(Success[Index] > 0.0f);
+		}
+	}
+
+	static void Cross(const FLanes (&A)[3], const FLanes (&B)[3], FLanes (&Out)[3])
+	{
+		Out[0] = A[1] * B[2] - A[2] * B[1];
+		Out[1] = A[2] * B[0] - A[0] * B[2];
+		Out[2] = A[0] * B[1] - A[1] * B[0];
+	}
+
+	// inverts the 3x3 blocks of a block of particles through their adjugate. OutSuccess is 1 where the determinant is
+	// not tiny relative to the entries, elsewhere it and the inverse are 0
+	static void Inverse3x3(const FLanes (&A)[9], FLanes (&OutInverse)[9], FLanes& OutSuccess)
+	{
+		const FLanes Cofactor0 = A[4] * A[8] - A[5] * A[7];
+		const FLanes Cofactor1 = A[5] * A[6] - A[3] * A[8];
+		const FLanes Cofactor2 = A[3] * A[7] - A[4] * A[6];
+		const FLanes Determinant = A[0] * Cofactor0 + A[1] * Cofactor1 + A[2] * Cofactor2;
+		FLanes Scale = A[0].abs();
+		for (int32 Entry = 1; Entry < 9; Entry++) {
+			Scale = Scale.max(A[Entry].abs());
+		}
+		// a NaN determinant fails the comparison as well
+		OutSuccess = (Determinant.abs() > 1e-6f * Scale * Scale * Scale).cast<float>();
+		const FLanes InverseDeterminant = (OutSuccess > 0.0f).select(Determinant.inverse(), 0.0f);
+		OutInverse[0] = Cofactor0 * InverseDeterminant;
+		OutInverse[1] = (A[2] * A[7] - A[1] * A[8]) * InverseDeterminant;
+		OutInverse[2] = (A[1] * A[5] - A[2] * A[4]) * InverseDeterminant;
+		OutInverse[3] = Cofactor1 * InverseDeterminant;
+		OutInverse[4] = (A[0] * A[8] - A[2] * A[6]) * InverseDeterminant;
+		OutInverse[5] = (A[2] * A[3] - A[0] * A[5]) * InverseDeterminant;
+		OutInverse[6] = Cofactor2 * InverseDeterminant;
+		OutInverse[7] = (A[1] * A[6] - A[0] * A[7]) * InverseDeterminant;
+		OutInverse[8] = (A[0] * A[4] - A[1] * A[3]) * InverseDeterminant;
+	}
+}
+
+void UEiVNiagaraDataInterface::SetMatrices(TConstArrayView<FMatrix44f> InMatrices)
+{
+	FWriteScopeLock WriteLock(MatricesLock);
+	Matrices = InMatrices;
+}
+
+void UEiVNiagaraDataInterface::PostInitProperties()
+{
+	Super::PostInitProperties();
+	if (HasAnyFlags(RF_ClassDefaultObject)) {
+		ENiagaraTypeRegistryFlags Flags = ENiagaraTypeRegistryFlags::AllowAnyVariable | ENiagaraTypeRegistryFlags::AllowParameter;
+		FNiagaraTypeRegistry::Register(FNiagaraTypeDefinition(GetClass()), Flags);
+	}
+}
+
+void UEiVNiagaraDataInterface::GetFunctions(TArray<FNiagaraFunctionSignature>& OutFunctions)
+{
+	using namespace EiVNiagaraDataInterfacePrivate;
+	FNiagaraFunctionSignature BaseSignature;
+	BaseSignature.bMemberFunction = true;
+	BaseSignature.bRequiresContext = false;
+	BaseSignature.bSupportsCPU = true;
+	BaseSignature.bSupportsGPU = false;
+	BaseSignature.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("EiVMatrixBatch")));
+
+	auto AddSignature = [&](FName Name, const FText& Description) -> FNiagaraFunctionSignature&
+	{
+		FNiagaraFunctionSignature& Signature = OutFunctions.Add_GetRef(BaseSignature);
+		Signature.Name = Name;
+#if WITH_EDITORONLY_DATA
+		Signature.SetDescription(Description);
+#endif
+		return Signature;
+	};
+	{
+		FNiagaraFunctionSignature& Signature = AddSignature(GetNumMatricesName, LOCTEXT("GetNumMatricesDescription", "Returns the number of bound matrices."));
+		Signature.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("Num")));
+	}
+	{
+		FNiagaraFunctionSignature& Signature = AddSignature(GetMatrixName, LOCTEXT("GetMatrixDescription", "Returns a bound matrix, the index is clamped to the valid range. Returns the identity if no matrices are bound."));
+		Signature.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("Index")));
+		Signature.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetMatrix4Def(), TEXT("Matrix")));
+	}
+	{
+		FNiagaraFunctionSignature& Signature = AddSignature(TransformPositionName, LOCTEXT("TransformPositionDescription", "Transforms a position by a bound matrix, including its translation. The index is clamped to the valid range, the position is unchanged if no matrices are bound."));
+		Signature.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("Index")));
+		Signature.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Position")));
+		Signature.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Position")));
+	}
+	{
+		FNiagaraFunctionSignature& Signature = AddSignature(TransformVectorName, LOCTEXT("TransformVectorDescription", "Transforms a vector by the upper 3x3 block of a bound matrix. The index is clamped to the valid range, the vector is unchanged if no matrices are bound."));
+		Signature.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("Index")));
+		Signature.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Vector")));
+		Signature.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Vector")));
+	}
+	{
+		FNiagaraFunctionSignature& Signature = AddSignature(Inverse3x3Name, LOCTEXT("Inverse3x3Description", "Inverts the upper left 3x3 block of a matrix, the rest of the result is the identity. Fails and returns zeros if the block is singular."));
+		Signature.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetMatrix4Def(), TEXT("Matrix")));
+		Signature.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetMatrix4Def(), TEXT("Inverse")));
+		Signature.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetBoolDef(), TEXT("Success")));
+	}
+	{
+		FNiagaraFunctionSignature& Signature = AddSignature(Solve3x3Name, LOCTEXT("Solve3x3Description", "Solves A X = B with A the upper left 3x3 block of a matrix, element (Row, Col) being M[Row][Col]. Fails and returns zero if the block is singular."));
+		Signature.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetMatrix4Def(), TEXT("A")));
+		Signature.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("B")));
+		Signature.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("X")));
+		Signature.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetBoolDef(), TEXT("Success")));
+	}
+	{
+		FNiagaraFunctionSignature& Signature = AddSignature(MultiplyQuaternionsName, LOCTEXT("MultiplyQuaternionsDescription", "Multiplies two quaternions, the result rotates by B first and then by A."));
+		Signature.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetQuatDef(), TEXT("A")));
+		Signature.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetQuatDef(), TEXT("B")));
+		Signature.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetQuatDef(), TEXT("Product")));
+	}
+	{
+		FNiagaraFunctionSignature& Signature = AddSignature(RotateVectorName, LOCTEXT("RotateVectorDescription", "Rotates a vector by a unit quaternion."));
+		Signature.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetQuatDef(), TEXT("Rotation")));
+		Signature.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Vector")));
+		Signature.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Vector")));
+	}
+	{
+		FNiagaraFunctionSignature& Signature = AddSignature(CovarianceOrientationName, LOCTEXT("CovarianceOrientationDescription", "Finds the principal axes of the symmetric upper left 3x3 block of a covariance. The rotation turns X, Y and Z onto the axes of the largest, middle and smallest variance, the deviations are the square roots of those variances."));
+		Signature.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetMatrix4Def(), TEXT("Covariance")));
+		Signature.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetQuatDef(), TEXT("Rotation")));
+		Signature.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Deviations")));
+	}
+}
+
+void UEiVNiagaraDataInterface::GetVMExternalFunction(const FVMExternalFunctionBindingInfo& BindingInfo, void* InstanceData, FVMExternalFunction& OutFunc)
+{
+	using namespace EiVNiagaraDataInterfacePrivate;
+	if (BindingInfo.Name == GetNumMatricesName) {
+		OutFunc = FVMExternalFunction::CreateUObject(this, &UEiVNiagaraDataInterface::VMGetNumMatrices);
+	}
+	else if (BindingInfo.Name == GetMatrixName) {
+		OutFunc = FVMExternalFunction::CreateUObject(this, &UEiVNiagaraDataInterface::VMGetMatrix);
+	}
+	else if (BindingInfo.Name == TransformPositionName) {
+		OutFunc = FVMExternalFunction::CreateUObject(this, &UEiVNiagaraDataInterface::VMTransformPosition);
+	}
+	else if (BindingInfo.Name == TransformVectorName) {
+		OutFunc = FVMExternalFunction::CreateUObject(this, &UEiVNiagaraDataInterface::VMTransformVector);
+	}
+	else if (BindingInfo.Name == Inverse3x3Name) {
+		OutFunc = FVMExternalFunction::CreateStatic(&UEiVNiagaraDataInterface::VMInverse3x3);
+	}
+	else if (BindingInfo.Name == Solve3x3Name) {
+		OutFunc = FVMExternalFunction::CreateStatic(&UEiVNiagaraDataInterface::VMSolve3x3);
+	}
+	else if (BindingInfo.Name == MultiplyQuaternionsName) {
+		OutFunc = FVMExternalFunction::CreateStatic(&UEiVNiagaraDataInterface::VMMultiplyQuaternions);
+	}
+	else if (BindingInfo.Name == RotateVectorName) {
+		OutFunc = FVMExternalFunction::CreateStatic(&UEiVNiagaraDataInterface::VMRotateVector);
+	}
+	else if (BindingInfo.Name == CovarianceOrientationName) {
+		OutFunc = FVMExternalFunction::CreateStatic(&UEiVNiagaraDataInterface::VMCovarianceOrientation);
+	}
+}
+
+bool UEiVNiagaraDataInterface::Equals(const UNiagaraDataInterface* Other) const
+{
+	if (!Super::Equals(Other)) {
+		return false;
+	}
+	const UEiVNiagaraDataInterface* OtherTyped = CastChecked<const UEiVNiagaraDataInterface>(Other);
+	FReadScopeLock ReadLock(MatricesLock);
+	FReadScopeLock OtherReadLock(OtherTyped->MatricesLock);
+	return OtherTyped->Matrices == Matrices;
+}
+
+bool UEiVNiagaraDataInterface::CopyToInternal(UNiagaraDataInterface* Destination) const
+{
+	if (!Super::CopyToInternal(Destination)) {
+		return false;
+	}
+	UEiVNiagaraDataInterface* DestinationTyped = CastChecked<UEiVNiagaraDataInterface>(Destination);
+	FReadScopeLock ReadLock(MatricesLock);
+	DestinationTyped->SetMatrices(Matrices);
+	return true;
+}
+
+void UEiVNiagaraDataInterface::VMGetNumMatrices(FVectorVMExternalFunctionContext& Context)
+{
+	FNDIOutputParam<int32> OutNum(Context);
+	FReadScopeLock ReadLock(MatricesLock);
+	for (int32 Index = 0; Index < Context.GetNumInstances(); Index++) {
+		OutNum.SetAndAdvance(Matrices.Num());
+	}
+}
+
+void UEiVNiagaraDataInterface::VMGetMatrix(FVectorVMExternalFunctionContext& Context)
+{
+	FNDIInputParam<int32> InIndex(Context);
+	FNDIOutputParam<FMatrix44f> OutMatrix(Context);
+	FReadScopeLock ReadLock(MatricesLock);
+	const int32 LastMatrix = Matrices.Num() - 1;
+	for (int32 Index = 0; Index < Context.GetNumInstances(); Index++) {
+		const int32 MatrixIndex = InIndex.GetAndAdvance();
+		OutMatrix.SetAndAdvance(LastMatrix >= 0 ? Matrices[FMath::Clamp(MatrixIndex, 0, LastMatrix)] : FMatrix44f::Identity);
+	}
+}
+
+void UEiVNiagaraDataInterface::VMTransformPosition(FVectorVMExternalFunctionContext& Context)
+{
+	TransformBlock(Context, true);
+}
+
+void UEiVNiagaraDataInterface::VMTransformVector(FVectorVMExternalFunctionContext& Context)
+{
+	TransformBlock(Context, false);
+}
+
+void UEiVNiagaraDataInterface::TransformBlock(FVectorVMExternalFunctionContext& Context, bool bTranslate)
+{
+	using namespace EiVNiagaraDataInterfacePrivate;
+	FNDIInputParam<int32> InIndex(Context);
+	FNDIInputParam<FVector3f> InVector(Context);
+	FNDIOutputParam<FVector3f> OutVector(Context);
+	FReadScopeLock ReadLock(MatricesLock);
+	const int32 LastMatrix = Matrices.Num() - 1;
+	ForEachBlock(Context, [&](int32 Count)
+	{
+		// the rows of the matrix of every particle, gathered by its index
+		FLanes Rows[12];
+		for (FLanes& Lanes : Rows) {
+			Lanes.resize(Count);
+		}
+		for (int32 Index = 0; Index < Count; Index++) {
+			const int32 MatrixIndex = InIndex.GetAndAdvance();
+			const FMatrix44f& Matrix = LastMatrix >= 0 ? Matrices[FMath::Clamp(MatrixIndex, 0, LastMatrix)] : FMatrix44f::Identity;
+			for (int32 Row = 0; Row < 4; Row++) {
+				for (int32 Col = 0; Col < 3; Col++) {
+					Rows[3 * Row + Col][Index] = Matrix.M[Row][Col];
+				}
+			}
+		}
+		FLanes Vector[3];
+		ReadVector3(InVector, Count, Vector);
+		FLanes Result[3];
+		for (int32 Col = 0; Col < 3; Col++) {
+			Result[Col] = Vector[0] * Rows[Col] + Vector[1] * Rows[3 + Col] + Vector[2] * Rows[6 + Col];
+			if (bTranslate) {
+				Result[Col] += Rows[9 + Col];
+			}
+		}
+		WriteVector3(OutVector, Count, Result);
+	});
+}
+
+void UEiVNiagaraDataInterface::VMInverse3x3(FVectorVMExternalFunctionContext& Context)
+{
+	using namespace EiVNiagaraDataInterfacePrivate;
+	FNDIInputParam<FMatrix44f> InMatrix(Context);
+	FNDIOutputParam<FMatrix44f> OutInverse(Context);
+	FNDIOutputParam<bool> OutSuccess(Context);
+	ForEachBlock(Context, [&](int32 Count)
+	{
+		FLanes Matrix[9];
+		ReadMatrix3(InMatrix, Count, Matrix);
+		FLanes Inverse[9];
+		FLanes Success;
+		Inverse3x3(Matrix, Inverse, Success);
+		for (int32 Index = 0; Index < Count; Index++) {
+			FMatrix44f Result = FMatrix44f::Identity;
+			for (int32 Row = 0; Row < 3; Row++) {
+				for (int32 Col = 0; Col < 3; Col++) {
+					Result.M[Row][Col] = Inverse[3 * Row + Col][Index];
+				}
+			}
+			OutInverse.SetAndAdvance(Result);
+		}
+		WriteSuccess(OutSuccess, Count, Success);
+	});
+}
+
+void UEiVNiagaraDataInterface::VMSolve3x3(FVectorVMExternalFunctionContext& Context)
+{
+	using namespace EiVNiagaraDataInterfacePrivate;
+	FNDIInputParam<FMatrix44f> InA(Context);
+	FNDIInputParam<FVector3f> InB(Context);
+	FNDIOutputParam<FVector3f> OutX(Context);
+	FNDIOutputParam<bool> OutSuccess(Context);
+	ForEachBlock(Context, [&](int32 Count)
+	{
+		FLanes A[9];
+		ReadMatrix3(InA, Count, A);
+		FLanes B[3];
+		ReadVector3(InB, Count, B);
+		FLanes Inverse[9];
+		FLanes Success;
+		Inverse3x3(A, Inverse, Success);
+		FLanes X[3];
+		for (int32 Row = 0; Row < 3; Row++) {
+			X[Row] = Inverse[3 * Row] * B[0] + Inverse[3 * Row + 1] * B[1] + Inverse[3 * Row + 2] * B[2];
+		}
+		WriteVector3(OutX, Count, X);
+		WriteSuccess(OutSuccess, Count, Success);
+	});
+}
+
+void UEiVNiagaraDataInterface::VMMultiplyQuaternions(FVectorVMExternalFunctionContext& Context)
+{
+	using namespace EiVNiagaraDataInterfacePrivate;
+	FNDIInputParam<FQuat4f> InA(Context);
+	FNDIInputParam<FQuat4f> InB(Context);
+	FNDIOutputParam<FQuat4f> OutProduct(Context);
+	ForEachBlock(Context, [&](int32 Count)
+	{
+		FLanes A[4];
+		ReadQuaternion(InA, Count, A);
+		FLanes B[4];
+		ReadQuaternion(InB, Count, B);
+		// the Hamilton product, laid out as X, Y, Z, W
+		FLanes Product[4];
+		Product[0] = A[3] * B[0] + A[0] * B[3] + A[1] * B[2] - A[2] * B[1];
+		Product[1] = A[3] * B[1] - A[0] * B[2] + A[1] * B[3] + A[2] * B[0];
+		Product[2] = A[3] * B[2] + A[0] * B[1] - A[1] * B[0] + A[2] * B[3];
+		Product[3] = A[3] * B[3] - A[0] * B[0] - A[1] * B[1] - A[2] * B[2];
+		WriteQuaternion(OutProduct, Count, Product);
+	});
+}
+
+void UEiVNiagaraDataInterface::VMRotateVector(FVectorVMExternalFunctionContext& Context)
+{
+	using namespace EiVNiagaraDataInterfacePrivate;
+	FNDIInputParam<FQuat4f> InRotation(Context);
+	FNDIInputParam<FVector3f> InVector(Context);
+	FNDIOutputParam<FVector3f> OutVector(Context);
+	ForEachBlock(Context, [&](int32 Count)
+	{
+		FLanes Rotation[4];
+		ReadQuaternion(InRotation, Count, Rotation);
+		FLanes Vector[3];
+		ReadVector3(InVector, Count, Vector);
+		// v' = v + w t + q x t with t = 2 q x v, where q is the vector part of the quaternion
+		const FLanes Axis[3] = { Rotation[0], Rotation[1], Rotation[2] };
+		FLanes Twice[3];
+		Cross(Axis, Vector, Twice);
+		for (FLanes& Lanes : Twice) {
+			Lanes *= 2.0f;
+		}
+		FLanes Result[3];
+		Cross(Axis, Twice, Result);
+		for (int32 Component = 0; Component < 3; Component++) {
+			Result[Component] += Vector[Component] + Rotation[3] * Twice[Component];
+		}
+		WriteVector3(OutVector, Count, Result);
+	});
+}
+
+void UEiVNiagaraDataInterface::VMCovarianceOrientation(FVectorVMExternalFunctionContext& Context)
+{
+	FNDIInputParam<FMatrix44f> InCovariance(Context);
+	FNDIOutputParam<FQuat4f> OutRotation(Context);
+	FNDIOutputParam<FVector3f> OutDeviations(Context);
+	EiVSelfAdjointEigenSolver<EiVMatrix3f> Solver;
+	for (int32 Index = 0; Index < Context.GetNumInstances(); Index++) {
+		const FMatrix44f Covariance = InCovariance.GetAndAdvance();
+		EiVMatrix3f Matrix;
+		for (int32 Row = 0; Row < 3; Row++) {
+			for (int32 Col = 0; Col < 3; Col++) {
+				Matrix(Row, Col) = Covariance.M[Row][Col];
+			}
+		}
+		// the closed form solver of 3x3 symmetric matrices, its eigenvalues are in increasing order
+		Solver.computeDirect(Matrix);
+		EiVMatrix3f Axes;
+		Axes.col(0) = Solver.eigenvectors().col(2);
+		Axes.col(1) = Solver.eigenvectors().col(1);
+		Axes.col(2) = Axes.col(0).cross(Axes.col(1));
+		const EiVQuaternionf Rotation(Axes);
+		OutRotation.SetAndAdvance(FQuat4f(Rotation.x(), Rotation.y(), Rotation.z(), Rotation.w()));
+		const EiVVector3f Deviations = Solver.eigenvalues().reverse().cwiseMax(0.0f).cwiseSqrt();
+		OutDeviations.SetAndAdvance(FVector3f(Deviations.x(), Deviations.y(), Deviations.z()));
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,52 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#include "EiVNiagaraFunctionLibrary.h"
+#include "EiVNiagaraDataInterface.h"
+#include "NiagaraComponent.h"
+#include "NiagaraFunctionLibrary.h"
+
+void UEiVNiagaraFunctionLibrary::SetNiagaraEiVMatrices(UNiagaraComponent* NiagaraComponent, FName OverrideName, const TArray<FMatrix>& Matrices, EEiVBPFuncSuccess& Success)
+{
+	UEiVNiagaraDataInterface* DataInterface = UNiagaraFunctionLibrary::GetDataInterface<UEiVNiagaraDataInterface>(NiagaraComponent, OverrideName);
+	if (DataInterface == nullptr) {
+		Success = EEiVBPFuncSuccess::FAILURE;
+		return;
+	}
+	TArray<FMatrix44f> Converted;
+	Converted.Reserve(Matrices.Num());
+	for (const FMatrix& Matrix : Matrices) {
+		Converted.Add(FMatrix44f(Matrix));
+	}
+	DataInterface->SetMatrices(Converted);
+	Success = EEiVBPFuncSuccess::SUCCESS;
+}
+
+void UEiVNiagaraFunctionLibrary::SetNiagaraEiVMatrixBatch(UNiagaraComponent* NiagaraComponent, FName OverrideName, FEiVDynamicMatrix Batch, EEiVBPFuncSuccess& Success)
+{
+	const EiVMatrixXd& Matrix = Batch.Matrix;
+	const int32 Size = (int32)Matrix.rows();
+	UEiVNiagaraDataInterface* DataInterface = UNiagaraFunctionLibrary::GetDataInterface<UEiVNiagaraDataInterface>(NiagaraComponent, OverrideName);
+	if (DataInterface == nullptr || (Size != 3 && Size != 4) || Matrix.cols() % Size != 0) {
+		Success = EEiVBPFuncSuccess::FAILURE;
+		return;
+	}
+	const int32 NumMatrices = (int32)(Matrix.cols() / Size);
+	TArray<FMatrix44f> Converted;
+	Converted.Init(FMatrix44f::Identity, NumMatrices);
+	for (int32 Index = 0; Index < NumMatrices; Index++) {
+		// Unreal transforms row vectors, so M[Row][Col] is the transposed entry (Col, Row) of the EiV matrix
+		for (int32 Row = 0; Row < Size; Row++) {
+			for (int32 Col = 0; Col < Size; Col++) {
+				Converted[Index].M[Row][Col] = (float)Matrix(Col, Index * Size + Row);
+			}
+		}
+	}
+	DataInterface->SetMatrices(Converted);
+	Success = EEiVBPFuncSuccess::SUCCESS;
+}
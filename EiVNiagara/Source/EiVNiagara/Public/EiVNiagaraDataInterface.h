@@ -0,0 +1,72 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+#include "NiagaraDataInterface.h"
+#include "EiVNiagaraDataInterface.generated.h"
+
+/*
+* A Niagara data interface with EiV linear algebra for CPU particle simulations.
+* It binds a batch of matrices (set in the editor, from Blueprints with the EiV Niagara function library or from C++)
+* which particles can read and transform positions and vectors with, and provides per particle 3x3 inverses and solves,
+* quaternion products and rotations and the principal axes of a covariance.
+* The VM passes the particles of a chunk in registers, one register per component. The functions copy each block of up
+* to BlockSize particles into Eigen arrays with one entry per particle and evaluate the math as array expressions
+* across the whole block, so it is vectorized across the particles instead of running one particle at a time.
+* Matrices follow the Unreal convention of Niagara's Matrix4 type, a position p is transformed as p * M, and the 3x3
+* functions use the upper left block of the Matrix4 with element (Row, Col) being M[Row][Col].
+*/
+UCLASS(EditInlineNew, Category = "EiV", meta = (DisplayName = "EiV Matrix Batch"))
+class EIVNIAGARA_API UEiVNiagaraDataInterface : public UNiagaraDataInterface
+{
+	GENERATED_BODY()
+
+public:
+	// the number of particles evaluated together by one array expression
+	static constexpr int32 BlockSize = 128;
+
+	// The bound matrices, in the Unreal row vector convention
+	UPROPERTY(EditAnywhere, Category = "EiV")
+	TArray<FMatrix44f> Matrices;
+
+	// This function replaces the bound matrices, it is safe to call while the system simulates
+	// @param InMatrices - the new matrices, in the Unreal row vector convention
+	void SetMatrices(TConstArrayView<FMatrix44f> InMatrices);
+
+	//UObject Interface
+	virtual void PostInitProperties() override;
+	//UObject Interface End
+
+	//UNiagaraDataInterface Interface
+	virtual void GetFunctions(TArray<FNiagaraFunctionSignature>& OutFunctions) override;
+	virtual void GetVMExternalFunction(const FVMExternalFunctionBindingInfo& BindingInfo, void* InstanceData, FVMExternalFunction& OutFunc) override;
+	virtual bool CanExecuteOnTarget(ENiagaraSimTarget Target) const override { return Target == ENiagaraSimTarget::CPUSim; }
+	virtual bool Equals(const UNiagaraDataInterface* Other) const override;
+	//UNiagaraDataInterface Interface End
+
+	void VMGetNumMatrices(FVectorVMExternalFunctionContext& Context);
+	void VMGetMatrix(FVectorVMExternalFunctionContext& Context);
+	void VMTransformPosition(FVectorVMExternalFunctionContext& Context);
+	void VMTransformVector(FVectorVMExternalFunctionContext& Context);
+	static void VMInverse3x3(FVectorVMExternalFunctionContext& Context);
+	static void VMSolve3x3(FVectorVMExternalFunctionContext& Context);
+	static void VMMultiplyQuaternions(FVectorVMExternalFunctionContext& Context);
+	static void VMRotateVector(FVectorVMExternalFunctionContext& Context);
+	static void VMCovarianceOrientation(FVectorVMExternalFunctionContext& Context);
+
+protected:
+	virtual bool CopyToInternal(UNiagaraDataInterface* Destination) const override;
+
+private:
+	// transforms the vector of every particle by the bound matrix it indexes, bTranslate adds the translation row
+	void TransformBlock(FVectorVMExternalFunctionContext& Context, bool bTranslate);
+
+	// guards Matrices against SetMatrices while the simulation reads them
+	mutable FRWLock MatricesLock;
+};
@@ -0,0 +1,32 @@
+// Copyright 2026, Galacticc Games. All rights reserved.
+
+/* Licensed under MIT license. See LICENSE for full license text.
+*
+*        Created: 19th October 2026
+*  Last Modified: 19th October 2026
+*/
+
+#pragma once
+
+#include "EiVBPLibrary.h"
+#include "EiVNiagaraFunctionLibrary.generated.h"
+
+class UNiagaraComponent;
+
+/*
+* Blueprint nodes binding matrices to the EiV Matrix Batch data interface of a Niagara component.
+* The data interface is found by the name of its user parameter, for example "User.Matrices".
+*/
+UCLASS()
+class EIVNIAGARA_API UEiVNiagaraFunctionLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	//Binds Unreal matrices to the EiV Matrix Batch user parameter of a Niagara component. Fails if the component has no such parameter.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Niagara EiV Matrices", Keywords = "EiV Eigen Niagara Particles Matrix Batch Data Interface", AutoCreateRefTerm = "Matrices", ExpandEnumAsExecs = "Success"), Category = "EiV|Niagara")
+	static void SetNiagaraEiVMatrices(UNiagaraComponent* NiagaraComponent, FName OverrideName, const TArray<FMatrix>& Matrices, EEiVBPFuncSuccess& Success);
+	//Binds EiV matrices to the EiV Matrix Batch user parameter of a Niagara component. Batch holds the matrices side by side, 3 x 3N for linear maps or 4 x 4N for homogeneous transforms, in the EiV column vector convention (p' = A p); they are transposed into the Unreal convention. Fails if the component has no such parameter or the batch has another shape.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Set Niagara EiV Matrix Batch", Keywords = "EiV Eigen Niagara Particles Matrix Batch Data Interface", ExpandEnumAsExecs = "Success"), Category = "EiV|Niagara")
+	static void SetNiagaraEiVMatrixBatch(UNiagaraComponent* NiagaraComponent, FName OverrideName, FEiVDynamicMatrix Batch, EEiVBPFuncSuccess& Success);
+};